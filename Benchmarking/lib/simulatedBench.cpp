@@ -1087,32 +1087,7 @@ void eigen_iteratorBenchmark(Eigen::SparseMatrix<VALUE_TYPE>& matrix, std::vecto
 
 template <typename T, typename indexType, int compressionLevel>
 double averageRedundancy(IVSparse::SparseMatrix<T, indexType, compressionLevel>& matrix) {
-    const int numRows = matrix.rows();
-    const int numCols = matrix.cols();
-    int colsWithValues = 0;
-    double totalRedundancy = 0.0;
-
-    for (int j = 0; j < numCols; ++j) {
-        double totalValues = 0;
-        double redundancy = 0;
-        std::unordered_map<double, double> uniqueValues;
-
-        for (typename IVSparse::SparseMatrix<T, indexType, compressionLevel>::InnerIterator it(matrix, j); it; ++it) {
-            uniqueValues.insert(std::pair<double, int>(it.value(), 0));
-            totalValues++;
-        }
-
-        if (totalValues == 0 || uniqueValues.size() == 0)
-            continue;
-        else if (uniqueValues.size() == 1)
-            totalRedundancy += 1;
-        else
-            redundancy = 1 - (uniqueValues.size() / totalValues);
-        totalRedundancy += redundancy;
-        colsWithValues++;
-    }
-
-    return totalRedundancy / static_cast<double>(colsWithValues);
+    return matrix.redundancy();
 }
 
 template <typename T, typename indexType, int compressionLevel>
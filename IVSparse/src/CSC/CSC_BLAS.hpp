@@ -24,7 +24,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::scalarMultiply(T scalar) {
   #ifdef IVSPARSE_HAS_OPENMP
   #pragma omp parallel for
   #endif
-  for (uint32_t i = 0; i < this->outerDim; ++i) {
+  for (uint64_t i = 0; i < this->outerDim; ++i) {
     for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it(newMatrix, i); it; ++it) {
       if (it.isNewRun()) { it.coeff(it.value() * scalar); }
     }
@@ -40,34 +40,45 @@ inline void SparseMatrix<T, indexT, 1, columnMajor>::inPlaceScalarMultiply(T sca
   #ifdef IVSPARSE_HAS_OPENMP
   #pragma omp parallel for
   #endif
-  for (int i = 0; i < nnz; i++) { vals[i] *= scalar; }
+  for (int64_t i = 0; i < (int64_t)nnz; i++) { vals[i] *= scalar; }
 }
 
 //* BLAS Level 2 Routines *//
 
 // Matrix Vector Multiplication (Eigen::VectorXd * IVSparse::SparseMatrix)
 template <typename T, typename indexT, bool columnMajor>
-inline Eigen::VectorXd SparseMatrix<T, indexT, 1, columnMajor>::vectorMultiply(Eigen::VectorXd &vec) {
+template <typename accumT>
+inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 1, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1> &vec) {
   
   #ifdef IVSPARSE_DEBUG
   // check that the vector is the correct size
-  assert(vec.rows() == outerDim &&
+  assert((uint64_t)vec.rows() == numCols &&
          "The vector must be the same size as the "
          "number of columns in the matrix!");
   #endif
 
-  Eigen::Matrix<T, -1, 1> eigenTemp(innerDim, 1);
-  eigenTemp.setZero();
+  Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows);
 
-  // iterate over the vector and multiply the corresponding row of the matrix by
-  // the vecIter value
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int i = 0; i < vec.rows(); ++i) {
-    if (vec(i) == 0) continue;
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator matIter(*this, i); matIter; ++matIter) {
-      eigenTemp.coeffRef(matIter.row()) += matIter.value() * vec(i);
+  if constexpr (columnMajor) {
+    // scatter each column scaled by its vector entry into fixed partial buffers
+    IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT *buffer) {
+      if (vec(i) == 0) return;
+      for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+        buffer[innerIdx[k]] += static_cast<accumT>(vals[k]) * vec(i);
+      }
+    });
+  }
+  else {
+    // each row is an independent dot product
+    #ifdef IVSPARSE_HAS_OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    #endif
+    for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+      accumT rowSum = 0;
+      for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+        rowSum += static_cast<accumT>(vals[k]) * vec(innerIdx[k]);
+      }
+      eigenTemp(i) = rowSum;
     }
   }
   return eigenTemp;
@@ -76,71 +87,104 @@ inline Eigen::VectorXd SparseMatrix<T, indexT, 1, columnMajor>::vectorMultiply(E
 // Matrix Vector Multiplication
 // (IVSparse::SparseMatrix * IVSparse::SparseMatrix::Vector)
 template <typename T, typename indexT, bool columnMajor>
-inline Eigen::VectorXd SparseMatrix<T, indexT, 1, columnMajor>::vectorMultiply(typename SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec) {
+template <typename accumT>
+inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 1, columnMajor>::vectorMultiply(typename SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec) {
   
   #ifdef IVSPARSE_DEBUG
-  if (vec.length() != outerDim)
+  if (vec.getLength() != numCols)
     throw std::invalid_argument(
         "The vector must be the same size as the "
         "number of columns in the matrix!");
   #endif
 
-  Eigen::Matrix<T, -1, 1> newVector = Eigen::Matrix<T, -1, 1>::Zero(innerDim, 1);
+  Eigen::Matrix<accumT, -1, 1> newVector = Eigen::Matrix<accumT, -1, 1>::Zero(numRows);
 
-  // #ifdef IVSPARSE_HAS_OPENMP
-  // #pragma omp parallel for
-  // #endif
-  for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator matIter(*this, vecIter.row()); matIter; ++matIter) {
-      newVector.coeffRef(matIter.row()) += matIter.value() * vecIter.value();
+  if constexpr (columnMajor) {
+    // only the columns matching a non-zero of the vector are scattered
+    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+      uint64_t i = vecIter.getIndex();
+      for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+        newVector(innerIdx[k]) += static_cast<accumT>(vals[k]) * vecIter.value();
+      }
     }
   }
+  else {
+    // the rows gather from the vector, so it is made dense first
+    Eigen::Matrix<accumT, -1, 1> dense = Eigen::Matrix<accumT, -1, 1>::Zero(numCols);
+    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+      dense(vecIter.getIndex()) = vecIter.value();
+    }
+    newVector = vectorMultiply(dense);
+  }
   return newVector;
 }
 
 //* BLAS Level 3 Routines *//
 
-// Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+// Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
 template <typename T, typename indexT, bool columnMajor>
-inline Eigen::Matrix<T, -1, -1> SparseMatrix<T, indexT, 1, columnMajor>::matrixMultiply(Eigen::Matrix<T, -1, -1> &mat) {
+template <typename accumT>
+inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 1, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1> &mat) {
   
   #ifdef IVSPARSE_DEBUG
   // check that the matrix is the correct size
-  if (mat.rows() != outerDim)
+  if ((uint64_t)mat.rows() != numCols)
     throw std::invalid_argument(
         "The left matrix must be the same size as the number of columns in "
         "the right matrix!");
   #endif
 
-  Eigen::Matrix<T, -1, -1> newMatrix = Eigen::Matrix<T, -1, -1>::Zero(innerDim, mat.cols());
-
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int col = 0; col < mat.cols(); col++) {
-    for (int row = 0; row < mat.rows(); row++) {
-      for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator matIter(*this, row); matIter; ++matIter) {
-        newMatrix.coeffRef(matIter.row(), col) += matIter.value() * mat(row, col);
+  // work on the transposes so the rows of both dense matrices are contiguous
+  Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+  Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+  const int64_t width = mat.cols();
+
+  if constexpr (columnMajor) {
+    // each thread owns a block of the dense columns and scatters the whole matrix into it
+    const int64_t blockWidth = 8;
+
+    #ifdef IVSPARSE_HAS_OPENMP
+    #pragma omp parallel for schedule(dynamic, 1)
+    #endif
+    for (int64_t start = 0; start < width; start += blockWidth) {
+      const int64_t length = std::min(blockWidth, width - start);
+
+      for (uint64_t i = 0; i < outerDim; i++) {
+        for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+          newMatrix.col(innerIdx[k]).segment(start, length) += matTranspose.col(i).segment(start, length) * static_cast<accumT>(vals[k]);
+        }
       }
     }
   }
-  return newMatrix;
+  else {
+    // each row of the result only reads the rows of mat it touches
+    #ifdef IVSPARSE_HAS_OPENMP
+    #pragma omp parallel for schedule(dynamic, 64)
+    #endif
+    for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+      for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+        newMatrix.col(i) += matTranspose.col(innerIdx[k]) * static_cast<accumT>(vals[k]);
+      }
+    }
+  }
+  return newMatrix.transpose();
 }
 
 //* Other Matrix Calculations *//
 
 // Finds the sum of each outer vector
 template <typename T, typename indexT, bool columnMajor>
-inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::outerSum() {
+template <typename accumT>
+inline std::vector<accumT> SparseMatrix<T, indexT, 1, columnMajor>::outerSum() {
   
-  std::vector<T> outerSum = std::vector<T>(outerDim);
+  std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
 
   #ifdef IVSPARSE_HAS_OPENMP
   #pragma omp parallel for
   #endif
-  for (int i = 0; i < outerDim; i++) {
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
     for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      outerSum[i] += it.value();
+      outerSum[i] += static_cast<accumT>(it.value());
     }
   }
   return outerSum;
@@ -148,88 +192,122 @@ inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::outerSum() {
 
 // Finds the sum of each inner vector
 template <typename T, typename indexT, bool columnMajor>
-inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::innerSum() { 
+template <typename accumT>
+inline std::vector<accumT> SparseMatrix<T, indexT, 1, columnMajor>::innerSum() {
   
-  std::vector<T> innerSum = std::vector<T>(innerDim);
+  std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
 
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      innerSum[it.row()] += it.value();
+  // scattered into fixed partial buffers so the outer vectors can be split between threads
+  IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT *buffer) {
+    for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+      buffer[innerIdx[k]] += static_cast<accumT>(vals[k]);
     }
-  }
+  });
   return innerSum;
 }
 
-// Finds the max of each column
+// Finds the maximum value in each column
 template <typename T, typename indexT, bool columnMajor>
 inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::maxColCoeff() {
-  
-  std::vector<T> maxCoeff = std::vector<T>(innerDim);
+  if constexpr (columnMajor) { return outerExtremes<true>(nullptr); }
+  else { return innerExtremes<true>(nullptr); }
+}
 
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      if (it.value() > maxCoeff[i]) { maxCoeff[i] = it.value(); }
-    }
-  }
-  return maxCoeff;
+// Finds the maximum value and its row in each column
+template <typename T, typename indexT, bool columnMajor>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::maxColCoeff(std::vector<uint64_t>& indices) {
+  if constexpr (columnMajor) { return outerExtremes<true>(&indices); }
+  else { return innerExtremes<true>(&indices); }
 }
 
-// Finds the max of each row
+// Finds the maximum value in each row
 template <typename T, typename indexT, bool columnMajor>
 inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::maxRowCoeff() {
-  
-  std::vector<T> maxCoeff = std::vector<T>(innerDim);
+  if constexpr (columnMajor) { return innerExtremes<true>(nullptr); }
+  else { return outerExtremes<true>(nullptr); }
+}
 
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      if (it.value() > maxCoeff[it.row()]) { maxCoeff[it.row()] = it.value(); }
-    }
-  }
-  return maxCoeff;
+// Finds the maximum value and its column in each row
+template <typename T, typename indexT, bool columnMajor>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::maxRowCoeff(std::vector<uint64_t>& indices) {
+  if constexpr (columnMajor) { return innerExtremes<true>(&indices); }
+  else { return outerExtremes<true>(&indices); }
 }
 
-// Finds the min of each column
+// Finds the minimum value in each column
 template <typename T, typename indexT, bool columnMajor>
 inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::minColCoeff() {
-  
-  std::vector<T> minCoeff = std::vector<T>(innerDim);
+  if constexpr (columnMajor) { return outerExtremes<false>(nullptr); }
+  else { return innerExtremes<false>(nullptr); }
+}
 
-  #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
-  #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      if (it.value() < minCoeff[i]) { minCoeff[i] = it.value(); }
-    }
-  }
-  return minCoeff;
+// Finds the minimum value and its row in each column
+template <typename T, typename indexT, bool columnMajor>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::minColCoeff(std::vector<uint64_t>& indices) {
+  if constexpr (columnMajor) { return outerExtremes<false>(&indices); }
+  else { return innerExtremes<false>(&indices); }
 }
 
-// Finds the min of each row
+// Finds the minimum value in each row
 template <typename T, typename indexT, bool columnMajor>
 inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::minRowCoeff() {
-  
-  std::vector<T> minCoeff = std::vector<T>(innerDim);
-  memset(minCoeff.data(), 0xF, innerDim * sizeof(T));
+  if constexpr (columnMajor) { return innerExtremes<false>(nullptr); }
+  else { return outerExtremes<false>(nullptr); }
+}
+
+// Finds the minimum value and its column in each row
+template <typename T, typename indexT, bool columnMajor>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::minRowCoeff(std::vector<uint64_t>& indices) {
+  if constexpr (columnMajor) { return innerExtremes<false>(&indices); }
+  else { return outerExtremes<false>(&indices); }
+}
+
+// Minimum or maximum of each outer vector
+template <typename T, typename indexT, bool columnMajor>
+template <bool isMax>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::outerExtremes(std::vector<uint64_t>* indices) {
+
+  std::vector<T> result(outerDim);
+  if (indices != nullptr) { indices->assign(outerDim, 0); }
 
   #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
+  #pragma omp parallel for schedule(dynamic, 64)
   #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      if (it.value() < minCoeff[it.row()]) { minCoeff[it.row()] = it.value(); }
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+    bool found = false;
+    T value = 0;
+    uint64_t index = 0;
+
+    // inner indices are sorted so the first extreme is the smallest index
+    for (indexT j = outerPtr[i]; j < outerPtr[i + 1]; j++) {
+      if (!found || (isMax ? vals[j] > value : vals[j] < value)) {
+        value = vals[j];
+        index = innerIdx[j];
+        found = true;
+      }
     }
+
+    // compare against the implicit zeros
+    uint64_t count = outerPtr[i + 1] - outerPtr[i];
+    if (count < innerDim && (!found || (isMax ? value < 0 : value > 0))) {
+      value = 0;
+      index = 0;
+      while (index < count && (uint64_t)innerIdx[outerPtr[i] + index] == index) { index++; }
+    }
+
+    result[i] = value;
+    if (indices != nullptr) { (*indices)[i] = index; }
   }
-  return minCoeff;
+  return result;
+}
+
+// Minimum or maximum of each inner vector
+template <typename T, typename indexT, bool columnMajor>
+template <bool isMax>
+inline std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::innerExtremes(std::vector<uint64_t>* indices) {
+  return IVSparse::blockedInnerExtremes<T, isMax>(outerDim, innerDim, indices, [this](uint64_t vec, auto&& visit) {
+    for (indexT j = outerPtr[vec]; j < outerPtr[vec + 1]; j++) { visit(innerIdx[j], vals[j]); }
+  });
 }
 
 // finds the trace of the matrix
@@ -241,13 +319,14 @@ inline T SparseMatrix<T, indexT, 1, columnMajor>::trace() {
   #endif
 
   T trace = 0;
+
+  // the diagonal is where the inner index matches the outer index in either storage order
   #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
+  #pragma omp parallel for reduction(+ : trace)
   #endif
-  for (int i = 0; i < outerDim; i++) {
-    for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      if (it.row() == i) { trace += it.value(); } 
-      else if (it.row() > i) { continue; }
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+    for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+      if (innerIdx[k] == i) { trace += vals[k]; }
     }
   }
   return trace;
@@ -255,16 +334,17 @@ inline T SparseMatrix<T, indexT, 1, columnMajor>::trace() {
 
 // Finds the sum of the matrix
 template <typename T, typename indexT, bool columnMajor>
-inline T SparseMatrix<T, indexT, 1, columnMajor>::sum() {
+template <typename accumT>
+inline accumT SparseMatrix<T, indexT, 1, columnMajor>::sum() {
   
-  T sum = 0;
+  accumT sum = 0;
 
   #ifdef IVSPARSE_HAS_OPENMP
-  #pragma omp parallel for
+  #pragma omp parallel for reduction(+ : sum)
   #endif
-  for (int i = 0; i < outerDim; i++) {
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
     for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      sum += it.value();
+      sum += static_cast<accumT>(it.value());
     }
   }
   return sum;
@@ -272,13 +352,17 @@ inline T SparseMatrix<T, indexT, 1, columnMajor>::sum() {
 
 // Finds the norm of the matrix
 template <typename T, typename indexT, bool columnMajor>
-inline double SparseMatrix<T, indexT, 1, columnMajor>::norm() {
+template <typename accumT>
+inline accumT SparseMatrix<T, indexT, 1, columnMajor>::norm() {
   
-  double norm = 0;
+  accumT norm = 0;
 
-  for (int i = 0; i < outerDim; i++) {
+  #ifdef IVSPARSE_HAS_OPENMP
+  #pragma omp parallel for reduction(+ : norm)
+  #endif
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
     for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it( *this, i); it; ++it) {
-      norm += it.value() * it.value();
+      norm += static_cast<accumT>(it.value()) * static_cast<accumT>(it.value());
     }
   }
   return sqrt(norm);
@@ -286,19 +370,119 @@ inline double SparseMatrix<T, indexT, 1, columnMajor>::norm() {
 
 // Finds the length of a vector in the matrix
 template <typename T, typename indexT, bool columnMajor>
-inline double SparseMatrix<T, indexT, 1, columnMajor>::vectorLength(uint32_t col) {
+template <typename accumT>
+inline accumT SparseMatrix<T, indexT, 1, columnMajor>::vectorLength(uint64_t col) {
   
   #ifdef IVSPARSE_DEBUG
   // ensure the column is in bounds
   assert(col < outerDim && col >= 0 && "Column is out of bounds!");
   #endif
 
-  double norm = 0;
+  accumT norm = 0;
 
   for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it(*this, col); it; ++it) {
-    norm += it.value() * it.value();
+    norm += static_cast<accumT>(it.value()) * static_cast<accumT>(it.value());
   }
   return sqrt(norm);
 }
 
-}  // namespace IVSparse
\ No newline at end of file
+// Finds the statistics of each column
+template <typename T, typename indexT, bool columnMajor>
+inline IVSparse::SummaryStats SparseMatrix<T, indexT, 1, columnMajor>::columnStats() {
+  if constexpr (columnMajor) { return outerStats(); }
+  else { return innerStats(); }
+}
+
+// Finds the statistics of each row
+template <typename T, typename indexT, bool columnMajor>
+inline IVSparse::SummaryStats SparseMatrix<T, indexT, 1, columnMajor>::rowStats() {
+  if constexpr (columnMajor) { return innerStats(); }
+  else { return outerStats(); }
+}
+
+// Statistics of each outer vector
+template <typename T, typename indexT, bool columnMajor>
+inline IVSparse::SummaryStats SparseMatrix<T, indexT, 1, columnMajor>::outerStats() {
+
+  IVSparse::SummaryStats stats(outerDim);
+  std::vector<IVSparse::Moments> moments(outerDim);
+
+  #ifdef IVSPARSE_HAS_OPENMP
+  #pragma omp parallel for schedule(dynamic, 64)
+  #endif
+  for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+    double sum = 0, sumSq = 0;
+
+    for (indexT j = outerPtr[i]; j < outerPtr[i + 1]; j++) {
+      double value = static_cast<double>(vals[j]);
+      sum += value;
+      sumSq += value * value;
+      moments[i].add(value);
+    }
+
+    stats.sum[i] = sum;
+    stats.sumSq[i] = sumSq;
+  }
+
+  stats.finalize(moments, innerDim);
+  return stats;
+}
+
+// Statistics of each inner vector
+template <typename T, typename indexT, bool columnMajor>
+inline IVSparse::SummaryStats SparseMatrix<T, indexT, 1, columnMajor>::innerStats() {
+
+  IVSparse::SummaryStats stats(innerDim);
+
+  IVSparse::blockedInnerStats(outerDim, innerDim, stats, [this](uint64_t vec, double* sum, double* sumSq, IVSparse::Moments* moments) {
+    for (indexT j = outerPtr[vec]; j < outerPtr[vec + 1]; j++) {
+      double value = static_cast<double>(vals[j]);
+      sum[innerIdx[j]] += value;
+      sumSq[innerIdx[j]] += value * value;
+      moments[innerIdx[j]].add(value);
+    }
+  });
+
+  return stats;
+}
+
+// Histogram of a vector from a sorted copy of its values
+template <typename T, typename indexT, bool columnMajor>
+inline std::vector<std::pair<T, uint64_t>> SparseMatrix<T, indexT, 1, columnMajor>::valueHistogram(uint64_t vec) {
+
+  #ifdef IVSPARSE_DEBUG
+  assert(vec < outerDim && "The vector index is out of bounds!");
+  #endif
+
+  std::vector<T> sorted(vals + outerPtr[vec], vals + outerPtr[vec + 1]);
+  std::sort(sorted.begin(), sorted.end());
+
+  std::vector<std::pair<T, uint64_t>> histogram;
+  for (size_t k = 0; k < sorted.size(); k++) {
+    if (k == 0 || sorted[k] != sorted[k - 1]) { histogram.emplace_back(sorted[k], 0); }
+    histogram.back().second++;
+  }
+  return histogram;
+}
+
+// Number of distinct values in the matrix
+template <typename T, typename indexT, bool columnMajor>
+inline uint64_t SparseMatrix<T, indexT, 1, columnMajor>::uniqueValueCount() {
+  return IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }).size();
+}
+
+// Average redundancy of the vectors
+template <typename T, typename indexT, bool columnMajor>
+inline double SparseMatrix<T, indexT, 1, columnMajor>::redundancy() {
+  return IVSparse::averageRedundancy(outerDim, [this](uint64_t i, uint64_t &unique, uint64_t &nnz) {
+    unique = valueHistogram(i).size();
+    nnz = outerPtr[i + 1] - outerPtr[i];
+  });
+}
+
+// Shannon entropy of the values
+template <typename T, typename indexT, bool columnMajor>
+inline double SparseMatrix<T, indexT, 1, columnMajor>::entropy() {
+  return IVSparse::valueEntropy(IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }));
+}
+}  // namespace IVSparse
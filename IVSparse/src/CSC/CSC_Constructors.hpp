@@ -29,99 +29,30 @@ SparseMatrix<T, indexT, 1, columnMajor>::~SparseMatrix() {
 
 // Eigen Constructor
 template <typename T, typename indexT, bool columnMajor>
-SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T> &mat) {
-  
-  // Make sure the matrix is compressed before reading it in
-  mat.makeCompressed();
-
-  // set the dimensions and nnz
-  innerDim = mat.innerSize();
-  outerDim = mat.outerSize();
-  numRows = mat.rows();
-  numCols = mat.cols();
-  nnz = mat.nonZeros();
+SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T> &mat) {
 
-  encodeValueType();
-  index_t = sizeof(indexT);
-
-  // allocate the memory
-  try {
-    vals = (T *)malloc(nnz * sizeof(T));
-    innerIdx = (indexT *)malloc(nnz * sizeof(indexT));
-    outerPtr = (indexT *)malloc((outerDim + 1) * sizeof(indexT));
-  } catch (std::bad_alloc &e) {
-    std::cerr << "Allocation failed: " << e.what() << '\n';
-  }
-
-  // set the metadata
-  metadata = new uint32_t[NUM_META_DATA];
-  metadata[0] = 1;
-  metadata[1] = innerDim;
-  metadata[2] = outerDim;
-  metadata[3] = nnz;
-  metadata[4] = val_t;
-  metadata[5] = index_t;
-
-  // copy the data
-  memcpy(vals, mat.valuePtr(), sizeof(T) * nnz);
-  memcpy(innerIdx, mat.innerIndexPtr(), sizeof(indexT) * nnz);
-  memcpy(outerPtr, mat.outerIndexPtr(), sizeof(indexT) * (outerDim + 1));
-
-  // calculate the compressed size and run the user checks
-  calculateCompSize();
-
-  // run the user checks
-  #ifdef IVSPARSE_DEBUG
-  userChecks();
-  #endif
+  // copy the matrix in the storage order of the matrix
+  compressEigen(mat);
 }
 
 // eigen sparse matrix constructor (row major)
 template <typename T, typename indexT, bool columnMajor>
-SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T, Eigen::RowMajor> &other) {
-  
-  other.makeCompressed();
-
-  // set the dimensions and nnz
-  innerDim = other.innerSize();
-  outerDim = other.outerSize();
-  numRows = other.rows();
-  numCols = other.cols();
-  nnz = other.nonZeros();
-
-  encodeValueType();
-  index_t = sizeof(indexT);
-
-  // allocate the memory
-  try {
-    vals = (T *)malloc(nnz * sizeof(T));
-    innerIdx = (indexT *)malloc(nnz * sizeof(indexT));
-    outerPtr = (indexT *)malloc((outerDim + 1) * sizeof(indexT));
-  } catch (std::bad_alloc &e) {
-    std::cerr << "Allocation failed: " << e.what() << '\n';
-  }
+SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor> &other) {
 
-  // set the metadata
-  metadata = new uint32_t[NUM_META_DATA];
-  metadata[0] = 1;
-  metadata[1] = innerDim;
-  metadata[2] = outerDim;
-  metadata[3] = nnz;
-  metadata[4] = val_t;
-  metadata[5] = index_t;
-
-  // copy the data
-  memcpy(vals, other.valuePtr(), sizeof(T) * nnz);
-  memcpy(innerIdx, other.innerIndexPtr(), sizeof(indexT) * nnz);
-  memcpy(outerPtr, other.outerIndexPtr(), sizeof(indexT) * (outerDim + 1));
+  // copy the matrix in the storage order of the matrix
+  compressEigen(other);
+}
 
-  // calculate the compressed size and run the user checks
-  calculateCompSize();
+// Eigen Dense Constructor
+template <typename T, typename indexT, bool columnMajor>
+SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1> &mat, T epsilon) {
+  compressDense(mat, epsilon);
+}
 
-  // run the user checks
-  #ifdef IVSPARSE_DEBUG
-  userChecks();
-  #endif
+// Eigen Dense Row Major Constructor
+template <typename T, typename indexT, bool columnMajor>
+SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1, Eigen::RowMajor> &mat, T epsilon) {
+  compressDense(mat, epsilon);
 }
 
 // Deep Copy Constructor
@@ -163,15 +94,15 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(IVSparse::SparseMatrix<T,
 template <typename T, typename indexT, bool columnMajor>
 template <typename T2, typename indexT2>
 SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(
-T2 *vals, indexT2 *innerIndices, indexT2 *outerPtr, uint32_t num_rows, uint32_t num_cols, uint32_t nnz) {
+T2 *vals, indexT2 *innerIndices, indexT2 *outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
   
   #ifdef IVSPARSE_DEBUG
-  assert(vals != nullptr && "Values array is null");
-  assert(innerIndices != nullptr && "Inner indices array is null");
+  // an all-zero matrix has no values or inner indices to point at
+  assert((nnz == 0 || vals != nullptr) && "Values array is null");
+  assert((nnz == 0 || innerIndices != nullptr) && "Inner indices array is null");
   assert(outerPtr != nullptr && "Outer pointer array is null");
   assert(num_rows > 0 && "Number of rows must be greater than 0");
   assert(num_cols > 0 && "Number of columns must be greater than 0");
-  assert(nnz > 0 && "Number of nonzeros must be greater than 0");
   #endif
 
   // set the dimensions and nnz
@@ -200,7 +131,7 @@ T2 *vals, indexT2 *innerIndices, indexT2 *outerPtr, uint32_t num_rows, uint32_t
   }
 
   // set the metadata
-  metadata = new uint32_t[NUM_META_DATA];
+  metadata = new uint64_t[NUM_META_DATA];
   metadata[0] = 1;
   metadata[1] = innerDim;
   metadata[2] = outerDim;
@@ -209,8 +140,10 @@ T2 *vals, indexT2 *innerIndices, indexT2 *outerPtr, uint32_t num_rows, uint32_t
   metadata[5] = index_t;
 
   // copy the data
-  memcpy(this->vals, vals, sizeof(T) * nnz);
-  memcpy(innerIdx, innerIndices, sizeof(indexT) * nnz);
+  if (nnz > 0) {
+    memcpy(this->vals, vals, sizeof(T) * nnz);
+    memcpy(innerIdx, innerIndices, sizeof(indexT) * nnz);
+  }
   memcpy(this->outerPtr, outerPtr, sizeof(indexT) * (outerDim + 1));
 
   // calculate the compressed size and run the user checks
@@ -244,7 +177,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(typename IVSparse::SparseM
   encodeValueType();
   index_t = sizeof(indexT);
 
-  metadata = new uint32_t[NUM_META_DATA];
+  metadata = new uint64_t[NUM_META_DATA];
   metadata[0] = 1;
   metadata[1] = innerDim;
   metadata[2] = outerDim;
@@ -265,6 +198,8 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(typename IVSparse::SparseM
     }
 
     outerPtr[0] = 0;
+    outerPtr[1] = 0;
+    calculateCompSize();
     return;
   }
 
@@ -295,15 +230,60 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(typename IVSparse::SparseM
 template <typename T, typename indexT, bool columnMajor>
 SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(
 std::vector<typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector> &vecs) {
-  
-  // Make a temporary CSC matrix
-  IVSparse::SparseMatrix<T, indexT, 1, columnMajor> temp(vecs[0]);
 
-  // append on each vector in the array
-  for (size_t i = 1; i < vecs.size(); i++) { temp.append(vecs[i]); }
+  #ifdef IVSPARSE_DEBUG
+  assert(vecs.size() > 0 && "Cannot construct a matrix from no vectors");
+  for (size_t i = 1; i < vecs.size(); i++) {
+    assert(vecs[i].getLength() == vecs[0].getLength() && "All vectors must be the same length");
+  }
+  #endif
 
-  // copy the temporary matrix
-  *this = temp;
+  // get the dimensions and metadata
+  innerDim = vecs[0].getLength();
+  outerDim = vecs.size();
+  numRows = columnMajor ? innerDim : outerDim;
+  numCols = columnMajor ? outerDim : innerDim;
+
+  encodeValueType();
+  index_t = sizeof(indexT);
+
+  // the outer pointers are the prefix sums of the vector sizes
+  try {
+    outerPtr = (indexT *)malloc((outerDim + 1) * sizeof(indexT));
+  } catch (std::bad_alloc &e) {
+    std::cerr << "Allocation failed: " << e.what() << '\n';
+  }
+
+  outerPtr[0] = 0;
+  for (uint64_t i = 0; i < outerDim; i++) { outerPtr[i + 1] = outerPtr[i] + vecs[i].nonZeros(); }
+  nnz = outerPtr[outerDim];
+
+  metadata = new uint64_t[NUM_META_DATA];
+  metadata[0] = 1;
+  metadata[1] = innerDim;
+  metadata[2] = outerDim;
+  metadata[3] = nnz;
+  metadata[4] = val_t;
+  metadata[5] = index_t;
+
+  // allocate the memory once for all of the vectors
+  try {
+    vals = (T *)malloc(nnz * sizeof(T));
+    innerIdx = (indexT *)malloc(nnz * sizeof(indexT));
+  } catch (std::bad_alloc &e) {
+    std::cerr << "Allocation failed: " << e.what() << '\n';
+  }
+
+  // copy each vector into its slice of the arrays
+  #ifdef IVSPARSE_HAS_OPENMP
+  #pragma omp parallel for
+  #endif
+  for (uint64_t i = 0; i < outerDim; i++) {
+    if (vecs[i].nonZeros() == 0) { continue; }
+
+    memcpy(vals + outerPtr[i], vecs[i].getValues(), sizeof(T) * vecs[i].nonZeros());
+    memcpy(innerIdx + outerPtr[i], vecs[i].getInnerIndices(), sizeof(indexT) * vecs[i].nonZeros());
+  }
 
   // run the user checks and calculate the compressed size
   calculateCompSize();
@@ -328,8 +308,12 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(const char *filename) {
   #endif
 
   // read the metadata and set the dimensions/nnz
-  metadata = new uint32_t[NUM_META_DATA];
-  fread(metadata, sizeof(uint32_t), NUM_META_DATA, fp);
+  metadata = new uint64_t[NUM_META_DATA];
+  if (!IVSparse::readMetadata(fp, metadata)) [[unlikely]] {
+    delete[] metadata;
+    fclose(fp);
+    throw std::runtime_error("Error: Could not read metadata");
+  }
   innerDim = metadata[1];
   outerDim = metadata[2];
   nnz = metadata[3];
@@ -375,7 +359,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(const char *filename) {
 template <typename T, typename indexT, bool columnMajor>
 template <typename T2, typename indexT2>
 SparseMatrix<T, indexT, 1, columnMajor>::SparseMatrix(
-std::vector<std::tuple<indexT2, indexT2, T2>> &entries, uint32_t num_rows, uint32_t num_cols, uint32_t nnz) {
+std::vector<std::tuple<indexT2, indexT2, T2>> &entries, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
   
   #ifdef IVSPARSE_DEBUG
   assert(entries.size() > 0 && "Entries array is empty");
@@ -408,7 +392,7 @@ std::vector<std::tuple<indexT2, indexT2, T2>> &entries, uint32_t num_rows, uint3
     std::cerr << "Allocation failed: " << e.what() << '\n';
   }
 
-  metadata = new uint32_t[NUM_META_DATA];
+  metadata = new uint64_t[NUM_META_DATA];
 
   metadata[0] = 1;
   metadata[1] = innerDim;
@@ -14,7 +14,7 @@ namespace IVSparse {
 
 // Gets the element stored at the given row and column
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 1, columnMajor>::coeff(uint32_t row, uint32_t col) {
+T SparseMatrix<T, indexT, 1, columnMajor>::coeff(uint64_t row, uint64_t col) {
   #ifdef IVSPARSE_DEBUG
     // check if the row and column are out of bounds
     assert((row < numRows && col < numCols) && "Row or Column out of bounds");
@@ -24,6 +24,33 @@ T SparseMatrix<T, indexT, 1, columnMajor>::coeff(uint32_t row, uint32_t col) {
   return (*this)(row, col);
 }
 
+// Gets the values at many (row, col) pairs
+template <typename T, typename indexT, bool columnMajor>
+void SparseMatrix<T, indexT, 1, columnMajor>::gather(const uint64_t* rows, const uint64_t* cols, T* out, size_t n) {
+  const uint64_t* outer = columnMajor ? cols : rows;
+  const uint64_t* inner = columnMajor ? rows : cols;
+
+  // inner indices are sorted so every query is a binary search
+  IVSparse::gatherGrouped<T>(outerDim, innerDim, outer, inner, out, n, true,
+    [](uint64_t, auto&&) {},
+    [this](uint64_t vec, uint64_t index) {
+      indexT* pos = std::lower_bound(innerIdx + outerPtr[vec], innerIdx + outerPtr[vec + 1], (indexT)index);
+      return (pos != innerIdx + outerPtr[vec + 1] && *pos == (indexT)index) ? vals[pos - innerIdx] : (T)0;
+    });
+}
+
+// Gets the values at many (row, col) pairs
+template <typename T, typename indexT, bool columnMajor>
+std::vector<T> SparseMatrix<T, indexT, 1, columnMajor>::gather(const std::vector<uint64_t>& rows, const std::vector<uint64_t>& cols) {
+  #ifdef IVSPARSE_DEBUG
+  assert(rows.size() == cols.size() && "Rows and columns must be the same length!");
+  #endif
+
+  std::vector<T> out(rows.size());
+  gather(rows.data(), cols.data(), out.data(), rows.size());
+  return out;
+}
+
 // Check for Column Major
 template <typename T, typename indexT, bool columnMajor>
 bool SparseMatrix<T, indexT, 1, columnMajor>::isColumnMajor() const {
@@ -32,7 +59,7 @@ bool SparseMatrix<T, indexT, 1, columnMajor>::isColumnMajor() const {
 
 // Get the values of the matrix
 template <typename T, typename indexT, bool columnMajor>
-T *SparseMatrix<T, indexT, 1, columnMajor>::getValues(uint32_t vec) const {
+T *SparseMatrix<T, indexT, 1, columnMajor>::getValues(uint64_t vec) const {
   #ifdef IVSPARSE_DEBUG
     // check if the vector is out of bounds
     assert((vec < outerDim && vec >= 0) && "Vector index out of bounds");
@@ -43,7 +70,7 @@ T *SparseMatrix<T, indexT, 1, columnMajor>::getValues(uint32_t vec) const {
 
 // Get the inner indices of the matrix
 template <typename T, typename indexT, bool columnMajor>
-indexT *SparseMatrix<T, indexT, 1, columnMajor>::getInnerIndices(uint32_t vec) const {
+indexT *SparseMatrix<T, indexT, 1, columnMajor>::getInnerIndices(uint64_t vec) const {
   #ifdef IVSPARSE_DEBUG
   // check if the vector is out of bounds
   assert((vec < outerDim && vec >= 0) && "Vector index out of bounds");
@@ -61,7 +88,7 @@ indexT *SparseMatrix<T, indexT, 1, columnMajor>::getOuterPointers() const {
 // Get a IVSparse vector from the matrix
 template <typename T, typename indexT, bool columnMajor>
 typename SparseMatrix<T, indexT, 1, columnMajor>::Vector
-SparseMatrix<T, indexT, 1, columnMajor>::getVector(uint32_t vec) {
+SparseMatrix<T, indexT, 1, columnMajor>::getVector(uint64_t vec) {
   #ifdef IVSPARSE_DEBUG
   // check if the vector is out of bounds
   assert((vec < outerDim && vec >= 0) && "Vector index out of bounds");
@@ -72,6 +99,13 @@ SparseMatrix<T, indexT, 1, columnMajor>::getVector(uint32_t vec) {
   return v;
 }
 
+// Get a view of a vector of the matrix
+template <typename T, typename indexT, bool columnMajor>
+typename SparseMatrix<T, indexT, 1, columnMajor>::VectorView
+SparseMatrix<T, indexT, 1, columnMajor>::getVectorView(uint64_t vec) {
+  return typename SparseMatrix<T, indexT, 1, columnMajor>::VectorView(*this, vec);
+}
+
 //* -------------------------- Utility Methods -------------------------- *//
 
 // write the matrix to file
@@ -86,7 +120,7 @@ void SparseMatrix<T, indexT, 1, columnMajor>::write(const char *filename) {
   #endif
 
   // write the metadata
-  fwrite(metadata, sizeof(uint32_t), NUM_META_DATA, fp);
+  IVSparse::writeMetadata(fp, metadata);
 
   // write the values
   fwrite(vals, sizeof(T), nnz, fp);
@@ -110,8 +144,8 @@ void SparseMatrix<T, indexT, 1, columnMajor>::print() {
   // if the matrix is less than 100 rows and columns print the whole thing
   if (numRows < 100 && numCols < 100) {
     // print the matrix
-    for (uint32_t i = 0; i < numRows; i++) {
-      for (uint32_t j = 0; j < numCols; j++) {
+    for (uint64_t i = 0; i < numRows; i++) {
+      for (uint64_t j = 0; j < numCols; j++) {
         std::cout << coeff(i, j) << " ";
       }
       std::cout << std::endl;
@@ -164,12 +198,11 @@ SparseMatrix<T, indexT, 1, columnMajor>::toEigen() {
     return eigenMat;
   }
 
-  // add the values to the matrix
-  for (uint32_t i = 0; i < outerDim; i++) {
-    for (indexT j = outerPtr[i]; j < outerPtr[i + 1]; j++) {
-      eigenMat.insert(innerIdx[j], i) = vals[j];
-    }
-  }
+  // the arrays are already laid out in the storage order of the Eigen matrix
+  eigenMat.resizeNonZeros(nnz);
+  std::copy(vals, vals + nnz, eigenMat.valuePtr());
+  std::copy(innerIdx, innerIdx + nnz, eigenMat.innerIndexPtr());
+  std::copy(outerPtr, outerPtr + outerDim + 1, eigenMat.outerIndexPtr());
 
   // return the matrix
   return eigenMat;
@@ -180,30 +213,33 @@ SparseMatrix<T, indexT, 1, columnMajor>::toEigen() {
 // Transposes the CSC Matrix and Returns it
 template <typename T, typename indexT, bool columnMajor>
 IVSparse::SparseMatrix<T, indexT, 1, columnMajor> SparseMatrix<T, indexT, 1, columnMajor>::transpose() {
-  // create an eigen matrix
-  Eigen::SparseMatrix<T> eigenMat = (*this).toEigen();
-
-  // transpose the matrix
-  eigenMat = eigenMat.transpose();
-
-  // create a new IVSparse matrix
-  IVSparse::SparseMatrix<T, indexT, 1, columnMajor> ivMat(eigenMat);
+  
+  // count the entries of each inner index, these become the new outer vectors
+  std::vector<indexT> newOuterPtr(innerDim + 1, 0);
+  for (uint64_t k = 0; k < nnz; k++) { newOuterPtr[innerIdx[k] + 1]++; }
+  for (uint64_t i = 0; i < innerDim; i++) { newOuterPtr[i + 1] += newOuterPtr[i]; }
+
+  // scatter the entries in outer order so the new inner indices stay sorted
+  std::vector<T> newVals(nnz);
+  std::vector<indexT> newInnerIdx(nnz);
+  std::vector<indexT> position(newOuterPtr.begin(), newOuterPtr.end() - 1);
+
+  for (uint64_t i = 0; i < outerDim; i++) {
+    for (indexT k = outerPtr[i]; k < outerPtr[i + 1]; k++) {
+      indexT dest = position[innerIdx[k]]++;
+      newVals[dest] = vals[k];
+      newInnerIdx[dest] = i;
+    }
+  }
 
-  // return the matrix
-  return ivMat;
+  // the storage order is kept, so rows and columns swap
+  return IVSparse::SparseMatrix<T, indexT, 1, columnMajor>(newVals.data(), newInnerIdx.data(), newOuterPtr.data(), numCols, numRows, nnz);
 }
 
 // In Place Transpose
 template <typename T, typename indexT, bool columnMajor>
 void SparseMatrix<T, indexT, 1, columnMajor>::inPlaceTranspose() {
-  // create an eigen matrix
-  Eigen::SparseMatrix<T> eigenMat = (*this).toEigen();
-
-  // transpose the matrix
-  eigenMat = eigenMat.transpose();
-
-  // set the matrix to the new matrix
-  *this = IVSparse::SparseMatrix<T, indexT, 1, columnMajor>(eigenMat);
+  *this = transpose();
 }
 
 // Appends a CSC vector onto a CSC matrix
@@ -212,11 +248,18 @@ void SparseMatrix<T, indexT, 1, columnMajor>::append(SparseMatrix<T, indexT, 1,
   
   // ensure the vector is the correct dimensions
   #ifdef IVSPARSE_DEBUG
-    assert((columnMajor && vec.size() == numRows) ||
-             (!columnMajor && vec.size() == numCols) &&
-                 "Vector is not the correct size!");
+    assert(vec.getLength() == innerDim && "Vector is not the correct size!");
   #endif
 
+  // grow the arrays geometrically so repeated appends are amortized
+  growData(outerDim + 1, nnz + vec.nonZeros());
+
+  // copy the values
+  if (vec.nonZeros() > 0) {
+    memcpy(vals + nnz, vec.getValues(), sizeof(T) * vec.nonZeros());
+    memcpy(innerIdx + nnz, vec.getInnerIndices(), sizeof(indexT) * vec.nonZeros());
+  }
+
   // update the dimensions and nnz
   if (columnMajor) {
     numCols++;
@@ -228,39 +271,32 @@ void SparseMatrix<T, indexT, 1, columnMajor>::append(SparseMatrix<T, indexT, 1,
   metadata[2] = outerDim;
   metadata[3] = nnz;
 
-  // realloc the arrays
+  // update the outer pointers
+  outerPtr[outerDim] = nnz;
+
+  // calculate the compressed size
+  calculateCompSize();
+}
+
+// Reserves room for n vectors along the outer dimension
+template <typename T, typename indexT, bool columnMajor>
+void SparseMatrix<T, indexT, 1, columnMajor>::reserveOuter(uint64_t n) {
+  if (n <= std::max(outerCapacity, outerDim)) { return; }
+
   try {
-    vals = (T *)realloc(vals, sizeof(T) * nnz);
-    innerIdx = (indexT *)realloc(innerIdx, sizeof(indexT) * nnz);
-    outerPtr = (indexT *)realloc(outerPtr, sizeof(indexT) * (outerDim + 1));
+    outerPtr = (indexT *)realloc(outerPtr, sizeof(indexT) * (n + 1));
   } catch (std::bad_alloc &ba) {
     std::cerr << "Error: " << ba.what() << std::endl;
     exit(1);
   }
 
-  // copy the values
-  memcpy(vals + (nnz - vec.nonZeros()), vec.getValues(),
-         sizeof(T) * vec.nonZeros());
-  memcpy(innerIdx + (nnz - vec.nonZeros()), vec.getInnerIndices(),
-         sizeof(indexT) * vec.nonZeros());
-
-  // update the outer pointers
-  outerPtr[outerDim] = nnz;
-
-  // check if the vector is empty
-  if (vec.nonZeros() == 0) {
-    outerPtr[outerDim - 1] = nnz;
-    return;
-  }
-
-  // calculate the compressed size
-  calculateCompSize();
+  outerCapacity = n;
 }
 
 // slice method that returns a vector of IVSparse vectors
 template <typename T, typename indexT, bool columnMajor>
 std::vector<typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector>
-SparseMatrix<T, indexT, 1, columnMajor>::slice(uint32_t start, uint32_t end) {
+SparseMatrix<T, indexT, 1, columnMajor>::slice(uint64_t start, uint64_t end) {
 
   // check if the start and end values are valid
   #ifdef IVSPARSE_DEBUG
@@ -272,7 +308,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::slice(uint32_t start, uint32_t end) {
   std::vector<typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector>vecs(end - start);
 
   // grab the vectors and add them to vecs
-  for (uint32_t i = start; i < end; ++i) {
+  for (uint64_t i = start; i < end; ++i) {
     // make a temp vector
     IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector temp(*this, i);
 
@@ -31,8 +31,8 @@ SparseMatrix<T, indexT, 1, columnMajor>::operator=(const IVSparse::SparseMatrix<
     }
 
     // Deep copy the matrix
-    metadata = new uint32_t[NUM_META_DATA];
-    memcpy(metadata, other.metadata, NUM_META_DATA * sizeof(uint32_t));
+    metadata = new uint64_t[NUM_META_DATA];
+    memcpy(metadata, other.metadata, NUM_META_DATA * sizeof(uint64_t));
 
     // set the dimensions of the matrix
     numRows = other.numRows;
@@ -41,6 +41,8 @@ SparseMatrix<T, indexT, 1, columnMajor>::operator=(const IVSparse::SparseMatrix<
     innerDim = other.innerDim;
     nnz = other.nnz;
     compSize = other.compSize;
+    outerCapacity = outerDim;
+    nnzCapacity = nnz;
 
     // encode the value type and index type
     encodeValueType();
@@ -110,7 +112,7 @@ bool SparseMatrix<T, indexT, 1, columnMajor>::operator!=(const SparseMatrix<T, i
 
 // Coefficent Access Operator
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 1, columnMajor>::operator()(uint32_t row, uint32_t col) {
+T SparseMatrix<T, indexT, 1, columnMajor>::operator()(uint64_t row, uint64_t col) {
   
   #ifdef IVSPARSE_DEBUG
   // check if the row and column are in bounds
@@ -121,8 +123,8 @@ T SparseMatrix<T, indexT, 1, columnMajor>::operator()(uint32_t row, uint32_t col
   #endif
 
   // get the vector and index
-  uint32_t vector = columnMajor ? col : row;
-  uint32_t index = columnMajor ? row : col;
+  uint64_t vector = columnMajor ? col : row;
+  uint64_t index = columnMajor ? row : col;
 
   // get an iterator for the desired vector
   for (typename SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator it(
@@ -141,7 +143,7 @@ T SparseMatrix<T, indexT, 1, columnMajor>::operator()(uint32_t row, uint32_t col
 // Vector Access Operator
 template <typename T, typename indexT, bool columnMajor>
 typename SparseMatrix<T, indexT, 1, columnMajor>::Vector
-SparseMatrix<T, indexT, 1, columnMajor>::operator[](uint32_t vec) {
+SparseMatrix<T, indexT, 1, columnMajor>::operator[](uint64_t vec) {
   #ifdef IVSPARSE_DEBUG
   // check if the vector is out of bounds
   assert((vec < outerDim && vec >= 0) && "Vector index out of bounds");
@@ -176,13 +178,15 @@ Eigen::VectorXd SparseMatrix<T, indexT, 1, columnMajor>::operator*(SparseMatrix<
 
 // Matrix Vector Multiplication (IVSparse Eigen -> Eigen)
 template <typename T, typename indexT, bool columnMajor>
-Eigen::VectorXd SparseMatrix<T, indexT, 1, columnMajor>::operator*(Eigen::VectorXd &vec) {
+template <typename accumT>
+Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 1, columnMajor>::operator*(Eigen::Matrix<accumT, -1, 1> &vec) {
   return vectorMultiply(vec);
 }
 
 // Matrix Matrix Multiplication (IVSparse Eigen -> Eigen)
 template <typename T, typename indexT, bool columnMajor>
-Eigen::Matrix<T, -1, -1> SparseMatrix<T, indexT, 1, columnMajor>::operator*(Eigen::Matrix<T, -1, -1> mat) {
+template <typename accumT>
+Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 1, columnMajor>::operator*(Eigen::Matrix<accumT, -1, -1> mat) {
   return matrixMultiply(mat);
 }
 
@@ -79,6 +79,9 @@ void SparseMatrix<T, indexT, 1, columnMajor>::userChecks() {
           outerDim < std::numeric_limits<indexT>::max()) &&
          "The number of rows and columns must be less than the maximum value "
          "of the index type");
+  assert(nnz <= std::numeric_limits<indexT>::max() &&
+         "The outer pointers are stored in the index type, so the number of "
+         "non-zeros must fit in it");
   checkValueType();
 }
 
@@ -97,4 +100,167 @@ void SparseMatrix<T, indexT, 1, columnMajor>::calculateCompSize() {
   compSize += sizeof(indexT) * (outerDim + 1);  // outerPtr
 }
 
+// Grows the arrays geometrically to fit the given sizes
+template <typename T, typename indexT, bool columnMajor>
+void SparseMatrix<T, indexT, 1, columnMajor>::growData(uint64_t newOuterDim, uint64_t newNnz) {
+  try {
+    // the arrays are at least as large as the current sizes even if no capacity was set
+    if (newOuterDim > std::max(outerCapacity, outerDim)) {
+      uint64_t capacity = std::max<uint64_t>(newOuterDim, 2 * (uint64_t)std::max(outerCapacity, outerDim));
+      outerCapacity = std::min<uint64_t>(capacity, UINT32_MAX);
+      outerPtr = (indexT *)realloc(outerPtr, sizeof(indexT) * (outerCapacity + 1));
+    }
+
+    if (newNnz > std::max(nnzCapacity, nnz)) {
+      uint64_t capacity = std::max<uint64_t>(newNnz, 2 * (uint64_t)std::max(nnzCapacity, nnz));
+      nnzCapacity = std::min<uint64_t>(capacity, UINT32_MAX);
+      vals = (T *)realloc(vals, sizeof(T) * nnzCapacity);
+      innerIdx = (indexT *)realloc(innerIdx, sizeof(indexT) * nnzCapacity);
+    }
+  } catch (std::bad_alloc &ba) {
+    std::cerr << "Error: " << ba.what() << std::endl;
+    exit(1);
+  }
+}
+
+    // Copies an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, 1, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            // set the dimensions and nnz
+            innerDim = mat.innerSize();
+            outerDim = mat.outerSize();
+            numRows = mat.rows();
+            numCols = mat.cols();
+            nnz = mat.nonZeros();
+
+            encodeValueType();
+            index_t = sizeof(indexT);
+
+            // allocate the memory
+            try {
+                vals = (T*)malloc(nnz * sizeof(T));
+                innerIdx = (indexT*)malloc(nnz * sizeof(indexT));
+                outerPtr = (indexT*)malloc((outerDim + 1) * sizeof(indexT));
+            } catch (std::bad_alloc& e) {
+                std::cerr << "Allocation failed: " << e.what() << '\n';
+            }
+
+            // set the metadata
+            metadata = new uint64_t[NUM_META_DATA];
+            metadata[0] = 1;
+            metadata[1] = innerDim;
+            metadata[2] = outerDim;
+            metadata[3] = nnz;
+            metadata[4] = val_t;
+            metadata[5] = index_t;
+
+            // copy the data, the indices are cast since Eigen stores them as int
+            if (mat.isCompressed()) {
+                memcpy(vals, mat.valuePtr(), sizeof(T) * nnz);
+                std::copy(mat.innerIndexPtr(), mat.innerIndexPtr() + nnz, innerIdx);
+                std::copy(mat.outerIndexPtr(), mat.outerIndexPtr() + outerDim + 1, outerPtr);
+            }
+            else {
+                // an uncompressed matrix has gaps between its vectors, so they are closed up one by one
+                outerPtr[0] = 0;
+                for (uint64_t i = 0; i < outerDim; i++) { outerPtr[i + 1] = outerPtr[i] + mat.innerNonZeroPtr()[i]; }
+
+                #ifdef IVSPARSE_HAS_OPENMP
+                #pragma omp parallel for schedule(dynamic, 64)
+                #endif
+                for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                    const typename Eigen::SparseMatrix<T, storageOrder>::StorageIndex* begin = mat.innerIndexPtr() + mat.outerIndexPtr()[i];
+                    memcpy(vals + outerPtr[i], mat.valuePtr() + mat.outerIndexPtr()[i], sizeof(T) * mat.innerNonZeroPtr()[i]);
+                    std::copy(begin, begin + mat.innerNonZeroPtr()[i], innerIdx + outerPtr[i]);
+                }
+            }
+
+            // calculate the compressed size and run the user checks
+            calculateCompSize();
+
+            // run the user checks
+            #ifdef IVSPARSE_DEBUG
+            userChecks();
+            #endif
+        }
+    }
+
+    // Copies the entries of a dense Eigen matrix with a magnitude above epsilon, counting each vector first
+    template <typename T, typename indexT, bool columnMajor>
+    template <int options>
+    void SparseMatrix<T, indexT, 1, columnMajor>::compressDense(Eigen::Matrix<T, -1, -1, options>& mat, T epsilon) {
+
+        numRows = mat.rows();
+        numCols = mat.cols();
+        outerDim = columnMajor ? numCols : numRows;
+        innerDim = columnMajor ? numRows : numCols;
+
+        encodeValueType();
+        index_t = sizeof(indexT);
+
+        // the stride between entries of a vector and between vectors in the dense data
+        const bool rowMajorData = options & Eigen::RowMajor;
+        const uint64_t innerStride = (rowMajorData == columnMajor) ? outerDim : 1;
+        const uint64_t outerStride = (rowMajorData == columnMajor) ? 1 : innerDim;
+
+        const IVSparse::ZeroScanner<T> scanner(epsilon);
+
+        // count the non-zeros of each vector and prefix sum them into the outer pointers
+        outerPtr = (indexT*)calloc(outerDim + 1, sizeof(indexT));
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 16)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            indexT count = 0;
+            scanner.scan(mat.data() + i * outerStride, innerDim, innerStride, [&](uint64_t, T) { count++; });
+            outerPtr[i + 1] = count;
+        }
+
+        for (uint64_t i = 0; i < outerDim; i++) { outerPtr[i + 1] += outerPtr[i]; }
+        nnz = outerPtr[outerDim];
+
+        try {
+            vals = (T*)malloc(nnz * sizeof(T));
+            innerIdx = (indexT*)malloc(nnz * sizeof(indexT));
+        } catch (std::bad_alloc& e) {
+            std::cerr << "Allocation failed: " << e.what() << '\n';
+        }
+
+        // copy the entries of each vector into its slot
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 16)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            uint64_t k = outerPtr[i];
+            scanner.scan(mat.data() + i * outerStride, innerDim, innerStride, [&](uint64_t index, T value) {
+                vals[k] = value;
+                innerIdx[k] = index;
+                k++;
+            });
+        }
+
+        metadata = new uint64_t[NUM_META_DATA];
+        metadata[0] = 1;
+        metadata[1] = innerDim;
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+        metadata[4] = val_t;
+        metadata[5] = index_t;
+
+        calculateCompSize();
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+    }
+
 }  // namespace IVSparse
\ No newline at end of file
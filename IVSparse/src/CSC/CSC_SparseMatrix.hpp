@@ -28,6 +28,9 @@ namespace IVSparse {
         indexT* innerIdx = nullptr;  // The inner indices of the matrix
         indexT* outerPtr = nullptr;  // The outer pointers of the matrix
 
+        uint64_t outerCapacity = 0;  // The number of vectors outerPtr has room for
+        uint64_t nnzCapacity = 0;    // The number of values vals and innerIdx have room for
+
         //* Private Methods *//
 
         // Encodes the value type of the matrix in a uint32_t
@@ -42,13 +45,24 @@ namespace IVSparse {
         // Calculates the current byte size of the matrix in memory
         void calculateCompSize();
 
-        uint32_t innerDim = 0;  // The inner dimension of the matrix
-        uint32_t outerDim = 0;  // The outer dimension of the matrix
+        // Grows the arrays geometrically to fit the given sizes
+        void growData(uint64_t newOuterDim, uint64_t newNnz);
+
+        // Copies an Eigen matrix, converting it to the storage order of the matrix first if needed
+        template <int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat);
+
+        // Copies the entries of a dense Eigen matrix with a magnitude above epsilon
+        template <int options>
+        void compressDense(Eigen::Matrix<T, -1, -1, options>& mat, T epsilon);
 
-        uint32_t numRows = 0;  // The number of rows in the matrix
-        uint32_t numCols = 0;  // The number of columns in the matrix
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
 
-        uint32_t nnz = 0;  // The number of non-zero values in the matrix
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
 
         size_t compSize = 0;  // The size of the compressed matrix in bytes
 
@@ -57,7 +71,7 @@ namespace IVSparse {
         uint32_t val_t;  // Information about the value type (size, signededness, etc.)
         uint32_t index_t;  // Information about the index type (size)
 
-        uint32_t* metadata = nullptr;  // The metadata of the matrix
+        uint64_t* metadata = nullptr;  // The metadata of the matrix
 
         //* Private Methods *//
 
@@ -71,32 +85,49 @@ namespace IVSparse {
         // In Place Scalar Multiplication
         inline void inPlaceScalarMultiply(T scalar);
 
-        // Matrix Vector Multiplication
-        inline Eigen::VectorXd vectorMultiply(Eigen::VectorXd& vec);
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
 
         // Matrix Vector Multiplication 2 (with IVSparse Vector)
-        inline Eigen::VectorXd vectorMultiply(
+        template <typename accumT = double>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(
             typename SparseMatrix<T, indexT, 1, columnMajor>::Vector& vec);
 
-        // Matrix Matrix Multiplication
-        inline Eigen::Matrix<T, -1, -1> matrixMultiply(Eigen::Matrix<T, -1, -1>& mat);
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // Statistics of each vector along the outer dimension
+        inline IVSparse::SummaryStats outerStats();
+
+        // Statistics of each vector along the inner dimension
+        inline IVSparse::SummaryStats innerStats();
+
+        // Minimum or maximum of each vector along the outer dimension
+        template <bool isMax>
+        inline std::vector<T> outerExtremes(std::vector<uint64_t>* indices);
+
+        // Minimum or maximum of each vector along the inner dimension
+        template <bool isMax>
+        inline std::vector<T> innerExtremes(std::vector<uint64_t>* indices);
 
         public:
 
         // Gets the number of rows in the matrix
-        uint32_t rows() const { return numRows; }
+        uint64_t rows() const { return numRows; }
 
         // Gets the number of columns in the matrix
-        uint32_t cols() const { return numCols; }
+        uint64_t cols() const { return numCols; }
 
         // Gets the inner dimension of the matrix
-        uint32_t innerSize() const { return innerDim; }
+        uint64_t innerSize() const { return innerDim; }
 
         // Gets the outer dimension of the matrix
-        uint32_t outerSize() const { return outerDim; }
+        uint64_t outerSize() const { return outerDim; }
 
         // Gets the number of non-zero elements in the matrix
-        uint32_t nonZeros() const { return nnz; }
+        uint64_t nonZeros() const { return nnz; }
 
         // Gets the number of bytes needed to store the matrix
         size_t byteSize() const { return compSize; }
@@ -106,6 +137,9 @@ namespace IVSparse {
         // Vector Class for CSC Sparse Matrices
         class Vector;
 
+        // Non-owning Vector View Class for CSC Sparse Matrices
+        class VectorView;
+
         // Iterator Class for CSC Sparse Matrices
         class InnerIterator;
 
@@ -130,9 +164,10 @@ namespace IVSparse {
          *
          * Eigen Sparse Matrix Constructor \n \n
          * This constructor takes an Eigen Sparse Matrix and compresses it into a
-         * IVSparse matrix.
+         * IVSparse matrix. The Eigen matrix is not modified, it may be in compressed
+         * or uncompressed mode.
          */
-        SparseMatrix(Eigen::SparseMatrix<T>& mat);
+        SparseMatrix(const Eigen::SparseMatrix<T>& mat);
 
         /**
          * @param mat The Eigen Sparse Matrix to be compressed
@@ -140,7 +175,27 @@ namespace IVSparse {
          * Eigen Sparse Matrix Constructor (Row Major) \n \n
          * Same as previous constructor but for Row Major Eigen Sparse Matrices.
          */
-        SparseMatrix(Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+        SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+
+        /**
+         * @param mat The Eigen Dense Matrix to be compressed
+         * @param epsilon Entries with a magnitude of at most epsilon are dropped
+         *
+         * Eigen Dense Matrix Constructor \n \n
+         * This constructor compresses a dense Eigen Matrix directly, without going
+         * through sparseView() and an intermediate Eigen Sparse Matrix. Each vector
+         * is scanned for non-zeros in parallel and copied on its own.
+         */
+        SparseMatrix(Eigen::Matrix<T, -1, -1>& mat, T epsilon = 0);
+
+        /**
+         * @param mat The Eigen Dense Matrix to be compressed
+         * @param epsilon Entries with a magnitude of at most epsilon are dropped
+         *
+         * Eigen Dense Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Dense Matrices.
+         */
+        SparseMatrix(Eigen::Matrix<T, -1, -1, Eigen::RowMajor>& mat, T epsilon = 0);
 
         /**
          * @tparam compressionLevel2 The compression level of the IVSparse matrix to
@@ -173,7 +228,7 @@ namespace IVSparse {
          */
         template <typename T2, typename indexT2>
         SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr,
-                     uint32_t num_rows, uint32_t num_cols, uint32_t nnz);
+                     uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
 
         /**
          * COO Tuples Constructor \n \n
@@ -185,7 +240,7 @@ namespace IVSparse {
          */
         template <typename T2, typename indexT2>
         SparseMatrix(std::vector<std::tuple<indexT2, indexT2, T2>>& entries,
-                     uint32_t num_rows, uint32_t num_cols, uint32_t nnz);
+                     uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
 
         /**
          * @param vec The vector to construct the matrix from
@@ -237,7 +292,26 @@ namespace IVSparse {
           *
           * @note Users cannot update individual values in a IVSparse matrix.
           */
-        T coeff(uint32_t row, uint32_t col);
+        T coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @param rows The row of each query
+         * @param cols The column of each query
+         * @param out Filled with the value of each query in query order
+         * @param n The number of queries
+         *
+         * Gets many coefficients at once. \n \n
+         * Queries are grouped by vector so each touched vector is only decoded
+         * once, and the vectors are worked on in parallel.
+         */
+        void gather(const uint64_t* rows, const uint64_t* cols, T* out, size_t n);
+
+        /**
+         * @returns The value at each (rows[i], cols[i]) pair in query order.
+         *
+         * Same as the pointer version of gather().
+         */
+        std::vector<T> gather(const std::vector<uint64_t>& rows, const std::vector<uint64_t>& cols);
 
         /**
          * @returns true If the matrix is stored in column major format
@@ -250,12 +324,12 @@ namespace IVSparse {
         /**
          * @returns A pointer to the array of values in the matrix
          */
-        T* getValues(uint32_t vec) const;
+        T* getValues(uint64_t vec) const;
 
         /**
          * @returns A pointer to the array of inner indices in the matrix
          */
-        indexT* getInnerIndices(uint32_t vec) const;
+        indexT* getInnerIndices(uint64_t vec) const;
 
         /**
          * @returns A pointer to the array of outer pointers in the matrix
@@ -272,7 +346,19 @@ namespace IVSparse {
          * @note Can only get vectors in the storage order of the matrix.
          */
         typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector getVector(
-            uint32_t vec);
+            uint64_t vec);
+
+        /**
+         * @param vec The vector to view
+         * @returns VectorView A view of the vector
+         *
+         * Get a view of a vector of the IVSparse matrix that reads the matrix in
+         * place instead of copying it like getVector().
+         *
+         * @note Can only get vectors in the storage order of the matrix.
+         * @warning The view is only valid while the matrix is alive and unchanged.
+         */
+        typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::VectorView getVectorView(uint64_t vec);
 
         ///@}
 
@@ -283,35 +369,82 @@ namespace IVSparse {
          ///@{
 
          /**
+          * @tparam accumT The type the sums are accumulated in and returned as
           * @returns A vector of the sum of each vector along the outer dimension.
+          *
+          * @note Small integer matrices can sum into a wider type without being
+          * converted, e.g. outerSum<uint64_t>() or outerSum<double>().
           */
-        inline std::vector<T> outerSum();
+        template <typename accumT = T>
+        inline std::vector<accumT> outerSum();
 
         /**
+         * @tparam accumT The type the sums are accumulated in and returned as
          * @returns A vector of the sum of each vector along the inner dimension.
          */
-        inline std::vector<T> innerSum();
+        template <typename accumT = T>
+        inline std::vector<accumT> innerSum();
 
         /**
          * @returns A vector of the maximum value in each column.
+         *
+         * @note Columns that are not full also count their implicit zeros.
          */
         inline std::vector<T> maxColCoeff();
 
+        /**
+         * @param indices Filled with the row of the maximum of each column.
+         * @returns A vector of the maximum value in each column.
+         *
+         * @note Ties go to the smallest row.
+         */
+        inline std::vector<T> maxColCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the maximum value in each row.
+         *
+         * @note Rows that are not full also count their implicit zeros.
          */
         inline std::vector<T> maxRowCoeff();
 
+        /**
+         * @param indices Filled with the column of the maximum of each row.
+         * @returns A vector of the maximum value in each row.
+         *
+         * @note Ties go to the smallest column.
+         */
+        inline std::vector<T> maxRowCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the minimum value in each column.
+         *
+         * @note Columns that are not full also count their implicit zeros.
          */
         inline std::vector<T> minColCoeff();
 
+        /**
+         * @param indices Filled with the row of the minimum of each column.
+         * @returns A vector of the minimum value in each column.
+         *
+         * @note Ties go to the smallest row.
+         */
+        inline std::vector<T> minColCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the minimum value in each row.
+         *
+         * @note Rows that are not full also count their implicit zeros.
          */
         inline std::vector<T> minRowCoeff();
 
+        /**
+         * @param indices Filled with the column of the minimum of each row.
+         * @returns A vector of the minimum value in each row.
+         *
+         * @note Ties go to the smallest column.
+         */
+        inline std::vector<T> minRowCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns The trace of the matrix.
          *
@@ -320,19 +453,65 @@ namespace IVSparse {
         inline T trace();
 
         /**
+         * @tparam accumT The type the sum is accumulated in and returned as
          * @returns The sum of all the values in the matrix.
          */
-        inline T sum();
+        template <typename accumT = T>
+        inline accumT sum();
 
         /**
+         * @tparam accumT The type the squares are accumulated in and returned as
          * @returns The frobenius norm of the matrix.
          */
-        inline double norm();
+        template <typename accumT = double>
+        inline accumT norm();
 
         /**
+         * @tparam accumT The type the squares are accumulated in and returned as
          * @returns Returns the length of the specified vector.
          */
-        inline double vectorLength(uint32_t vec);
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        /**
+         * @returns The number of non-zeros, sum, sum of squares, mean, variance
+         * and dispersion of each column.
+         *
+         * All of the statistics are gathered in a single parallel pass. The mean,
+         * variance and dispersion count the implicit zeros of each column.
+         */
+        inline IVSparse::SummaryStats columnStats();
+
+        /**
+         * @returns The same statistics as columnStats() but for each row.
+         */
+        inline IVSparse::SummaryStats rowStats();
+
+        /**
+         * @returns The (value, count) pairs of the given vector in ascending
+         * order of value.
+         *
+         * @note CSC does not group values so each call sorts a copy of the vector.
+         */
+        inline std::vector<std::pair<T, uint64_t>> valueHistogram(uint64_t vec);
+
+        /**
+         * @returns The number of distinct non-zero values in the matrix.
+         */
+        inline uint64_t uniqueValueCount();
+
+        /**
+         * @returns The average value redundancy of the non-empty vectors, where
+         * the redundancy of a vector is 1 - unique values / non-zeros, or 1 for
+         * a vector holding a single value.
+         */
+        inline double redundancy();
+
+        /**
+         * @returns The Shannon entropy in bits of the non-zero values of the
+         * matrix.
+         */
+        inline double entropy();
 
         ///@}
 
@@ -350,6 +529,8 @@ namespace IVSparse {
           * Currently .ivs is the perfered file extension.
           *
           * @note Useful to split a matrix up and then write each part separately.
+          * @note The header stores the dimensions and nnz as 64-bit integers, files
+          * written with the older 32-bit header can still be read.
           */
         void write(const char* filename);
 
@@ -403,13 +584,23 @@ namespace IVSparse {
          */
         void append(typename SparseMatrix<T, indexT, 1, columnMajor>::Vector& vec);
 
+        /**
+         * @param n The number of vectors to make room for.
+         *
+         * Reserves room for n vectors along the outer dimension so later appends
+         * do not have to grow the outer pointers. \n \n
+         * Appends grow the matrix geometrically on their own, this only avoids
+         * the intermediate reallocations when the final size is known.
+         */
+        void reserveOuter(uint64_t n);
+
         /**
          * @returns A vector of IVSparse vectors that represent a slice of the
          * IVSparse matrix.
          */
         std::vector<
             typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector>
-            slice(uint32_t start, uint32_t end);
+            slice(uint64_t start, uint64_t end);
 
         ///@}
 
@@ -426,11 +617,11 @@ namespace IVSparse {
         bool operator!=(const SparseMatrix<T, indexT, 1, columnMajor>& other);
 
         // Coefficient Access Operator
-        T operator()(uint32_t row, uint32_t col);
+        T operator()(uint64_t row, uint64_t col);
 
         // Vector Access Operator
         typename IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector operator[](
-            uint32_t vec);
+            uint64_t vec);
 
         // Scalar Multiplication
         IVSparse::SparseMatrix<T, indexT, 1, columnMajor> operator*(T scalar);
@@ -438,15 +629,17 @@ namespace IVSparse {
         // In Place Scalar Multiplication
         void operator*=(T scalar);
 
-        // Matrix Vector Multiplication
-        Eigen::VectorXd operator*(Eigen::VectorXd& vec);
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
 
         // Matrix Vector Multiplication 2 (with IVSparse Vector)
         Eigen::VectorXd operator*(
             typename SparseMatrix<T, indexT, 1, columnMajor>::Vector& vec);
 
-        // Matrix Matrix Multiplication
-        Eigen::Matrix<T, -1, -1> operator*(Eigen::Matrix<T, -1, -1> mat);
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1> mat);
     };
 
 }  // namespace IVSparse
\ No newline at end of file
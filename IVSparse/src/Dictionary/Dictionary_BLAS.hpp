@@ -0,0 +1,231 @@
+/**
+ * @file Dictionary_BLAS.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief BLAS Routines and Other Matrix Calculations for Dictionary Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* BLAS Level 1 Routines *//
+
+    // Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SparseMatrix<T, indexT, 5, columnMajor> SparseMatrix<T, indexT, 5, columnMajor>::scalarMultiply(T scalar) {
+        // Deep copy the matrix
+        IVSparse::SparseMatrix<T, indexT, 5, columnMajor> newMatrix(*this);
+
+        newMatrix.inPlaceScalarMultiply(scalar);
+        return newMatrix;
+    }
+
+    // In Place Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::inPlaceScalarMultiply(T scalar) {
+        // every stored value is a dictionary entry so the vectors are untouched
+        for (uint32_t k = 0; k < dictSize; k++) {
+            dictionary[k] *= scalar;
+        }
+    }
+
+    //* BLAS Level 2 Routines *//
+
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 5, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the vector is the correct size
+        assert((uint64_t)vec.rows() == numCols &&
+               "The vector must be the same size as the number of columns in the "
+               "matrix!");
+        #endif
+
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        if constexpr (columnMajor) {
+            // scatter each run scaled by its value and the vector entry, each value is only scaled once
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                if (vec(i) == 0) return;
+
+                forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t width) {
+                    const accumT scaled = static_cast<accumT>(value) * vec(i);
+                    return decodeRun(indices, width, [&](uint64_t index) { buffer[index] += scaled; });
+                });
+            });
+        }
+        else {
+            // each row is an independent dot product, the values are factored out of their runs
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0;
+
+                forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t width) {
+                    accumT runSum = 0;
+                    uint8_t* end = decodeRun(indices, width, [&](uint64_t index) { runSum += vec(index); });
+                    rowSum += static_cast<accumT>(value) * runSum;
+                    return end;
+                });
+                eigenTemp(i) = rowSum;
+            }
+        }
+        return eigenTemp;
+    }
+
+    //* BLAS Level 3 Routines *//
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 5, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and scatters the whole matrix into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+                Eigen::Matrix<accumT, -1, 1> scaled(length);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t indexWidth) {
+                        scaled = matTranspose.col(i).segment(start, length) * static_cast<accumT>(value);
+                        return decodeRun(indices, indexWidth, [&](uint64_t index) {
+                            newMatrix.col(index).segment(start, length) += scaled;
+                        });
+                    });
+                }
+            }
+        }
+        else {
+            // each row of the result only reads the rows of mat it touches, values are applied once per run
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                Eigen::Matrix<accumT, -1, 1> runSum(width);
+
+                forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t indexWidth) {
+                    runSum.setZero();
+                    uint8_t* end = decodeRun(indices, indexWidth, [&](uint64_t index) { runSum += matTranspose.col(index); });
+                    newMatrix.col(i) += runSum * static_cast<accumT>(value);
+                    return end;
+                });
+            }
+        }
+        return newMatrix.transpose();
+    }
+
+    //* Other Matrix Calculations *//
+
+    // Finds the Outer Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 5, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t width) {
+                uint64_t count = 0;
+                uint8_t* end = decodeRun(indices, width, [&](uint64_t) { count++; });
+                outerSum[i] += static_cast<accumT>(value) * count;
+                return end;
+            });
+        }
+        return outerSum;
+    }
+
+    // Finds the Inner Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 5, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
+
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t width) {
+                const accumT runValue = static_cast<accumT>(value);
+                return decodeRun(indices, width, [&](uint64_t index) { buffer[index] += runValue; });
+            });
+        });
+        return innerSum;
+    }
+
+    // Finds the sum of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 5, columnMajor>::sum() {
+        std::vector<accumT> outerSum = this->outerSum<accumT>();
+
+        accumT sum = 0;
+        for (uint64_t i = 0; i < outerDim; i++) {
+            sum += outerSum[i];
+        }
+        return sum;
+    }
+
+    // Calculates the norm of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 5, columnMajor>::norm() {
+        accumT norm = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for reduction(+ : norm)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachRun(i, [&](const T& value, uint8_t* indices, uint8_t width) {
+                uint64_t count = 0;
+                uint8_t* end = decodeRun(indices, width, [&](uint64_t) { count++; });
+                norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count;
+                return end;
+            });
+        }
+        return sqrt(norm);
+    }
+
+    // Finds the length of a certain vector
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 5, columnMajor>::vectorLength(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        accumT norm = 0;
+        forEachRun(vec, [&](const T& value, uint8_t* indices, uint8_t width) {
+            uint64_t count = 0;
+            uint8_t* end = decodeRun(indices, width, [&](uint64_t) { count++; });
+            norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count;
+            return end;
+        });
+        return sqrt(norm);
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,85 @@
+/**
+ * @file Dictionary_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Methods for Dictionary Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Getters *//
+
+    // Gets the element stored at the given row and column
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 5, columnMajor>::coeff(uint64_t row, uint64_t col) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(row < numRows && col < numCols && "Invalid row and column!");
+        #endif
+
+        uint64_t vec = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        // every run has to be checked as the runs are grouped by value
+        T result = 0;
+        forEachEntry(vec, [&](uint64_t i, T value) { if (i == index) result = value; });
+        return result;
+    }
+
+    // Check for Column Major
+    template <typename T, typename indexT, bool columnMajor>
+    bool SparseMatrix<T, indexT, 5, columnMajor>::isColumnMajor() const {
+        return columnMajor;
+    }
+
+    // Gets the number of bytes of an encoded vector
+    template <typename T, typename indexT, bool columnMajor>
+    size_t SparseMatrix<T, indexT, 5, columnMajor>::getVectorSize(uint64_t vec) const {
+        return (uint8_t*)endPointers[vec] - (uint8_t*)data[vec];
+    }
+
+    // Visits every non-zero of a vector, each run looks its value up once
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::forEachEntry(uint64_t vec, Visit visit) {
+        forEachRun(vec, [&](const T& value, uint8_t* indices, uint8_t width) {
+            return decodeRun(indices, width, [&](uint64_t index) { visit(index, value); });
+        });
+    }
+
+    //* Utility Methods *//
+
+    // Prints the matrix dense to console
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::print() {
+        print(std::cout);
+    }
+
+    // Converts the matrix to an Eigen sparse matrix
+    template <typename T, typename indexT, bool columnMajor>
+    Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> SparseMatrix<T, indexT, 5, columnMajor>::toEigen() {
+
+        #ifdef IVSPARSE_DEBUG
+        // assert that the matrix is not empty
+        assert(outerDim > 0 && "Cannot convert an empty matrix to an Eigen matrix!");
+        #endif
+
+        // the runs are grouped by value so go through triplets
+        std::vector<Eigen::Triplet<T>> triplets;
+        triplets.reserve(nnz);
+        for (uint64_t i = 0; i < outerDim; i++) {
+            forEachEntry(i, [&](uint64_t index, T value) {
+                if constexpr (columnMajor) { triplets.emplace_back(index, i, value); }
+                else { triplets.emplace_back(i, index, value); }
+            });
+        }
+
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
+        eigenMatrix.setFromTriplets(triplets.begin(), triplets.end());
+        return eigenMatrix;
+    }
+
+}  // namespace IVSparse
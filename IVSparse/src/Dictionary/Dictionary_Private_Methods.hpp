@@ -0,0 +1,310 @@
+/**
+ * @file Dictionary_Private_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Private Methods for Dictionary Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Calculates the number of bytes needed to store a delta, rounded up to 1, 2, 4 or 8
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint8_t SparseMatrix<T, indexT, 5, columnMajor>::byteWidth(size_t size) {
+        if (size <= 0xFF) return 1;
+        if (size <= 0xFFFF) return 2;
+        if (size <= 0xFFFFFFFF) return 4;
+        return 8;
+    }
+
+    // Calls visit(index) for the indices of a run of the given width, returns the end of the run
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline uint8_t* SparseMatrix<T, indexT, 5, columnMajor>::decodeRun(uint8_t* indices, uint8_t width, Visit visit) {
+        // the first index may be 0 so the delimiter search starts at the second
+        auto decode = [&](auto* deltas) {
+            uint64_t current = *deltas;
+            visit(current);
+            for (deltas++; *deltas != DELIM; deltas++) {
+                current += *deltas;
+                visit(current);
+            }
+            return (uint8_t*)(deltas + 1);
+        };
+
+        switch (width) {
+        case 1:
+            return decode((uint8_t*)indices);
+        case 2:
+            return decode((uint16_t*)indices);
+        case 4:
+            return decode((uint32_t*)indices);
+        default:
+            return decode((uint64_t*)indices);
+        }
+    }
+
+    // Calls visit(value, indices, width) for each run of a vector with codes of type codeT
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename codeT, typename Visit>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::decodeRuns(uint64_t vec, Visit visit) {
+        uint8_t* run = (uint8_t*)data[vec];
+        uint8_t* end = (uint8_t*)endPointers[vec];
+
+        while (run < end) {
+            const T& value = dictionary[*(codeT*)run];
+            uint8_t width = *(run + sizeof(codeT));
+            run = visit(value, run + sizeof(codeT) + 1, width);
+        }
+    }
+
+    // Calls visit(value, indices, width) for each run of a vector, the code width is only checked once
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::forEachRun(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        switch (codeWidth) {
+        case 1:
+            decodeRuns<uint8_t>(vec, visit);
+            break;
+        case 2:
+            decodeRuns<uint16_t>(vec, visit);
+            break;
+        default:
+            decodeRuns<uint32_t>(vec, visit);
+            break;
+        }
+    }
+
+    // Allocates the per vector pointers, every vector starts empty
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::allocateOuter() {
+        try {
+            data = (void**)calloc(outerDim, sizeof(void*));
+            endPointers = (void**)calloc(outerDim, sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Frees the dictionary, every vector and the per vector pointers
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::freeData() {
+        if (data != nullptr) {
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (data[i] != nullptr) { free(data[i]); }
+            }
+        }
+
+        free(dictionary);
+        free(data);
+        free(endPointers);
+
+        dictionary = nullptr;
+        data = nullptr;
+        endPointers = nullptr;
+    }
+
+    // performs some simple user checks on the matrices metadata
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::userChecks() {
+        assert((innerDim > 1 || outerDim > 1 || nnz > 1) &&
+               "The matrix must have at least one row, column, and nonzero value");
+        assert(std::is_floating_point<indexT>::value == false &&
+               "The index type must be a non-floating point type");
+        assert((std::is_arithmetic<T>::value && std::is_arithmetic<indexT>::value) &&
+               "The value and index types must be numeric types");
+        assert((std::is_same<indexT, bool>::value == false) &&
+               "The index type must not be bool");
+        assert((innerDim < std::numeric_limits<indexT>::max() &&
+                outerDim < std::numeric_limits<indexT>::max()) &&
+               "The number of rows and columns must be less than the maximum value "
+               "of the index type");
+    }
+
+    // Calculates the current byte size of the matrix, the dictionary and the encoded vectors
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::calculateCompSize() {
+        compSize = sizeof(T) * dictSize;
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            compSize += getVectorSize(i);
+        }
+    }
+
+    // Compression Algorithm for going from CSC to Dictionary
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename T2, typename indexT2>
+    void SparseMatrix<T, indexT, 5, columnMajor>::compressCSC(const T2* vals, const indexT2* innerIndices,
+                                                                const indexT2* outerPointers, const indexT2* innerNonZeros) {
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+
+        // the end of a vector, an uncompressed Eigen matrix has gaps between its vectors
+        auto vectorEnd = [&](uint64_t i) -> uint64_t {
+            return innerNonZeros == nullptr ? outerPointers[i + 1] : outerPointers[i] + innerNonZeros[i];
+        };
+
+        // the dictionary is every unique value of the matrix in ascending order
+        std::vector<T> unique;
+        unique.reserve(nnz);
+        for (uint64_t i = 0; i < outerDim; i++) {
+            for (uint64_t j = outerPointers[i]; j < vectorEnd(i); j++) {
+                unique.push_back(static_cast<T>(vals[j]));
+            }
+        }
+        std::sort(unique.begin(), unique.end());
+        unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+        dictSize = unique.size();
+        codeWidth = dictSize <= 0x100 ? 1 : dictSize <= 0x10000 ? 2 : 4;
+
+        try {
+            dictionary = (T*)malloc(sizeof(T) * std::max<size_t>(dictSize, 1));
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+            exit(1);
+        }
+        std::copy(unique.begin(), unique.end(), dictionary);
+
+        allocateOuter();
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            std::vector<std::pair<uint32_t, indexT>> entries;
+            entries.reserve(vectorEnd(i) - outerPointers[i]);
+
+            for (uint64_t j = outerPointers[i]; j < vectorEnd(i); j++) {
+                uint32_t code = std::lower_bound(unique.begin(), unique.end(), static_cast<T>(vals[j])) - unique.begin();
+                entries.emplace_back(code, (indexT)innerIndices[j]);
+            }
+
+            // group by code with the indices of each code ascending
+            std::sort(entries.begin(), entries.end());
+
+            compressVector(i, entries.data(), entries.data() + entries.size());
+        }
+
+        calculateCompSize();
+    }
+
+    // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, 5, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            nnz = mat.nonZeros();
+
+            compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
+
+    // Encodes one vector as runs of a code, a width, the first index, the deltas and a delimiter
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::compressVector(uint64_t vec, std::pair<uint32_t, indexT>* begin, std::pair<uint32_t, indexT>* end) {
+
+        // an empty vector has no data
+        if (begin == end) {
+            data[vec] = nullptr;
+            endPointers[vec] = nullptr;
+            return;
+        }
+
+        // the width of each run is the width of its largest delta
+        std::vector<uint8_t> widths;
+        size_t bytes = 0;
+        for (auto* run = begin; run < end;) {
+            uint64_t maxDelta = run->second;
+            auto* next = run + 1;
+            for (; next < end && next->first == run->first; next++) {
+                maxDelta = std::max<uint64_t>(maxDelta, next->second - (next - 1)->second);
+            }
+
+            widths.push_back(byteWidth(maxDelta));
+            bytes += codeWidth + 1 + widths.back() * (next - run + 1);
+            run = next;
+        }
+
+        try {
+            data[vec] = malloc(bytes);
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+        endPointers[vec] = (uint8_t*)data[vec] + bytes;
+
+        uint8_t* helpPtr = (uint8_t*)data[vec];
+        size_t runNum = 0;
+        for (auto* run = begin; run < end; runNum++) {
+            uint8_t width = widths[runNum];
+
+            memcpy(helpPtr, &run->first, codeWidth);
+            helpPtr += codeWidth;
+            *helpPtr++ = width;
+
+            auto* next = run;
+            for (; next < end && next->first == run->first; next++) {
+                uint64_t index = next == run ? next->second : next->second - (next - 1)->second;
+                memcpy(helpPtr, &index, width);
+                helpPtr += width;
+            }
+
+            // write a delimiter of the correct width
+            memset(helpPtr, 0, width);
+            helpPtr += width;
+            run = next;
+        }
+    }
+
+    // Prints the matrix dense to the given stream
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 5, columnMajor>::print(std::ostream& os) {
+        os << std::endl;
+        os << "IVSparse Matrix" << std::endl;
+
+        // only the first 100 rows and columns are printed
+        uint32_t rows = std::min(numRows, (uint64_t)100);
+        uint32_t cols = std::min(numCols, (uint64_t)100);
+
+        std::vector<T> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            forEachEntry(i, [&](uint64_t index, T value) {
+                uint64_t row = columnMajor ? index : i;
+                uint64_t col = columnMajor ? i : index;
+                if (row < rows && col < cols) { dense[(size_t)row * cols + col] = value; }
+            });
+        }
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << dense[(size_t)i * cols + j] << " ";
+            }
+            os << std::endl;
+        }
+
+        os << std::endl;
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,344 @@
+/**
+ * @file Dictionary_SparseMatrix.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Header File for Dictionary Sparse Matrix Declarations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * The Dictionary Sparse Matrix Class is IVCSC with a value dictionary shared
+     * by the whole matrix. \n \n
+     * IVCSC stores each unique value once per vector, so a value that appears in
+     * every vector is stored once per vector. Here every unique value of the
+     * matrix is stored once in a dictionary and each run stores a code into it,
+     * 1 byte for up to 256 unique values, 2 for up to 65536 and 4 otherwise.
+     * Integer and quantized data keep a dictionary small enough to stay in L1
+     * cache while the calculations look up one value per run. \n \n
+     * Each run is its code, the width of its indices and then its first index
+     * and the deltas to the rest followed by a delimiter of 0. The widths are
+     * rounded up to 1, 2, 4 or 8 bytes so every run decodes with a loop
+     * specialized to its width.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 5, columnMajor> {
+        private:
+        //* The Matrix Data *//
+
+        T* dictionary = nullptr;  // The unique values of the matrix
+        uint32_t dictSize = 0;    // The number of unique values
+        uint8_t codeWidth = 1;    // The byte width of the codes, 1, 2 or 4
+
+        void** data = nullptr;         // The start of each encoded vector
+        void** endPointers = nullptr;  // The end of each encoded vector
+
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
+
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
+
+        size_t compSize = 0;  // The size of the compressed matrix in bytes
+
+        //* Private Methods *//
+
+        // Calculates the number of bytes needed to store a delta, rounded up to 1, 2, 4 or 8
+        static inline uint8_t byteWidth(size_t size);
+
+        // Calls visit(index) for the indices of a run of the given width, returns the end of the run
+        template <typename Visit>
+        static inline uint8_t* decodeRun(uint8_t* indices, uint8_t width, Visit visit);
+
+        // Calls visit(value, indices, width) for each run of a vector with codes of type codeT
+        template <typename codeT, typename Visit>
+        inline void decodeRuns(uint64_t vec, Visit visit);
+
+        // Calls visit(value, indices, width) for each run of a vector, visit returns the end of the run
+        template <typename Visit>
+        inline void forEachRun(uint64_t vec, Visit visit);
+
+        // Allocates the per vector pointers for outerDim vectors
+        void allocateOuter();
+
+        // Frees the dictionary, every vector and the per vector pointers
+        void freeData();
+
+        // Compression Algorithm for going from CSC to Dictionary
+        template <typename T2, typename indexT2>
+        void compressCSC(const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers,
+                         const indexT2* innerNonZeros = nullptr);
+
+        // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+        template <int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat);
+
+        // Encodes one vector from its (code, index) pairs sorted by code and then index
+        void compressVector(uint64_t vec, std::pair<uint32_t, indexT>* begin, std::pair<uint32_t, indexT>* end);
+
+        // performs some simple user checks on the matrices metadata
+        void userChecks();
+
+        // Calculates the current byte size of the matrix in memory
+        void calculateCompSize();
+
+        // Scalar Multiplication
+        inline IVSparse::SparseMatrix<T, indexT, 5, columnMajor> scalarMultiply(T scalar);
+
+        // In Place Scalar Multiplication
+        inline void inPlaceScalarMultiply(T scalar);
+
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // helper for ostream operator
+        void print(std::ostream& stream);
+
+        public:
+
+        // Gets the number of rows in the matrix
+        uint64_t rows() const { return numRows; }
+
+        // Gets the number of columns in the matrix
+        uint64_t cols() const { return numCols; }
+
+        // Gets the inner dimension of the matrix
+        uint64_t innerSize() const { return innerDim; }
+
+        // Gets the outer dimension of the matrix
+        uint64_t outerSize() const { return outerDim; }
+
+        // Gets the number of non-zero elements in the matrix
+        uint64_t nonZeros() const { return nnz; }
+
+        // Gets the number of bytes needed to store the matrix
+        size_t byteSize() const { return compSize; }
+
+        // Gets the number of unique values in the dictionary
+        uint32_t dictionarySize() const { return dictSize; }
+
+        // Gets the byte width of the codes stored in each run
+        uint8_t codeSize() const { return codeWidth; }
+
+        // Gets the dictionary of unique values
+        const T* getDictionary() const { return dictionary; }
+
+        //* Nested Subclasses *//
+
+        // The Iterator Class for Dictionary Matrices
+        class InnerIterator;
+
+        //* Constructors and Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Construct an empty IVSparse matrix \n \n
+          * The matrix will have 0 rows and 0 columns and
+          * will not be initialized with any values. All data
+          * will be set to nullptr.
+          */
+        SparseMatrix() {};
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor \n \n
+         * This constructor builds the dictionary of the unique values of an Eigen
+         * Sparse Matrix and then compresses each vector into runs of codes. The
+         * Eigen matrix is not modified, it may be in compressed or uncompressed
+         * mode.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T>& mat);
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Sparse Matrices.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+
+        /**
+         * @tparam compressionLevel2 The compression level of the IVSparse matrix to
+         * convert
+         * @param mat The IVSparse matrix to convert
+         *
+         * Converts a IVSparse matrix of any compression level to a Dictionary
+         * matrix of the same storage order, value and index type.
+         */
+        template <uint8_t compressionLevel2>
+        SparseMatrix(IVSparse::SparseMatrix<T, indexT, compressionLevel2, columnMajor>& other);
+
+        /**
+         * @param other The IVSparse matrix to be copied
+         *
+         * Deep Copy Constructor \n \n
+         * This constructor takes in a Dictionary matrix and creates a deep copy of
+         * it.
+         */
+        SparseMatrix(const IVSparse::SparseMatrix<T, indexT, 5, columnMajor>& other);
+
+        /**
+         * Raw CSC Constructor \n \n
+         * This constructor takes in raw CSC storage format pointers and converts it
+         * to a Dictionary matrix.
+         */
+        template <typename T2, typename indexT2>
+        SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
+
+        /**
+         * @brief Destroy the Sparse Matrix object
+         */
+        ~SparseMatrix();
+
+        ///@}
+
+        //* Getters *//
+        /**
+         * @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns T The value at the specified row and column. Returns 0 if the
+          * value is not found.
+          */
+        T coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @returns true If the matrix is stored in column major format
+         * @returns false If the matrix is stored in row major format
+         */
+        bool isColumnMajor() const;
+
+        /**
+         * @param vec The vector to get the size of
+         * @returns The number of bytes the encoded vector takes.
+         */
+        size_t getVectorSize(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to traverse
+         * @param visit Called as visit(index, value) for every non-zero
+         *
+         * Visits the non-zeros of a vector grouped by value. Each run looks its
+         * value up in the dictionary once.
+         */
+        template <typename Visit>
+        inline void forEachEntry(uint64_t vec, Visit visit);
+
+        ///@}
+
+        //* Calculations *//
+        /**
+         * @name Calculations
+         */
+         ///@{
+
+         /**
+          * @tparam accumT The type the sums are accumulated in and returned as
+          * @returns A vector of the sum of each vector along the outer dimension.
+          */
+        template <typename accumT = T>
+        inline std::vector<accumT> outerSum();
+
+        /**
+         * @tparam accumT The type the sums are accumulated in and returned as
+         * @returns A vector of the sum of each vector along the inner dimension.
+         */
+        template <typename accumT = T>
+        inline std::vector<accumT> innerSum();
+
+        /**
+         * @tparam accumT The type the sum is accumulated in and returned as
+         * @returns The sum of all the values in the matrix.
+         */
+        template <typename accumT = T>
+        inline accumT sum();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns The frobenius norm of the matrix.
+         */
+        template <typename accumT = double>
+        inline accumT norm();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns Returns the length of the specified vector.
+         */
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        ///@}
+
+        //* Utility Methods *//
+        /**
+         * @name Utility Methods
+         */
+         ///@{
+
+         /**
+          * Prints "IVSparse Matrix:" followed by the dense representation of the
+          * matrix to the console.
+          *
+          * @note Useful for debugging but only goes up to 100 of either dimension.
+          */
+        void print();
+
+        /**
+         * @returns An Eigen Sparse Matrix constructed from the Dictionary matrix
+         * data.
+         */
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> toEigen();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        friend std::ostream& operator<< (std::ostream& stream, IVSparse::SparseMatrix<T, indexT, 5, columnMajor>& mat) {
+            mat.print(stream);
+            return stream;
+        }
+
+        // Assignment Operator
+        IVSparse::SparseMatrix<T, indexT, 5, columnMajor>& operator=(const IVSparse::SparseMatrix<T, indexT, 5, columnMajor>& other);
+
+        // Equality Operator
+        bool operator==(const SparseMatrix<T, indexT, 5, columnMajor>& other) const;
+
+        // Inequality Operator
+        bool operator!=(const SparseMatrix<T, indexT, 5, columnMajor>& other);
+
+        // Coefficient Access Operator
+        T operator()(uint64_t row, uint64_t col);
+
+        // Scalar Multiplication, only the dictionary is scaled
+        IVSparse::SparseMatrix<T, indexT, 5, columnMajor> operator*(T scalar);
+
+        // In Place Scalar Multiplication, only the dictionary is scaled
+        void operator*=(T scalar);
+
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1>& mat);
+
+    };  // End of Dictionary Sparse Matrix Class
+
+}  // namespace IVSparse
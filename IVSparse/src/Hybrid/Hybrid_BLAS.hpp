@@ -0,0 +1,200 @@
+/**
+ * @file Hybrid_BLAS.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief BLAS Routines and Other Matrix Calculations for Hybrid Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* BLAS Level 1 Routines *//
+
+    // Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SparseMatrix<T, indexT, 4, columnMajor> SparseMatrix<T, indexT, 4, columnMajor>::scalarMultiply(T scalar) {
+        // Deep copy the matrix
+        IVSparse::SparseMatrix<T, indexT, 4, columnMajor> newMatrix(*this);
+
+        newMatrix.inPlaceScalarMultiply(scalar);
+        return newMatrix;
+    }
+
+    // In Place Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::inPlaceScalarMultiply(T scalar) {
+        // only the stored values change, the encoding of each vector stays the same
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachValue(i, [&](T& value) { value *= scalar; });
+        }
+    }
+
+    //* BLAS Level 2 Routines *//
+
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 4, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the vector is the correct size
+        assert((uint64_t)vec.rows() == numCols &&
+               "The vector must be the same size as the number of columns in the "
+               "matrix!");
+        #endif
+
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        if constexpr (columnMajor) {
+            // scatter each column scaled by its vector entry
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                if (vec(i) == 0) return;
+
+                forEachEntry(i, [&](indexT index, T value) { buffer[index] += static_cast<accumT>(value) * vec(i); });
+            });
+        }
+        else {
+            // each row is an independent dot product
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0;
+                forEachEntry(i, [&](indexT index, T value) { rowSum += static_cast<accumT>(value) * vec(index); });
+                eigenTemp(i) = rowSum;
+            }
+        }
+        return eigenTemp;
+    }
+
+    //* BLAS Level 3 Routines *//
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 4, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and scatters the whole matrix into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    forEachEntry(i, [&](indexT index, T value) {
+                        newMatrix.col(index).segment(start, length) += matTranspose.col(i).segment(start, length) * static_cast<accumT>(value);
+                    });
+                }
+            }
+        }
+        else {
+            // each row of the result only reads the rows of mat it touches
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                forEachEntry(i, [&](indexT index, T value) {
+                    newMatrix.col(i) += matTranspose.col(index) * static_cast<accumT>(value);
+                });
+            }
+        }
+        return newMatrix.transpose();
+    }
+
+    //* Other Matrix Calculations *//
+
+    // Finds the Outer Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 4, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachRun(i, [&](T value, uint64_t count) { outerSum[i] += static_cast<accumT>(value) * count; });
+        }
+        return outerSum;
+    }
+
+    // Finds the Inner Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 4, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
+
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            forEachEntry(i, [&](indexT index, T value) { buffer[index] += static_cast<accumT>(value); });
+        });
+        return innerSum;
+    }
+
+    // Finds the sum of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 4, columnMajor>::sum() {
+        accumT sum = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for reduction(+ : sum)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachRun(i, [&](T value, uint64_t count) { sum += static_cast<accumT>(value) * count; });
+        }
+        return sum;
+    }
+
+    // Calculates the norm of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 4, columnMajor>::norm() {
+        accumT norm = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for reduction(+ : norm)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachRun(i, [&](T value, uint64_t count) { norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count; });
+        }
+        return sqrt(norm);
+    }
+
+    // Finds the length of a certain column
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 4, columnMajor>::vectorLength(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        accumT norm = 0;
+        forEachRun(vec, [&](T value, uint64_t count) { norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count; });
+        return sqrt(norm);
+    }
+
+}  // namespace IVSparse
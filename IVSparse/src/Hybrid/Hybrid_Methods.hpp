@@ -0,0 +1,171 @@
+/**
+ * @file Hybrid_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Methods for Hybrid Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Getters *//
+
+    // Gets the element stored at the given row and column
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 4, columnMajor>::coeff(uint64_t row, uint64_t col) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(row < numRows && col < numCols && "Invalid row and column!");
+        #endif
+
+        uint64_t vec = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        if (data[vec] == nullptr) return 0;
+
+        switch (tags[vec]) {
+        case HYBRID_CSC: {
+            // binary search the sorted indices
+            size_t n = getVectorSize(vec) / (sizeof(T) + sizeof(indexT));
+            T* values = (T*)data[vec];
+            indexT* indices = (indexT*)(values + n);
+
+            indexT* found = std::lower_bound(indices, indices + n, (indexT)index);
+            return (found != indices + n && *found == index) ? values[found - indices] : 0;
+        }
+        case HYBRID_DENSE: {
+            // the value is at the number of set bits before the index
+            uint64_t* bitmap = (uint64_t*)data[vec];
+            T* values = (T*)(bitmap + (innerDim + 63) / 64);
+
+            if (!((bitmap[index / 64] >> (index % 64)) & 1)) return 0;
+
+            uint64_t rank = 0;
+            for (uint64_t w = 0; w < index / 64; w++) { rank += __builtin_popcountll(bitmap[w]); }
+            rank += __builtin_popcountll(bitmap[index / 64] & (((uint64_t)1 << (index % 64)) - 1));
+            return values[rank];
+        }
+        default: {
+            // value grouped vectors have to be scanned
+            T value = 0;
+            forEachEntry(vec, [&](indexT i, T v) { if (i == index) value = v; });
+            return value;
+        }
+        }
+    }
+
+    // Check for Column Major
+    template <typename T, typename indexT, bool columnMajor>
+    bool SparseMatrix<T, indexT, 4, columnMajor>::isColumnMajor() const {
+        return columnMajor;
+    }
+
+    // Gets the encoding of a vector
+    template <typename T, typename indexT, bool columnMajor>
+    IVSparse::HybridEncoding SparseMatrix<T, indexT, 4, columnMajor>::getEncoding(uint64_t vec) const {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds");
+        #endif
+
+        return (IVSparse::HybridEncoding)tags[vec];
+    }
+
+    // Gets the number of bytes of an encoded vector
+    template <typename T, typename indexT, bool columnMajor>
+    size_t SparseMatrix<T, indexT, 4, columnMajor>::getVectorSize(uint64_t vec) const {
+        return (uint8_t*)endPointers[vec] - (uint8_t*)data[vec];
+    }
+
+    // Visits every non-zero of a vector, the encoding is only checked once
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::forEachEntry(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        switch (tags[vec]) {
+        case HYBRID_CSC: {
+            size_t n = getVectorSize(vec) / (sizeof(T) + sizeof(indexT));
+            T* values = (T*)data[vec];
+            indexT* indices = (indexT*)(values + n);
+            for (size_t k = 0; k < n; k++) { visit(indices[k], values[k]); }
+            break;
+        }
+        case HYBRID_DENSE: {
+            // walk the set bits of each word
+            uint64_t words = (innerDim + 63) / 64;
+            uint64_t* bitmap = (uint64_t*)data[vec];
+            T* values = (T*)(bitmap + words);
+            for (uint64_t w = 0; w < words; w++) {
+                for (uint64_t bits = bitmap[w]; bits != 0; bits &= bits - 1) {
+                    visit((indexT)(w * 64 + __builtin_ctzll(bits)), *values++);
+                }
+            }
+            break;
+        }
+        case HYBRID_VCSC: {
+            indexT* header = (indexT*)data[vec];
+            T* values = (T*)(header + 1);
+            indexT* counts = (indexT*)(values + *header);
+            indexT* indices = counts + *header;
+            for (indexT j = 0; j < *header; j++) {
+                for (indexT k = 0; k < counts[j]; k++) { visit(*indices++, values[j]); }
+            }
+            break;
+        }
+        case HYBRID_IVCSC: {
+            uint8_t* run = (uint8_t*)data[vec];
+            while (run < (uint8_t*)endPointers[vec]) {
+                T value = *(T*)run;
+                uint8_t width = *(run + sizeof(T));
+                uint8_t* index = run + sizeof(T) + 1;
+
+                // the first index is absolute and the rest are deltas ending in a delimiter
+                uint64_t current = readIndex(index, width);
+                visit((indexT)current, value);
+                for (index += width; uint64_t delta = readIndex(index, width); index += width) {
+                    current += delta;
+                    visit((indexT)current, value);
+                }
+                run = index + width;
+            }
+            break;
+        }
+        }
+    }
+
+    //* Utility Methods *//
+
+    // Prints the matrix dense to console
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::print() {
+        print(std::cout);
+    }
+
+    // Converts the matrix to an Eigen sparse matrix
+    template <typename T, typename indexT, bool columnMajor>
+    Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> SparseMatrix<T, indexT, 4, columnMajor>::toEigen() {
+
+        #ifdef IVSPARSE_DEBUG
+        // assert that the matrix is not empty
+        assert(outerDim > 0 && "Cannot convert an empty matrix to an Eigen matrix!");
+        #endif
+
+        // value grouped vectors are not in index order so go through triplets
+        std::vector<Eigen::Triplet<T>> triplets;
+        triplets.reserve(nnz);
+        for (uint64_t i = 0; i < outerDim; i++) {
+            forEachEntry(i, [&](indexT index, T value) {
+                if constexpr (columnMajor) { triplets.emplace_back(index, i, value); }
+                else { triplets.emplace_back(i, index, value); }
+            });
+        }
+
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
+        eigenMatrix.setFromTriplets(triplets.begin(), triplets.end());
+        return eigenMatrix;
+    }
+
+}  // namespace IVSparse
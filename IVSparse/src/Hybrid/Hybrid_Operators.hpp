@@ -0,0 +1,123 @@
+/**
+ * @file Hybrid_Operators.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Operator Overloads for Hybrid Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Assignment Operator
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 4, columnMajor>& SparseMatrix<T, indexT, 4, columnMajor>::operator=(const IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& other) {
+        // check if the matrices are the same
+        if (this != &other) {
+            // free the old data
+            freeData();
+
+            // set the dimensions
+            numRows = other.numRows;
+            numCols = other.numCols;
+            outerDim = other.outerDim;
+            innerDim = other.innerDim;
+            nnz = other.nnz;
+            compSize = other.compSize;
+
+            if (other.data == nullptr) return *this;
+
+            allocateOuter();
+            memcpy(tags, other.tags, outerDim);
+
+            // copy each encoded vector
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (other.data[i] == nullptr) continue;
+
+                size_t bytes = other.getVectorSize(i);
+                try {
+                    data[i] = malloc(bytes);
+                }
+                catch (std::bad_alloc& e) {
+                    std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+                    exit(1);
+                }
+                memcpy(data[i], other.data[i], bytes);
+                endPointers[i] = (uint8_t*)data[i] + bytes;
+            }
+        }
+
+        // return the new matrix
+        return *this;
+    }
+
+    // Equality Operator
+    template <typename T, typename indexT, bool columnMajor>
+    bool SparseMatrix<T, indexT, 4, columnMajor>::operator==(const SparseMatrix<T, indexT, 4, columnMajor>& other) const {
+        if (numRows != other.numRows || numCols != other.numCols || nnz != other.nnz) {
+            return false;
+        }
+
+        // the encoding is picked the same way for equal vectors
+        if (outerDim > 0 && memcmp(tags, other.tags, outerDim) != 0) {
+            return false;
+        }
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            if (getVectorSize(i) != other.getVectorSize(i) ||
+                memcmp(data[i], other.data[i], getVectorSize(i)) != 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Inequality Operator
+    template <typename T, typename indexT, bool columnMajor>
+    bool SparseMatrix<T, indexT, 4, columnMajor>::operator!=(const SparseMatrix<T, indexT, 4, columnMajor>& other) {
+        return !(*this == other);
+    }
+
+    // Coefficent Access Operator
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 4, columnMajor>::operator()(uint64_t row, uint64_t col) {
+        #ifdef IVSPARSE_DEBUG
+        // check if the row and column are in bounds
+        assert((row < numRows) && "Row index out of bounds");
+        assert((col < numCols) && "Column index out of bounds");
+        #endif
+
+        return coeff(row, col);
+    }
+
+    //* BLAS Operators *//
+
+    // Scalar Multiplication
+    template <typename T, typename indexT, bool columnMajor>
+    IVSparse::SparseMatrix<T, indexT, 4, columnMajor> SparseMatrix<T, indexT, 4, columnMajor>::operator*(T scalar) {
+        return scalarMultiply(scalar);
+    }
+
+    // In place scalar multiplication
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::operator*=(T scalar) {
+        return inPlaceScalarMultiply(scalar);
+    }
+
+    // Matrix Vector Multiplication
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 4, columnMajor>::operator*(Eigen::Matrix<accumT, -1, 1>& vec) {
+        return vectorMultiply(vec);
+    }
+
+    // Matrix Matrix Multiplication
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 4, columnMajor>::operator*(Eigen::Matrix<accumT, -1, -1>& mat) {
+        return matrixMultiply(mat);
+    }
+
+}  // namespace IVSparse
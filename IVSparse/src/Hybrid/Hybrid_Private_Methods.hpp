@@ -0,0 +1,400 @@
+/**
+ * @file Hybrid_Private_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Private Methods for Hybrid Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Calculates the number of bytes needed to store a value
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint8_t SparseMatrix<T, indexT, 4, columnMajor>::byteWidth(size_t size) {
+        uint8_t width = 1;
+        while (width < 8 && (size >> (8 * width)) != 0) { width++; }
+        return width;
+    }
+
+    // Reads a single index of the given byte width
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 4, columnMajor>::readIndex(uint8_t* ptr, uint8_t width) {
+        switch (width) {
+        case 1:
+            return *ptr;
+        case 2:
+            return *(uint16_t*)ptr;
+        case 4:
+            return *(uint32_t*)ptr;
+        case 8:
+            return *(uint64_t*)ptr;
+        default:
+            uint64_t index = 0;
+            for (uint8_t i = 0; i < width; i++) { index |= (uint64_t)ptr[i] << (8 * i); }
+            return index;
+        }
+    }
+
+    // Allocates the per vector pointers and tags, every vector starts empty
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::allocateOuter() {
+        try {
+            data = (void**)calloc(outerDim, sizeof(void*));
+            endPointers = (void**)calloc(outerDim, sizeof(void*));
+            tags = (uint8_t*)malloc(outerDim);
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+            exit(1);
+        }
+        memset(tags, HYBRID_CSC, outerDim);
+    }
+
+    // Frees every vector and the per vector pointers and tags
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::freeData() {
+        if (data != nullptr) {
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (data[i] != nullptr) { free(data[i]); }
+            }
+        }
+
+        free(data);
+        free(endPointers);
+        free(tags);
+
+        data = nullptr;
+        endPointers = nullptr;
+        tags = nullptr;
+    }
+
+    // performs some simple user checks on the matrices metadata
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::userChecks() {
+        assert((innerDim > 1 || outerDim > 1 || nnz > 1) &&
+               "The matrix must have at least one row, column, and nonzero value");
+        assert(std::is_floating_point<indexT>::value == false &&
+               "The index type must be a non-floating point type");
+        assert((std::is_arithmetic<T>::value && std::is_arithmetic<indexT>::value) &&
+               "The value and index types must be numeric types");
+        assert((std::is_same<indexT, bool>::value == false) &&
+               "The index type must not be bool");
+        assert((innerDim < std::numeric_limits<indexT>::max() &&
+                outerDim < std::numeric_limits<indexT>::max()) &&
+               "The number of rows and columns must be less than the maximum value "
+               "of the index type");
+    }
+
+    // Calculates the current byte size of the matrix, the encoded vectors and their tags
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::calculateCompSize() {
+        compSize = outerDim;
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            compSize += getVectorSize(i);
+        }
+    }
+
+    // Compression Algorithm for going from CSC to Hybrid
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename T2, typename indexT2>
+    void SparseMatrix<T, indexT, 4, columnMajor>::compressCSC(const T2* vals, const indexT2* innerIndices,
+                                                                const indexT2* outerPointers, const indexT2* innerNonZeros) {
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+
+        allocateOuter();
+
+        // every vector is measured and encoded on its own
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            // the end of the vector, an uncompressed Eigen matrix has gaps between its vectors
+            uint64_t end = innerNonZeros == nullptr ? outerPointers[i + 1] : outerPointers[i] + innerNonZeros[i];
+
+            std::vector<std::pair<T, indexT>> entries;
+            entries.reserve(end - outerPointers[i]);
+            for (uint64_t j = outerPointers[i]; j < end; j++) {
+                entries.emplace_back(static_cast<T>(vals[j]), (indexT)innerIndices[j]);
+            }
+
+            auto byIndex = [](const std::pair<T, indexT>& a, const std::pair<T, indexT>& b) { return a.second < b.second; };
+            if (!std::is_sorted(entries.begin(), entries.end(), byIndex)) {
+                std::sort(entries.begin(), entries.end(), byIndex);
+            }
+
+            compressVector(i, entries.data(), entries.data() + entries.size());
+        }
+
+        calculateCompSize();
+    }
+
+    // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, 4, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            nnz = mat.nonZeros();
+
+            compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
+
+    // Sizes every encoding of a vector from its entries sorted by index and writes the smallest
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end) {
+        size_t n = end - begin;
+
+        // an empty vector has no data and is left as CSC
+        if (n == 0) {
+            data[vec] = nullptr;
+            endPointers[vec] = nullptr;
+            tags[vec] = HYBRID_CSC;
+            return;
+        }
+
+        // the value compressed encodings group the indices by value, the stable sort keeps them ascending
+        std::vector<std::pair<T, indexT>> byValue(begin, end);
+        std::stable_sort(byValue.begin(), byValue.end(),
+                         [](const std::pair<T, indexT>& a, const std::pair<T, indexT>& b) { return a.first < b.first; });
+
+        // each IVCSC run is a value, a width, its indices and a delimiter
+        uint64_t runs = 0;
+        size_t ivcscBytes = 0;
+        for (size_t run = 0; run < n;) {
+            uint64_t maxDelta = byValue[run].second;
+            size_t next = run + 1;
+            for (; next < n && byValue[next].first == byValue[run].first; next++) {
+                maxDelta = std::max<uint64_t>(maxDelta, byValue[next].second - byValue[next - 1].second);
+            }
+
+            ivcscBytes += sizeof(T) + 1 + byteWidth(maxDelta) * (next - run + 1);
+            runs++;
+            run = next;
+        }
+
+        uint64_t words = (innerDim + 63) / 64;
+
+        size_t cscBytes = (sizeof(T) + sizeof(indexT)) * n;
+        size_t denseBytes = sizeof(uint64_t) * words + sizeof(T) * n;
+        size_t vcscBytes = sizeof(indexT) + (sizeof(T) + sizeof(indexT)) * runs + sizeof(indexT) * n;
+
+        // on a tie the encoding that is faster to read wins
+        uint8_t tag = HYBRID_CSC;
+        size_t bytes = cscBytes;
+        if (denseBytes < bytes) { tag = HYBRID_DENSE; bytes = denseBytes; }
+        if (vcscBytes < bytes) { tag = HYBRID_VCSC; bytes = vcscBytes; }
+        if (ivcscBytes < bytes) { tag = HYBRID_IVCSC; bytes = ivcscBytes; }
+
+        try {
+            data[vec] = malloc(bytes);
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+        endPointers[vec] = (uint8_t*)data[vec] + bytes;
+        tags[vec] = tag;
+
+        switch (tag) {
+        case HYBRID_CSC: {
+            // the values and then the indices, both in index order
+            T* values = (T*)data[vec];
+            indexT* indices = (indexT*)(values + n);
+            for (size_t k = 0; k < n; k++) {
+                values[k] = begin[k].first;
+                indices[k] = begin[k].second;
+            }
+            break;
+        }
+        case HYBRID_DENSE: {
+            // a bit per inner index and then the values in index order
+            uint64_t* bitmap = (uint64_t*)data[vec];
+            T* values = (T*)(bitmap + words);
+            memset(bitmap, 0, sizeof(uint64_t) * words);
+            for (size_t k = 0; k < n; k++) {
+                bitmap[begin[k].second / 64] |= (uint64_t)1 << (begin[k].second % 64);
+                values[k] = begin[k].first;
+            }
+            break;
+        }
+        case HYBRID_VCSC: {
+            // the number of unique values, the values, their counts and the indices grouped by value
+            indexT* header = (indexT*)data[vec];
+            T* values = (T*)(header + 1);
+            indexT* counts = (indexT*)(values + runs);
+            indexT* indices = counts + runs;
+
+            *header = runs;
+            size_t j = 0;
+            for (size_t k = 0; k < n; k++) {
+                if (k == 0 || byValue[k].first != byValue[k - 1].first) {
+                    values[j] = byValue[k].first;
+                    counts[j++] = 0;
+                }
+                counts[j - 1]++;
+                indices[k] = byValue[k].second;
+            }
+            break;
+        }
+        case HYBRID_IVCSC: {
+            // the runs, the first index is absolute and the rest are deltas
+            uint8_t* helpPtr = (uint8_t*)data[vec];
+            for (size_t run = 0; run < n;) {
+                uint64_t maxDelta = byValue[run].second;
+                size_t next = run + 1;
+                for (; next < n && byValue[next].first == byValue[run].first; next++) {
+                    maxDelta = std::max<uint64_t>(maxDelta, byValue[next].second - byValue[next - 1].second);
+                }
+                uint8_t width = byteWidth(maxDelta);
+
+                memcpy(helpPtr, &byValue[run].first, sizeof(T));
+                helpPtr += sizeof(T);
+                *helpPtr++ = width;
+
+                for (size_t k = run; k < next; k++) {
+                    uint64_t index = k == run ? byValue[k].second : byValue[k].second - byValue[k - 1].second;
+                    memcpy(helpPtr, &index, width);
+                    helpPtr += width;
+                }
+
+                // write a delimiter of the correct width
+                memset(helpPtr, 0, width);
+                helpPtr += width;
+                run = next;
+            }
+            break;
+        }
+        }
+    }
+
+    // Calls visit(value, count) once per stored value, the encoding is only checked once
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::forEachRun(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        switch (tags[vec]) {
+        case HYBRID_CSC: {
+            T* values = (T*)data[vec];
+            size_t n = getVectorSize(vec) / (sizeof(T) + sizeof(indexT));
+            for (size_t k = 0; k < n; k++) { visit(values[k], 1); }
+            break;
+        }
+        case HYBRID_DENSE: {
+            T* values = (T*)((uint64_t*)data[vec] + (innerDim + 63) / 64);
+            for (T* value = values; value < (T*)endPointers[vec]; value++) { visit(*value, 1); }
+            break;
+        }
+        case HYBRID_VCSC: {
+            indexT* header = (indexT*)data[vec];
+            T* values = (T*)(header + 1);
+            indexT* counts = (indexT*)(values + *header);
+            for (indexT j = 0; j < *header; j++) { visit(values[j], counts[j]); }
+            break;
+        }
+        case HYBRID_IVCSC: {
+            uint8_t* run = (uint8_t*)data[vec];
+            while (run < (uint8_t*)endPointers[vec]) {
+                T value = *(T*)run;
+                uint8_t width = *(run + sizeof(T));
+                uint8_t* index = run + sizeof(T) + 1;
+
+                // the first index may be 0 so the delimiter search starts at the second
+                uint64_t length = 1;
+                for (index += width; readIndex(index, width) != DELIM; index += width) { length++; }
+
+                visit(value, length);
+                run = index + width;
+            }
+            break;
+        }
+        }
+    }
+
+    // Calls visit(value) with a reference to each stored value, the encoding is only checked once
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::forEachValue(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        switch (tags[vec]) {
+        case HYBRID_CSC: {
+            T* values = (T*)data[vec];
+            size_t n = getVectorSize(vec) / (sizeof(T) + sizeof(indexT));
+            for (size_t k = 0; k < n; k++) { visit(values[k]); }
+            break;
+        }
+        case HYBRID_DENSE: {
+            T* values = (T*)((uint64_t*)data[vec] + (innerDim + 63) / 64);
+            for (T* value = values; value < (T*)endPointers[vec]; value++) { visit(*value); }
+            break;
+        }
+        case HYBRID_VCSC: {
+            indexT* header = (indexT*)data[vec];
+            T* values = (T*)(header + 1);
+            for (indexT j = 0; j < *header; j++) { visit(values[j]); }
+            break;
+        }
+        case HYBRID_IVCSC: {
+            uint8_t* run = (uint8_t*)data[vec];
+            while (run < (uint8_t*)endPointers[vec]) {
+                uint8_t width = *(run + sizeof(T));
+                uint8_t* index = run + sizeof(T) + 1;
+                for (index += width; readIndex(index, width) != DELIM; index += width) {}
+
+                visit(*(T*)run);
+                run = index + width;
+            }
+            break;
+        }
+        }
+    }
+
+    // Prints the matrix dense to the given stream
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 4, columnMajor>::print(std::ostream& os) {
+        os << std::endl;
+        os << "IVSparse Matrix" << std::endl;
+
+        // only the first 100 rows and columns are printed
+        uint32_t rows = std::min(numRows, (uint64_t)100);
+        uint32_t cols = std::min(numCols, (uint64_t)100);
+
+        // decode each shown vector once instead of calling coeff() for every element
+        std::vector<T> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            forEachEntry(i, [&](indexT index, T value) {
+                uint64_t row = columnMajor ? index : i;
+                uint64_t col = columnMajor ? i : index;
+                if (row < rows && col < cols) { dense[(size_t)row * cols + col] = value; }
+            });
+        }
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << dense[(size_t)i * cols + j] << " ";
+            }
+            os << std::endl;
+        }
+
+        os << std::endl;
+    }
+
+}  // namespace IVSparse
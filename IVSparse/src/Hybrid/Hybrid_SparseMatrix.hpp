@@ -0,0 +1,348 @@
+/**
+ * @file Hybrid_SparseMatrix.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Header File for Hybrid Sparse Matrix Declarations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * The encoding of one vector of a Hybrid matrix. The tags of the sparse
+     * encodings are the compression level they store their vector like.
+     */
+    enum HybridEncoding : uint8_t {
+        HYBRID_CSC = 1,    // Values and inner indices in index order
+        HYBRID_VCSC = 2,   // Unique values, their counts and the indices grouped by value
+        HYBRID_IVCSC = 3,  // Runs of a value, a byte width and delta encoded indices
+        HYBRID_DENSE = 4   // A bitmap of the non-zero indices and the values in index order
+    };
+
+    /**
+     * The Hybrid Sparse Matrix Class picks the smallest encoding for each vector
+     * on its own. \n \n
+     * Real matrices often mix near-dense vectors, vectors with a handful of
+     * unique values and vectors where every value is unique. Instead of forcing
+     * one format on all of them, every vector is stored as CSC, VCSC, IVCSC or a
+     * dense bitmap depending on which takes the fewest bytes, and carries a tag
+     * byte saying which. The calculations switch on the tag once per vector and
+     * then run a loop specialized to that encoding, so there is no branching per
+     * element.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 4, columnMajor> {
+        private:
+        //* The Matrix Data *//
+
+        void** data = nullptr;         // The start of each encoded vector
+        void** endPointers = nullptr;  // The end of each encoded vector
+        uint8_t* tags = nullptr;       // The HybridEncoding of each vector
+
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
+
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
+
+        size_t compSize = 0;  // The size of the compressed matrix in bytes
+
+        //* Private Methods *//
+
+        // Calculates the number of bytes needed to store a value
+        static inline uint8_t byteWidth(size_t size);
+
+        // Reads a single index of the given byte width
+        static inline uint64_t readIndex(uint8_t* ptr, uint8_t width);
+
+        // Allocates the per vector pointers and tags for outerDim vectors
+        void allocateOuter();
+
+        // Frees every vector and the per vector pointers and tags
+        void freeData();
+
+        // Compression Algorithm for going from CSC to Hybrid
+        template <typename T2, typename indexT2>
+        void compressCSC(const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers,
+                         const indexT2* innerNonZeros = nullptr);
+
+        // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+        template <int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat);
+
+        // Encodes one vector in its smallest encoding from its entries sorted by index
+        void compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end);
+
+        // Calls visit(value, count) once per stored value of a vector
+        template <typename Visit>
+        inline void forEachRun(uint64_t vec, Visit visit);
+
+        // Calls visit(value) with a reference to each stored value of a vector
+        template <typename Visit>
+        inline void forEachValue(uint64_t vec, Visit visit);
+
+        // performs some simple user checks on the matrices metadata
+        void userChecks();
+
+        // Calculates the current byte size of the matrix in memory
+        void calculateCompSize();
+
+        // Scalar Multiplication
+        inline IVSparse::SparseMatrix<T, indexT, 4, columnMajor> scalarMultiply(T scalar);
+
+        // In Place Scalar Multiplication
+        inline void inPlaceScalarMultiply(T scalar);
+
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // helper for ostream operator
+        void print(std::ostream& stream);
+
+        public:
+
+        // Gets the number of rows in the matrix
+        uint64_t rows() const { return numRows; }
+
+        // Gets the number of columns in the matrix
+        uint64_t cols() const { return numCols; }
+
+        // Gets the inner dimension of the matrix
+        uint64_t innerSize() const { return innerDim; }
+
+        // Gets the outer dimension of the matrix
+        uint64_t outerSize() const { return outerDim; }
+
+        // Gets the number of non-zero elements in the matrix
+        uint64_t nonZeros() const { return nnz; }
+
+        // Gets the number of bytes needed to store the matrix
+        size_t byteSize() const { return compSize; }
+
+        //* Nested Subclasses *//
+
+        // The Iterator Class for Hybrid Matrices
+        class InnerIterator;
+
+        //* Constructors and Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Construct an empty IVSparse matrix \n \n
+          * The matrix will have 0 rows and 0 columns and
+          * will not be initialized with any values. All data
+          * will be set to nullptr.
+          */
+        SparseMatrix() {};
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor \n \n
+         * This constructor takes an Eigen Sparse Matrix and compresses each vector
+         * into its smallest encoding. The Eigen matrix is not modified, it may be
+         * in compressed or uncompressed mode.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T>& mat);
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Sparse Matrices.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+
+        /**
+         * @tparam compressionLevel2 The compression level of the IVSparse matrix to
+         * convert
+         * @param mat The IVSparse matrix to convert
+         *
+         * Converts a IVSparse matrix of any compression level to a Hybrid matrix
+         * of the same storage order, value and index type.
+         */
+        template <uint8_t compressionLevel2>
+        SparseMatrix(IVSparse::SparseMatrix<T, indexT, compressionLevel2, columnMajor>& other);
+
+        /**
+         * @param other The IVSparse matrix to be copied
+         *
+         * Deep Copy Constructor \n \n
+         * This constructor takes in a Hybrid matrix and creates a deep copy of it.
+         */
+        SparseMatrix(const IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& other);
+
+        /**
+         * Raw CSC Constructor \n \n
+         * This constructor takes in raw CSC storage format pointers and converts it
+         * to a Hybrid matrix.
+         */
+        template <typename T2, typename indexT2>
+        SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
+
+        /**
+         * @brief Destroy the Sparse Matrix object
+         */
+        ~SparseMatrix();
+
+        ///@}
+
+        //* Getters *//
+        /**
+         * @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns T The value at the specified row and column. Returns 0 if the
+          * value is not found.
+          *
+          * @note CSC and dense vectors are searched directly, VCSC and IVCSC
+          * vectors are scanned.
+          */
+        T coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @returns true If the matrix is stored in column major format
+         * @returns false If the matrix is stored in row major format
+         */
+        bool isColumnMajor() const;
+
+        /**
+         * @param vec The vector to get the encoding of
+         * @returns The encoding the vector is stored in.
+         */
+        IVSparse::HybridEncoding getEncoding(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to get the size of
+         * @returns The number of bytes the encoded vector takes.
+         */
+        size_t getVectorSize(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to traverse
+         * @param visit Called as visit(index, value) for every non-zero
+         *
+         * Visits the non-zeros of a vector with a loop specialized to its
+         * encoding. \n \n
+         * The encoding is only looked at once, which makes this the fastest way
+         * to read a whole vector. CSC and dense vectors are visited in index order
+         * and VCSC and IVCSC vectors grouped by value.
+         */
+        template <typename Visit>
+        inline void forEachEntry(uint64_t vec, Visit visit);
+
+        ///@}
+
+        //* Calculations *//
+        /**
+         * @name Calculations
+         */
+         ///@{
+
+         /**
+          * @tparam accumT The type the sums are accumulated in and returned as
+          * @returns A vector of the sum of each vector along the outer dimension.
+          */
+        template <typename accumT = T>
+        inline std::vector<accumT> outerSum();
+
+        /**
+         * @tparam accumT The type the sums are accumulated in and returned as
+         * @returns A vector of the sum of each vector along the inner dimension.
+         */
+        template <typename accumT = T>
+        inline std::vector<accumT> innerSum();
+
+        /**
+         * @tparam accumT The type the sum is accumulated in and returned as
+         * @returns The sum of all the values in the matrix.
+         */
+        template <typename accumT = T>
+        inline accumT sum();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns The frobenius norm of the matrix.
+         */
+        template <typename accumT = double>
+        inline accumT norm();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns Returns the length of the specified vector.
+         */
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        ///@}
+
+        //* Utility Methods *//
+        /**
+         * @name Utility Methods
+         */
+         ///@{
+
+         /**
+          * Prints "IVSparse Matrix:" followed by the dense representation of the
+          * matrix to the console.
+          *
+          * @note Useful for debugging but only goes up to 100 of either dimension.
+          */
+        void print();
+
+        /**
+         * @returns An Eigen Sparse Matrix constructed from the Hybrid matrix data.
+         */
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> toEigen();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        friend std::ostream& operator<< (std::ostream& stream, IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& mat) {
+            mat.print(stream);
+            return stream;
+        }
+
+        // Assignment Operator
+        IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& operator=(const IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& other);
+
+        // Equality Operator
+        bool operator==(const SparseMatrix<T, indexT, 4, columnMajor>& other) const;
+
+        // Inequality Operator
+        bool operator!=(const SparseMatrix<T, indexT, 4, columnMajor>& other);
+
+        // Coefficient Access Operator
+        T operator()(uint64_t row, uint64_t col);
+
+        // Scalar Multiplication
+        IVSparse::SparseMatrix<T, indexT, 4, columnMajor> operator*(T scalar);
+
+        // In Place Scalar Multiplication
+        void operator*=(T scalar);
+
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1>& mat);
+
+    };  // End of Hybrid Sparse Matrix Class
+
+}  // namespace IVSparse
@@ -18,15 +18,13 @@ namespace IVSparse {
         // Deep copy the matrix
         IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> newMatrix(*this);
 
-        // else use the iterator
+        // each run value is scaled once, the indices are never decoded
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (uint32_t i = 0; i < this->outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(newMatrix, i); it; ++it) {
-                if (it.isNewRun()) {
-                    it.coeff(it.value() * scalar);
-                }
+        for (uint64_t i = 0; i < this->outerDim; ++i) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(newMatrix, i); it; ++it) {
+                it.coeff(it.value() * scalar);
             }
         }
         return newMatrix;
@@ -36,179 +34,320 @@ namespace IVSparse {
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::inPlaceScalarMultiply(T scalar) {
 
-        // else use the iterator
+        // each run value is scaled once, the indices are never decoded
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                if (it.isNewRun()) {
-                    it.coeff(it.value() * scalar);
-                }
+        for (uint64_t i = 0; i < outerDim; ++i) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                it.coeff(it.value() * scalar);
             }
         }
     }
 
     //* BLAS Level 2 Routines *//
 
-    // Matrix Vector Multiplication (Eigen::VectorXd * IVSparse::SparseMatrix)
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorMultiply(Eigen::Matrix<T, -1, 1>& vec) {
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
 
         #ifdef IVSPARSE_DEBUG
         // check that the vector is the correct size
-        assert(vec.rows() == outerDim &&
+        assert((uint64_t)vec.rows() == numCols &&
                "The vector must be the same size as the number of columns in the "
                "matrix!");
         #endif
 
-        Eigen::Matrix<T, -1, 1> eigenTemp = Eigen::Matrix<T, -1, 1>::Zero(innerDim, 1);
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
 
-        // iterate over the vector and multiply the corresponding row of the matrix by the vecIter value
+        if constexpr (columnMajor) {
+            // scatter each column scaled by its vector entry, each run is only scaled once
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                if (vec(i) == 0) return;
 
-        for (uint32_t i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 3, columnMajor>::InnerIterator matIter(*this, i); matIter; ++matIter) {
-                eigenTemp(matIter.row()) += vec(matIter.col()) * matIter.value();
+                accumT scaled = 0;
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                    if (it.isNewRun()) { scaled = static_cast<accumT>(it.value()) * vec(i); }
+                    buffer[it.getIndex()] += scaled;
+                }
+            });
+        }
+        else {
+            // each row is an independent dot product, the value of a run is factored out of its entries
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0, runValue = 0, runSum = 0;
+
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                    if (it.isNewRun()) {
+                        rowSum += runValue * runSum;
+                        runValue = static_cast<accumT>(it.value());
+                        runSum = 0;
+                    }
+                    runSum += vec(it.getIndex());
+                }
+                eigenTemp(i) = rowSum + runValue * runSum;
             }
         }
         return eigenTemp;
     }
 
-    // Matrix Vector Multiplication (IVSparse::SparseMatrix::Vector *
-    // IVSparse::SparseMatrix)
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * IVSparse::SparseMatrix::Vector)
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorMultiply(
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorMultiply(
         typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector& vec) {
 
         #ifdef IVSPARSE_DEBUG
-        if (vec.length() != outerDim)
+        if (vec.getLength() != numCols)
             throw std::invalid_argument(
                 "The vector must be the same size as the number of columns in the "
                 "matrix!");
         #endif
 
-        Eigen::Matrix<T, -1, 1> eigenTemp = Eigen::Matrix<T, -1, 1>::Zero(innerDim, 1);
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
 
-        for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator vecIter(vec);
-             vecIter; ++vecIter) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator matIter(*this, vecIter.row());
-                 matIter; ++matIter) {
-                eigenTemp(matIter.row()) += matIter.value() * vecIter.value();
+        if constexpr (columnMajor) {
+            // only the columns matching a non-zero of the vector are scattered
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+                accumT scaled = 0;
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator matIter(*this, vecIter.getIndex()); matIter; ++matIter) {
+                    if (matIter.isNewRun()) { scaled = static_cast<accumT>(matIter.value()) * vecIter.value(); }
+                    eigenTemp(matIter.getIndex()) += scaled;
+                }
+            }
+        }
+        else {
+            // the rows gather from the vector, so it is made dense first
+            Eigen::Matrix<accumT, -1, 1> dense = Eigen::Matrix<accumT, -1, 1>::Zero(numCols, 1);
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+                dense(vecIter.getIndex()) = vecIter.value();
             }
+            eigenTemp = vectorMultiply(dense);
         }
         return eigenTemp;
     }
 
     //* BLAS Level 3 Routines *//
-    // Matrix multiplication has been moved to the IVCSC_Operator.hpp file
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and scatters the whole matrix into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+                Eigen::Matrix<accumT, -1, 1> scaled(length);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                        if (it.isNewRun()) { scaled = matTranspose.col(i).segment(start, length) * static_cast<accumT>(it.value()); }
+                        newMatrix.col(it.getIndex()).segment(start, length) += scaled;
+                    }
+                }
+            }
+        }
+        else {
+            // each row of the result only reads the rows of mat it touches, runs are scaled once
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                Eigen::Matrix<accumT, -1, 1> runSum = Eigen::Matrix<accumT, -1, 1>::Zero(width);
+                accumT runValue = 0;
+
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                    if (it.isNewRun()) {
+                        newMatrix.col(i) += runSum * runValue;
+                        runValue = static_cast<accumT>(it.value());
+                        runSum.setZero();
+                    }
+                    runSum += matTranspose.col(it.getIndex());
+                }
+                newMatrix.col(i) += runSum * runValue;
+            }
+        }
+        return newMatrix.transpose();
+    }
 
     //* Other Matrix Calculations *//
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::outerSum() {
-        std::vector<T> outerSum = std::vector<T>(outerDim);
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, compressionLevel, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                outerSum[i] += it.value();
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            // only multiply once per run
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                outerSum[i] += static_cast<accumT>(it.value()) * it.runLength();
             }
         }
         return outerSum;
     }
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::innerSum() {
-        std::vector<T> innerSum = std::vector<T>(innerDim);
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, compressionLevel, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
 
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                innerSum[it.row()] += it.value();
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                buffer[it.getIndex()] += static_cast<accumT>(it.value());
             }
-        }
+        });
         return innerSum;
     }
 
+    // Finds the maximum value in each column
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::maxColCoeff() {
+        if constexpr (columnMajor) { return outerExtremes<true>(nullptr); }
+        else { return innerExtremes<true>(nullptr); }
+    }
 
-        std::vector<T> maxCoeff = std::vector<T>(innerDim);
-
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                if (it.value() > maxCoeff[i]) {
-                    maxCoeff[i] = it.value();
-                }
-            }
-        }
-        return maxCoeff;
+    // Finds the maximum value and its row in each column
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::maxColCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return outerExtremes<true>(&indices); }
+        else { return innerExtremes<true>(&indices); }
     }
 
+    // Finds the maximum value in each row
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::maxRowCoeff() {
+        if constexpr (columnMajor) { return innerExtremes<true>(nullptr); }
+        else { return outerExtremes<true>(nullptr); }
+    }
 
-        std::vector<T> maxCoeff = std::vector<T>(innerDim);
-
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                if (it.value() > maxCoeff[it.row()]) {
-                    maxCoeff[it.row()] = it.value();
-                }
-            }
-        }
-        return maxCoeff;
+    // Finds the maximum value and its column in each row
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::maxRowCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return innerExtremes<true>(&indices); }
+        else { return outerExtremes<true>(&indices); }
     }
 
+    // Finds the minimum value in each column
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::minColCoeff() {
+        if constexpr (columnMajor) { return outerExtremes<false>(nullptr); }
+        else { return innerExtremes<false>(nullptr); }
+    }
 
-        std::vector<T> minCoeff = std::vector<T>(innerDim);
-
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                if (it.value() < minCoeff[i]) {
-                    minCoeff[i] = it.value();
-                }
-            }
-        }
-        return minCoeff;
+    // Finds the minimum value and its row in each column
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::minColCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return outerExtremes<false>(&indices); }
+        else { return innerExtremes<false>(&indices); }
     }
 
+    // Finds the minimum value in each row
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::minRowCoeff() {
-        std::vector<T> minCoeff = std::vector<T>(innerDim);
-        memset(minCoeff.data(), 0xF, innerDim * sizeof(T));
+        if constexpr (columnMajor) { return innerExtremes<false>(nullptr); }
+        else { return outerExtremes<false>(nullptr); }
+    }
+
+    // Finds the minimum value and its column in each row
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::minRowCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return innerExtremes<false>(&indices); }
+        else { return outerExtremes<false>(&indices); }
+    }
+
+    // Minimum or maximum of each outer vector, only reading the head of each run
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <bool isMax>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::outerExtremes(std::vector<uint64_t>* indices) {
+        std::vector<T> result(outerDim);
+        if (indices != nullptr) { indices->assign(outerDim, 0); }
 
         #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic, 64)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                if (it.value() < minCoeff[it.row()]) {
-                    minCoeff[it.row()] = it.value();
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            bool found = false;
+            T value = 0;
+            uint64_t index = 0, count = 0;
+
+            uint8_t* run = (uint8_t*)data[i];
+            while (run != nullptr && run < (uint8_t*)endPointers[i]) {
+                T runValue = *(T*)run;
+                uint8_t width = *(run + sizeof(T));
+                uint8_t* runIndices = run + sizeof(T) + 1;
+                uint64_t length;
+
+                run = skipRun(runIndices, width, length);
+                count += length;
+
+                // the first index of a run is its smallest
+                uint64_t first = readIndex(runIndices, width);
+                if (!found || (isMax ? runValue > value : runValue < value) || (runValue == value && first < index)) {
+                    value = runValue;
+                    index = first;
+                    found = true;
+                }
+            }
+
+            // compare against the implicit zeros
+            if (count < innerDim && (!found || (isMax ? value < 0 : value > 0))) {
+                value = 0;
+
+                if (indices != nullptr) {
+                    std::vector<uint64_t> stored;
+                    stored.reserve(count);
+                    for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                        stored.push_back(it.getIndex());
+                    }
+                    std::sort(stored.begin(), stored.end());
+
+                    index = 0;
+                    while (index < stored.size() && stored[index] == index) { index++; }
                 }
             }
+
+            result[i] = value;
+            if (indices != nullptr) { (*indices)[i] = index; }
         }
-        return minCoeff;
+        return result;
+    }
+
+    // Minimum or maximum of each inner vector
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <bool isMax>
+    inline std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::innerExtremes(std::vector<uint64_t>* indices) {
+        return IVSparse::blockedInnerExtremes<T, isMax>(outerDim, innerDim, indices, [this](uint64_t vec, auto&& visit) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, vec); it; ++it) {
+                visit(it.getIndex(), it.value());
+            }
+        });
     }
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
@@ -219,64 +358,169 @@ namespace IVSparse {
         #endif
 
         T trace = 0;
-        for (int i = 0; i < outerDim; i++) {
+
+        // the diagonal is where the inner index matches the outer index in either storage order
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for reduction(+ : trace)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
             for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                if (it.row() == i) {
+                if (it.getIndex() == i) {
                     trace += it.value();
                 }
-                else if (it.row() > i) {
-                    continue;
-                }
             }
         }
         return trace;
     }
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline T SparseMatrix<T, indexT, compressionLevel, columnMajor>::sum() {
-        T sum = 0;
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, compressionLevel, columnMajor>::sum() {
+        accumT sum = 0;
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : sum)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                sum += it.value();
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                sum += static_cast<accumT>(it.value()) * it.runLength();
             }
         }
         return sum;
     }
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline double SparseMatrix<T, indexT, compressionLevel, columnMajor>::norm() {
-        double norm = 0;
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, compressionLevel, columnMajor>::norm() {
+        accumT norm = 0;
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : norm)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);
-                 it; ++it) {
-                norm += it.value() * it.value();
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                norm += static_cast<accumT>(it.value()) * static_cast<accumT>(it.value()) * it.runLength();
             }
         }
         return sqrt(norm);
     }
 
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline double SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorLength(uint32_t col) {
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorLength(uint64_t col) {
 
         #ifdef IVSPARSE_DEBUG
         assert(col < outerDim && col >= 0 && "The column index is out of bounds!");
         #endif
 
-        double norm = 0;
+        accumT norm = 0;
 
-        for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, col);
-             it; ++it) {
-            norm += it.value() * it.value();
+        for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, col); it; ++it) {
+            norm += static_cast<accumT>(it.value()) * static_cast<accumT>(it.value()) * it.runLength();
         }
         return sqrt(norm);
     }
 
-}  // namespace IVSparse
\ No newline at end of file
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, compressionLevel, columnMajor>::columnStats() {
+        if constexpr (columnMajor) { return outerStats(); }
+        else { return innerStats(); }
+    }
+
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, compressionLevel, columnMajor>::rowStats() {
+        if constexpr (columnMajor) { return innerStats(); }
+        else { return outerStats(); }
+    }
+
+    // Statistics of each outer vector, accumulated once per run
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, compressionLevel, columnMajor>::outerStats() {
+        IVSparse::SummaryStats stats(outerDim);
+        std::vector<IVSparse::Moments> moments(outerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            double sum = 0, sumSq = 0;
+
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                double value = static_cast<double>(it.value());
+                sum += value * it.runLength();
+                sumSq += value * value * it.runLength();
+                moments[i].add(value, it.runLength());
+            }
+
+            stats.sum[i] = sum;
+            stats.sumSq[i] = sumSq;
+        }
+
+        stats.finalize(moments, innerDim);
+        return stats;
+    }
+
+    // Statistics of each inner vector
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, compressionLevel, columnMajor>::innerStats() {
+        IVSparse::SummaryStats stats(innerDim);
+
+        IVSparse::blockedInnerStats(outerDim, innerDim, stats, [this](uint64_t vec, double* sum, double* sumSq, IVSparse::Moments* moments) {
+            double value = 0, square = 0;
+
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, vec); it; ++it) {
+                if (it.isNewRun()) {
+                    value = static_cast<double>(it.value());
+                    square = value * value;
+                }
+                sum[it.getIndex()] += value;
+                sumSq[it.getIndex()] += square;
+                moments[it.getIndex()].add(value);
+            }
+        });
+
+        return stats;
+    }
+
+    // Histogram of a vector read from its runs
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline std::vector<std::pair<T, uint64_t>> SparseMatrix<T, indexT, compressionLevel, columnMajor>::valueHistogram(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "The vector index is out of bounds!");
+        #endif
+
+        std::vector<std::pair<T, uint64_t>> histogram;
+
+        for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, vec); it; ++it) {
+            histogram.emplace_back(it.value(), it.runLength());
+        }
+
+        // values are only sorted until they are modified in place
+        std::sort(histogram.begin(), histogram.end());
+        return histogram;
+    }
+
+    // Number of distinct values in the matrix
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::uniqueValueCount() {
+        return IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }).size();
+    }
+
+    // Average redundancy of the vectors from their runs
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline double SparseMatrix<T, indexT, compressionLevel, columnMajor>::redundancy() {
+        return IVSparse::averageRedundancy(outerDim, [this](uint64_t i, uint64_t& unique, uint64_t& nnz) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this, i); it; ++it) {
+                unique++;
+                nnz += it.runLength();
+            }
+        });
+    }
+
+    // Shannon entropy of the values
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline double SparseMatrix<T, indexT, compressionLevel, columnMajor>::entropy() {
+        return IVSparse::valueEntropy(IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }));
+    }
+}  // namespace IVSparse
@@ -35,7 +35,7 @@ namespace IVSparse {
 
     // Row and Column Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(uint32_t num_rows, uint32_t num_cols) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(uint64_t num_rows, uint64_t num_cols) {
 
         #ifdef IVSPARSE_DEBUG
         // check that the number of rows and columns is greater than 0
@@ -74,7 +74,7 @@ namespace IVSparse {
         }
 
         // set the metadata
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = compressionLevel;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
@@ -93,7 +93,7 @@ namespace IVSparse {
 
     // Eigen Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T>& mat) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T>& mat) {
 
         // check if the matrix is empty
         if (mat.nonZeros() == 0) {
@@ -106,26 +106,13 @@ namespace IVSparse {
             return;
         }
 
-        // make sure the matrix is compressed
-        mat.makeCompressed();
-
-        // get the number of rows and columns
-        numRows = mat.rows();
-        numCols = mat.cols();
-
-        outerDim = columnMajor ? numCols : numRows;
-        innerDim = columnMajor ? numRows : numCols;
-
-        // get the number of non-zero elements
-        nnz = mat.nonZeros();
-
-        // call the compression function
-        compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr());
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
     }
 
     // Eigen Row Major Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T, Eigen::RowMajor>& mat) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat) {
 
         // check if the matrix is empty
         if (mat.nonZeros() == 0) {
@@ -138,21 +125,20 @@ namespace IVSparse {
             return;
         }
 
-        // make sure the matrix is compressed
-        mat.makeCompressed();
-
-        // get the number of rows and columns
-        numRows = mat.rows();
-        numCols = mat.cols();
-
-        outerDim = numRows;
-        innerDim = numCols;
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
+    }
 
-        // get the number of non-zero elements
-        nnz = mat.nonZeros();
+    // Eigen Dense Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1>& mat, T epsilon) {
+        compressDense(mat, epsilon);
+    }
 
-        // call the compression function
-        compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr());
+    // Eigen Dense Row Major Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1, Eigen::RowMajor>& mat, T epsilon) {
+        compressDense(mat, epsilon);
     }
 
     // Deep Copy Constructor
@@ -196,7 +182,7 @@ namespace IVSparse {
     // Raw CSC Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     template <typename T2, typename indexT2>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint32_t num_rows, uint32_t num_cols, uint32_t nnz) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
 
         #ifdef IVSPARSE_DEBUG
         assert(num_rows > 0 && num_cols > 0 &&
@@ -234,7 +220,7 @@ namespace IVSparse {
     // COO Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     template <typename T2, typename indexT2>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint32_t num_cols, uint32_t nnz) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
 
 
         #ifdef IVSPARSE_DEBUG
@@ -265,7 +251,7 @@ namespace IVSparse {
             encodeValueType();
             index_t = sizeof(indexT);
 
-            metadata = new uint32_t[NUM_META_DATA];
+            metadata = new uint64_t[NUM_META_DATA];
             metadata[0] = compressionLevel;
             metadata[1] = innerDim;
             metadata[2] = outerDim;
@@ -337,7 +323,7 @@ namespace IVSparse {
             #ifdef IVSPARSE_HAS_OPENMP
             #pragma omp parallel for
             #endif
-            for (uint32_t i = 0; i < outerDim; i++) {
+            for (uint64_t i = 0; i < outerDim; i++) {
                 size_t outerByteSize = 0;
 
                 for (auto& pair : maps[i]) {
@@ -490,7 +476,7 @@ namespace IVSparse {
         if (vec.begin() != vec.end()) memcpy(data[0], vec.begin(), vec.byteSize());
 
         // set the metadata
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = compressionLevel;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
@@ -509,17 +495,61 @@ namespace IVSparse {
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(std::vector<typename IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector>& vecs) {
 
-        IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> temp(vecs[0]);
-
+        #ifdef IVSPARSE_DEBUG
+        assert(vecs.size() > 0 && "Cannot construct a matrix from no vectors");
         for (size_t i = 1; i < vecs.size(); i++) {
-            temp.append(vecs[i]);
+            assert(vecs[i].getLength() == vecs[0].getLength() && "All vectors must be the same length");
         }
+        #endif
 
-        *this = temp;
+        // Get the dimensions and metadata
+        innerDim = vecs[0].getLength();
+        outerDim = vecs.size();
+        numRows = columnMajor ? innerDim : outerDim;
+        numCols = columnMajor ? outerDim : innerDim;
 
-        calculateCompSize();
+        nnz = 0;
+        for (size_t i = 0; i < vecs.size(); i++) { nnz += vecs[i].nonZeros(); }
 
-        // run the user checks
+        encodeValueType();
+        index_t = sizeof(indexT);
+
+        metadata = new uint64_t[NUM_META_DATA];
+        metadata[0] = compressionLevel;
+        metadata[1] = innerDim;
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+        metadata[4] = val_t;
+        metadata[5] = index_t;
+
+        // malloc the data
+        try {
+            data = (void**)malloc(outerDim * sizeof(void*));
+            endPointers = (void**)malloc(outerDim * sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+
+        // each vector is copied into its own slot once, with no intermediate matrices
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for
+        #endif
+        for (uint64_t i = 0; i < outerDim; i++) {
+            // if vector is empty set the data to null
+            if (vecs[i].begin() == vecs[i].end()) {
+                data[i] = nullptr;
+                endPointers[i] = nullptr;
+                continue;
+            }
+
+            data[i] = malloc(vecs[i].byteSize());
+            endPointers[i] = (char*)data[i] + vecs[i].byteSize();
+            memcpy(data[i], vecs[i].begin(), vecs[i].byteSize());
+        }
+
+        // run the user checks and calculate the compression size
+        calculateCompSize();
         #ifdef IVSPARSE_DEBUG
         userChecks();
         #endif
@@ -538,8 +568,8 @@ namespace IVSparse {
         #endif
 
         // read the metadata
-        metadata = new uint32_t[NUM_META_DATA];
-        if(fread(metadata, sizeof(uint32_t), NUM_META_DATA, fp) == 0) [[unlikely]] {
+        metadata = new uint64_t[NUM_META_DATA];
+        if (!IVSparse::readMetadata(fp, metadata)) [[unlikely]] {
             throw std::runtime_error("Error: Could not read file");
         }
 
@@ -625,7 +655,7 @@ namespace IVSparse {
 
     // Private Tranpose Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(std::unordered_map<T, std::vector<indexT>>* maps, uint32_t num_rows, uint32_t num_cols) {
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::SparseMatrix(std::vector<uint64_t>& offsets, std::vector<std::pair<T, indexT>>& entries, uint64_t num_rows, uint64_t num_cols) {
 
         // set class variables
         if constexpr (columnMajor) {
@@ -639,6 +669,7 @@ namespace IVSparse {
 
         numRows = num_cols;
         numCols = num_rows;
+        nnz = entries.size();
         encodeValueType();
         index_t = sizeof(indexT);
 
@@ -647,130 +678,19 @@ namespace IVSparse {
             data = (void**)malloc(outerDim * sizeof(void*));
             endPointers = (void**)malloc(outerDim * sizeof(void*));
         }
-        catch (const std::exception& e) {
-            std::cerr << e.what() << '\n';
-        }
-
-        // set all data and endpointers to the nullptr
-        for (size_t i = 0; i < outerDim; i++) {
-            data[i] = nullptr;
-            endPointers[i] = nullptr;
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
         }
 
-        //* logic here
-
-        // loop through the array
+        // each vector is encoded straight from its sorted entries
         #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic, 64)
         #endif
-        for (size_t i = 0; i < outerDim; i++) {
-            // check if the column is empty
-            if (maps[i].empty()) [[unlikely]] {
-                data[i] = nullptr;
-                endPointers[i] = nullptr;
-                continue;
-            }
-
-            size_t byteSize = 0;
-
-            // loop through the vectors of the map
-            for (auto& val : maps[i]) {
-                // add the size of the vector to the byteSize
-                byteSize += sizeof(T) + 1 +
-                    (val.second[val.second.size() - 1] * (val.second.size() - 1) +
-                     val.second[val.second.size() - 1]);
-            }
-
-            // allocate memory for the vector
-            try {
-                data[i] = malloc(byteSize);
-            }
-            catch (const std::exception& e) {
-                std::cerr << e.what() << '\n';
-            }
-
-            // set the end pointer
-            endPointers[i] = (char*)data[i] + byteSize;
-
-            // compressCSC the column
-            void* helpPtr = data[i];
-
-            for (auto& val : maps[i]) {
-                nnz += val.second.size() - 1;
-
-                // set the value
-                *(T*)helpPtr = val.first;
-                helpPtr = (char*)helpPtr + sizeof(T);
-                *(uint8_t*)helpPtr = (uint8_t)val.second[val.second.size() - 1];
-                helpPtr = (uint8_t*)helpPtr + 1;
-
-                // write the indices
-                for (size_t k = 0; k < val.second.size(); k++) {
-                    if (k == val.second.size() - 1) break;
-
-                    switch (val.second[val.second.size() - 1]) {
-                    case 1:
-                        *(uint8_t*)helpPtr = (uint8_t)val.second[k];
-                        helpPtr = (uint8_t*)helpPtr + 1;
-                        break;
-                    case 2:
-                        *(uint16_t*)helpPtr = (uint16_t)val.second[k];
-                        helpPtr = (uint16_t*)helpPtr + 1;
-                        break;
-                    case 3:
-                        *(uint32_t*)helpPtr = (uint32_t)val.second[k] & 0xFFFFFF;
-                        helpPtr = (uint8_t*)helpPtr + 3;
-                        break;
-                    case 4:
-                        *(uint32_t*)helpPtr = (uint32_t)val.second[k];
-                        helpPtr = (uint32_t*)helpPtr + 1;
-                        break;
-                    case 5:
-                        *(uint64_t*)helpPtr = (uint64_t)val.second[k] & 0xFFFFFFFFFF;
-                        helpPtr = (uint8_t*)helpPtr + 5;
-                        break;
-                    case 6:
-                        *(uint64_t*)helpPtr = (uint64_t)val.second[k] & 0xFFFFFFFFFFFF;
-                        helpPtr = (uint8_t*)helpPtr + 6;
-                        break;
-                    case 7:
-                        *(uint64_t*)helpPtr = (uint64_t)val.second[k] & 0xFFFFFFFFFFFFFF;
-                        helpPtr = (uint8_t*)helpPtr + 7;
-                        break;
-                    case 8:
-                        *(uint64_t*)helpPtr = (uint64_t)val.second[k];
-                        helpPtr = (uint64_t*)helpPtr + 1;
-                        break;
-                    }
-                }
-
-                // write a delimiter of the correct width
-                // switch (val.second[val.second.size() - 1]) {
-                // case 1:
-                //     *(uint8_t*)helpPtr = (uint8_t)DELIM;
-                //     helpPtr = (uint8_t*)helpPtr + 1;
-                //     break;
-                // case 2:
-                //     *(uint16_t*)helpPtr = (uint16_t)DELIM;
-                //     helpPtr = (uint16_t*)helpPtr + 1;
-                //     break;
-                // case 4:
-                //     *(uint32_t*)helpPtr = (uint32_t)DELIM;
-                //     helpPtr = (uint32_t*)helpPtr + 1;
-                //     break;
-                // case 8:
-                //     *(uint64_t*)helpPtr = (uint64_t)DELIM;
-                //     helpPtr = (uint64_t*)helpPtr + 1;
-                //     break;
-                // }
-                memset(helpPtr, 0, val.second[val.second.size() - 1]);
-                helpPtr = (uint8_t*)helpPtr + val.second[val.second.size() - 1];
-            }
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            compressVector(i, entries.data() + offsets[i], entries.data() + offsets[i + 1]);
         }
 
-        //* end logic
-
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
 
         // Set the meta data
         metadata[0] = compressionLevel;
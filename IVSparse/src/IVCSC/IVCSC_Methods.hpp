@@ -14,7 +14,7 @@ namespace IVSparse {
 
     // Gets the element stored at the given row and column
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    T SparseMatrix<T, indexT, compressionLevel, columnMajor>::coeff(uint32_t row, uint32_t col) {
+    T SparseMatrix<T, indexT, compressionLevel, columnMajor>::coeff(uint64_t row, uint64_t col) {
 
         #ifdef IVSPARSE_DEBUG
         // check that the row and column are valid
@@ -25,6 +25,34 @@ namespace IVSparse {
         return (*this)(row, col);
     }
 
+    // Gets the values at many (row, col) pairs
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::gather(const uint64_t* rows, const uint64_t* cols, T* out, size_t n) {
+        const uint64_t* outer = columnMajor ? cols : rows;
+        const uint64_t* inner = columnMajor ? rows : cols;
+
+        // search the lookup table when one is kept, otherwise decode each vector once
+        IVSparse::gatherGrouped<T>(outerDim, innerDim, outer, inner, out, n, !lookupIndices.empty(),
+            [this](uint64_t vec, auto&& visit) {
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, vec); it; ++it) {
+                    visit(it.getIndex(), it.value());
+                }
+            },
+            [this](uint64_t vec, uint64_t index) { return lookupCoeff(vec, index); });
+    }
+
+    // Gets the values at many (row, col) pairs
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    std::vector<T> SparseMatrix<T, indexT, compressionLevel, columnMajor>::gather(const std::vector<uint64_t>& rows, const std::vector<uint64_t>& cols) {
+        #ifdef IVSPARSE_DEBUG
+        assert(rows.size() == cols.size() && "Rows and columns must be the same length!");
+        #endif
+
+        std::vector<T> out(rows.size());
+        gather(rows.data(), cols.data(), out.data(), rows.size());
+        return out;
+    }
+
     // Check for Column Major
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     bool SparseMatrix<T, indexT, compressionLevel, columnMajor>::isColumnMajor() const {
@@ -33,7 +61,7 @@ namespace IVSparse {
 
     // Returns a pointer to the given vector
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    void* SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorPointer(uint32_t vec) {
+    void* SparseMatrix<T, indexT, compressionLevel, columnMajor>::vectorPointer(uint64_t vec) {
 
         #ifdef IVSPARSE_DEBUG
         assert(vec < outerDim && vec >= 0 && "Invalid vector!");
@@ -44,7 +72,7 @@ namespace IVSparse {
 
     // Gets a IVSparse vector copy of the given vector
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector SparseMatrix<T, indexT, compressionLevel, columnMajor>::getVector(uint32_t vec) {
+    typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector SparseMatrix<T, indexT, compressionLevel, columnMajor>::getVector(uint64_t vec) {
         #ifdef IVSPARSE_DEBUG
         assert(vec < outerDim && vec >= 0 && "Invalid vector!");
         #endif
@@ -52,9 +80,15 @@ namespace IVSparse {
         return (*this)[vec];
     }
 
+    // Gets a view of a vector of the matrix
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView SparseMatrix<T, indexT, compressionLevel, columnMajor>::getVectorView(uint64_t vec) {
+        return typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView(*this, vec);
+    }
+
     // Gets the byte size of a given vector
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    size_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::getVectorSize(uint32_t vec) const {
+    size_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::getVectorSize(uint64_t vec) const {
         #ifdef IVSPARSE_DEBUG
         assert(vec < outerDim && vec >= 0 && "Invalid vector!");
         #endif
@@ -75,16 +109,16 @@ namespace IVSparse {
         FILE* fp = fopen(filename, "wb+");
 
         // Write the metadata
-        fwrite(metadata, 1, NUM_META_DATA * sizeof(uint32_t), fp);
+        IVSparse::writeMetadata(fp, metadata);
 
         // write the size of each vector
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (uint64_t i = 0; i < outerDim; i++) {
             uint64_t size = (uint8_t*)endPointers[i] - (uint8_t*)data[i];
             fwrite(&size, 1, sizeof(uint64_t), fp);
         }
 
         // write each vector
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (uint64_t i = 0; i < outerDim; i++) {
             fwrite(data[i], 1, (char*)endPointers[i] - (char*)data[i], fp);
         }
 
@@ -95,31 +129,41 @@ namespace IVSparse {
     // Prints the matrix dense to console
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     void SparseMatrix<T, indexT, compressionLevel, columnMajor>::print() {
+        print(std::cout);
+    }
+
+    // Builds the random access lookup table
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::buildLookupTable(bool lazy) {
+        lookupIndices.resize(outerDim);
+        lookupRuns.resize(outerDim);
 
-        std::cout << std::endl;
-        std::cout << "IVSparse Matrix" << std::endl;
+        if (lazy) return;
 
-        // if the matrix is less than 100 rows and columns print the whole thing
-        if (numRows < 100 && numCols < 100) {
-            // print the matrix
-            for (uint32_t i = 0; i < numRows; i++) {
-                for (uint32_t j = 0; j < numCols; j++) {
-                    std::cout << coeff(i, j) << " ";
-                }
-                std::cout << std::endl;
-            }
-        }
-        else if (numRows > 100 && numCols > 100) {
-            // print the first 100 rows and columns
-            for (uint32_t i = 0; i < 100; i++) {
-                for (uint32_t j = 0; j < 100; j++) {
-                    std::cout << coeff(i, j) << " ";
-                }
-                std::cout << std::endl;
-            }
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            if (lookupIndices[i].empty()) { buildLookup(i); }
         }
+    }
 
-        std::cout << std::endl;
+    // Frees the random access lookup table
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::dropLookupTable() {
+        std::vector<std::vector<indexT>>().swap(lookupIndices);
+        std::vector<std::vector<uint64_t>>().swap(lookupRuns);
+    }
+
+    // Gets the byte size of the random access lookup table
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    size_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::lookupTableSize() const {
+        size_t size = lookupIndices.capacity() * sizeof(std::vector<indexT>) + lookupRuns.capacity() * sizeof(std::vector<uint64_t>);
+
+        for (size_t i = 0; i < lookupIndices.size(); i++) {
+            size += lookupIndices[i].capacity() * sizeof(indexT) + lookupRuns[i].capacity() * sizeof(uint64_t);
+        }
+        return size;
     }
 
     // Convert a IVCSC matrix to CSC
@@ -130,7 +174,7 @@ namespace IVSparse {
         Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
 
         // iterate over the matrix
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i);it; ++it) {
                 // add the value to the matrix
                 eigenMatrix.insert(it.row(), it.col()) = it.value();
@@ -168,7 +212,7 @@ namespace IVSparse {
         std::map<indexT, T> dict[outerDim];
 
         // iterate through the data using the iterator
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             size_t count = 0;
 
             for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(
@@ -184,7 +228,7 @@ namespace IVSparse {
         size_t count = 0;
 
         // loop through the dictionary and populate values and indices
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             for (auto& pair : dict[i]) {
                 values[count] = pair.second;
                 indices[count] = pair.first;
@@ -216,7 +260,7 @@ namespace IVSparse {
         Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
 
         // iterate over the matrix
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             // check if the vector is empty
             if (data[i] == nullptr) {
                 continue;
@@ -245,10 +289,38 @@ namespace IVSparse {
         assert(mat.innerDim == innerDim && "Vector must be the same size as the inner dimension!");
         #endif
 
-        uint32_t oldOuterDim = outerDim;
+        // sizes of the other matrix are taken first as it may be this matrix
+        uint64_t oldOuterDim = outerDim;
+        uint64_t appendedDim = mat.outerDim;
+        uint64_t appendedNnz = mat.nnz;
+        size_t appendedSize = mat.compSize;
+
+        // make room for the new vectors, growing geometrically
+        growOuter(oldOuterDim + appendedDim);
+
+        // deep copy the data
+        for (uint64_t i = 0; i < appendedDim; ++i) {
+            // if the vector is empty, set the data pointer to nullptr
+            if (mat.data[i] == nullptr) {
+                data[oldOuterDim + i] = nullptr;
+                endPointers[oldOuterDim + i] = nullptr;
+                continue;
+            }
+
+            try {
+                data[oldOuterDim + i] = malloc(mat.getVectorSize(i));
+                endPointers[oldOuterDim + i] = (char*)data[oldOuterDim + i] + mat.getVectorSize(i);
+            }
+            catch (std::bad_alloc& e) {
+                throw std::bad_alloc();
+            }
+
+            // copy the vector
+            memcpy(data[oldOuterDim + i], mat.data[i], mat.getVectorSize(i));
+        }
 
         // update the outer dimension
-        outerDim += mat.outerDim;
+        outerDim += appendedDim;
         if (columnMajor) {
             numCols = outerDim;
         }
@@ -256,38 +328,91 @@ namespace IVSparse {
             numRows = outerDim;
         }
 
-        // update the number of nonzeros
-        nnz += mat.nnz;
+        // update the number of nonzeros and the size without rescanning every vector
+        nnz += appendedNnz;
+        compSize += appendedSize;
 
         // update the metadata
         metadata[2] = outerDim;
         metadata[3] = nnz;
 
-        // reallocate the data
-        try {
-            data = (void**)realloc(data, outerDim * sizeof(void*));
-            endPointers = (void**)realloc(endPointers, outerDim * sizeof(void*));
+        // new vectors are added to the lookup table the first time they are read
+        if (!lookupIndices.empty()) {
+            lookupIndices.resize(outerDim);
+            lookupRuns.resize(outerDim);
         }
-        catch (std::bad_alloc& e) {
-            throw std::bad_alloc();
+    }
+
+    // appends a matrix by taking its vectors, leaving it with an outer dimension of zero
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::appendMove(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(mat.innerDim == innerDim && "Vector must be the same size as the inner dimension!");
+        assert(&mat != this && "A matrix cannot be moved onto itself!");
+        #endif
+
+        growOuter(outerDim + mat.outerDim);
+
+        // the vector buffers change owner, only the pointers are copied
+        if (mat.outerDim > 0) {
+            memcpy(data + outerDim, mat.data, mat.outerDim * sizeof(void*));
+            memcpy(endPointers + outerDim, mat.endPointers, mat.outerDim * sizeof(void*));
         }
 
-        // deep copy the data
-        for (uint32_t i = 0; i < outerDim - oldOuterDim; ++i) {
-            try {
-                data[oldOuterDim + i] = malloc(mat.getVectorSize(i));
-                endPointers[oldOuterDim + i] = (char*)data[oldOuterDim + i] + mat.getVectorSize(i);
-            }
-            catch (std::bad_alloc& e) {
-                throw std::bad_alloc();
-            }
+        outerDim += mat.outerDim;
+        if (columnMajor) {
+            numCols = outerDim;
+        }
+        else {
+            numRows = outerDim;
+        }
 
-            // copy the vector
-            memcpy(data[oldOuterDim + i], mat.data[i], mat.getVectorSize(i));
+        nnz += mat.nnz;
+        compSize += mat.compSize;
+
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+
+        if (!lookupIndices.empty()) {
+            lookupIndices.resize(outerDim);
+            lookupRuns.resize(outerDim);
         }
 
+        // leave the other matrix empty along the outer dimension
+        mat.dropLookupTable();
+        free(mat.data);
+        free(mat.endPointers);
+        mat.data = nullptr;
+        mat.endPointers = nullptr;
+        mat.outerCapacity = 0;
+        mat.outerDim = 0;
+        mat.nnz = 0;
+        mat.compSize = 0;
+        if (columnMajor) {
+            mat.numCols = 0;
+        }
+        else {
+            mat.numRows = 0;
+        }
+        mat.metadata[2] = 0;
+        mat.metadata[3] = 0;
+    }
+
+    // reserves room for n vectors along the outer dimension
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::reserveOuter(uint64_t n) {
+        if (n <= std::max(outerCapacity, outerDim)) { return; }
 
-        calculateCompSize();
+        try {
+            data = (void**)realloc(data, n * sizeof(void*));
+            endPointers = (void**)realloc(endPointers, n * sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+
+        outerCapacity = n;
     }
 
     // Eigen -> IVSparse append
@@ -302,92 +427,30 @@ namespace IVSparse {
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> SparseMatrix<T, indexT, compressionLevel, columnMajor>::transpose() {
 
-        std::vector<std::unordered_map<T, std::vector<indexT>>> mapsT;
-        // mapsT.reserve(innerDim);
-        mapsT.resize(innerDim);
-        // populate the transpose data structure
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                // add the value to the map
-                if constexpr (columnMajor) {
-                    mapsT[it.row()][it.value()].push_back(it.col());
+        // counting sort the entries into the vectors of the transpose
+        std::vector<uint64_t> offsets;
+        std::vector<std::pair<T, indexT>> entries;
+        IVSparse::transposeEntries<T, indexT>(outerDim, innerDim, nnz,
+            [this](uint64_t vec, auto&& visit) {
+                for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, vec); it; ++it) {
+                    visit(it.getIndex(), it.value());
                 }
-                else {
-                    mapsT[it.col()][it.value()].push_back(it.row());
-                }
-            }
-        }
-
+            },
+            offsets, entries);
 
-        for (int i = 0; i < innerDim; ++i) {
-            for (auto& col : mapsT[i]) {
-                // find the max value in the vector
-                size_t max = col.second[0];
-
-                // delta encode the vector
-                for (uint32_t i = col.second.size() - 1; i > 0; --i) {
-                    col.second[i] -= col.second[i - 1];
-                    if ((size_t)col.second[i] > max) max = col.second[i];
-                }
-
-                max = byteWidth(max);
-                // append max to the vector
-                col.second.push_back(max);
-            }
-        }
-
-        // create a new matrix passing in transposedMap
-        IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> temp(mapsT.data(), numRows, numCols);
-
-        // return the new matrix
-        return temp;
+        // create a new matrix from the sorted entries
+        return IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>(offsets, entries, numRows, numCols);
     }
 
     // Transpose In Place Method
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     void SparseMatrix<T, indexT, compressionLevel, columnMajor>::inPlaceTranspose() {
-        // make a data structure to store the tranpose
-        // std::unordered_map<T, std::vector<indexT>> mapsT[innerDim];
-        std::vector<std::unordered_map<T, std::vector<indexT>>> mapsT;
-        // mapsT.reserve(innerDim);
-        mapsT.resize(innerDim);
-
-        // populate the transpose data structure
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
-                // add the value to the map
-                if constexpr (columnMajor) {
-                    mapsT[it.row()][it.value()].push_back(it.col());
-                }
-                else {
-                    mapsT[it.col()][it.value()].push_back(it.row());
-                }
-            }
-        }
-
-        for (int i = 0; i < innerDim; ++i) {
-            for (auto& col : mapsT[i]) {
-                // find the max value in the vector
-                size_t max = col.second[0];
-
-                // delta encode the vector
-                for (uint32_t i = col.second.size() - 1; i > 0; --i) {
-                    col.second[i] -= col.second[i - 1];
-                    if ((size_t)col.second[i] > max) max = col.second[i];
-                }
-
-                max = byteWidth(max);
-                // append max to the vector
-                col.second.push_back(max);
-            }
-        }
-
-        *this = IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>(mapsT.data(), numRows, numCols);
+        *this = transpose();
     }
 
     // slice method that returns a vector of IVSparse vectors
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> SparseMatrix<T, indexT, compressionLevel, columnMajor>::slice(uint32_t start, uint32_t end) {
+    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> SparseMatrix<T, indexT, compressionLevel, columnMajor>::slice(uint64_t start, uint64_t end) {
 
         #ifdef IVSPARSE_DEBUG
         assert(start < outerDim && end <= outerDim && start < end &&
@@ -419,7 +482,7 @@ namespace IVSparse {
         }
 
         // copy the vectors
-        for (uint32_t i = start; i < end; ++i) {
+        for (uint64_t i = start; i < end; ++i) {
 
             try {
                 temp.data[i - start] = malloc(getVectorSize(i));
@@ -435,13 +498,13 @@ namespace IVSparse {
 
         // get nnz
         temp.nnz = 0;
-        for (int i = 0; i < temp.outerDim; ++i) {
+        for (uint64_t i = 0; i < temp.outerDim; ++i) {
             for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(temp, i); it; ++it) {
                 temp.nnz++;
             }
         }
 
-        temp.metadata = new uint32_t[NUM_META_DATA];
+        temp.metadata = new uint64_t[NUM_META_DATA];
         temp.metadata[0] = 3;
         temp.metadata[1] = temp.innerDim;
         temp.metadata[2] = temp.outerDim;
@@ -15,9 +15,12 @@ namespace IVSparse {
     SparseMatrix<T, indexT, compressionLevel, columnMajor>& SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator=(const IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>& other) {
 
         if (this != &other) {
+            // the lookup table is not copied
+            dropLookupTable();
+
             // free old data
             if (data != nullptr) {
-                for (uint32_t i = 0; i < outerDim; i++) {
+                for (uint64_t i = 0; i < outerDim; i++) {
                     if (data[i] != nullptr) {
                         free(data[i]);
                     }
@@ -38,12 +41,13 @@ namespace IVSparse {
             innerDim = other.innerDim;
             nnz = other.nnz;
             compSize = other.compSize;
+            outerCapacity = outerDim;
 
             // allocate the memory
             try {
                 data = (void**)malloc(outerDim * sizeof(void*));
                 endPointers = (void**)malloc(outerDim * sizeof(void*));
-                metadata = new uint32_t[NUM_META_DATA];
+                metadata = new uint64_t[NUM_META_DATA];
             }
             catch (std::bad_alloc& e) {
                 std::cerr << "Error: Could not allocate memory for IVSparse matrix"
@@ -52,14 +56,14 @@ namespace IVSparse {
             }
 
             // copy the metadata
-            memcpy(metadata, other.metadata, sizeof(uint32_t) * NUM_META_DATA);
+            memcpy(metadata, other.metadata, sizeof(uint64_t) * NUM_META_DATA);
 
             // set the index and value types
             encodeValueType();
             index_t = other.index_t;
 
             // copy the data
-            for (uint32_t i = 0; i < outerDim; i++) {
+            for (uint64_t i = 0; i < outerDim; i++) {
                 // if the vector is empty, set the data pointer to nullptr
                 if (other.data[i] == nullptr) {
                     data[i] = nullptr;
@@ -91,11 +95,11 @@ namespace IVSparse {
             // check if the two matrices are equal
 
             // first check the metadata using memcompare
-        if (memcmp(metadata, other.metadata, sizeof(uint32_t) * NUM_META_DATA) != 0)
+        if (memcmp(metadata, other.metadata, sizeof(uint64_t) * NUM_META_DATA) != 0)
             return false;
 
         // iterate through the data and compare each element
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (uint64_t i = 0; i < outerDim; i++) {
             if (memcmp(data[i], other.data[i], getVectorSize(i)) != 0) return false;
         }
 
@@ -111,7 +115,7 @@ namespace IVSparse {
 
     // Coefficent Access Operator
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    T SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator()(uint32_t row, uint32_t col) {
+    T SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator()(uint64_t row, uint64_t col) {
         #ifdef IVSPARSE_DEBUG
         // check if the row and column are in bounds
         if (row >= numRows || col >= numCols) {
@@ -120,8 +124,11 @@ namespace IVSparse {
         }
         #endif
 
-        uint32_t vector = columnMajor ? col : row;
-        uint32_t index = columnMajor ? row : col;
+        uint64_t vector = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        // binary search the lookup table if one is being kept
+        if (!lookupIndices.empty()) { return lookupCoeff(vector, index); }
 
         // if the vector is empty return 0
         if (data[vector] == nullptr) return 0;
@@ -140,7 +147,7 @@ namespace IVSparse {
     // Vector Access Operator
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector
-        SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator[](uint32_t vec) {
+        SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator[](uint64_t vec) {
 
         #ifdef IVSPARSE_DEBUG
         // check if the vector is out of bounds
@@ -177,36 +184,18 @@ namespace IVSparse {
 
     // Matrix Vector Multiplication (IVSparse Eigen -> Eigen)
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator*(
-        Eigen::Matrix<T, -1, 1>& vec) {
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator*(
+        Eigen::Matrix<accumT, -1, 1>& vec) {
 
         return vectorMultiply(vec);
     }
 
     // Matrix Matrix Multiplication (IVSparse Eigen -> Eigen)
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    Eigen::Matrix<T, -1, -1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator*(Eigen::Matrix<T, -1, -1>& mat) {
-
-        #ifdef IVSPARSE_DEBUG
-        // check that the matrix is the correct size
-        if (mat.rows() != numCols)
-            throw std::invalid_argument(
-                "The left matrix must have the same # of rows as columns in the right "
-                "matrix!");
-        #endif
-
-        Eigen::Matrix<T, -1, -1> newMatrix = Eigen::Matrix<T, -1, -1>::Zero(mat.cols(), numRows);
-        Eigen::Matrix<T, -1, -1> matTranspose = mat.transpose();
-
-        // #ifdef IVSPARSE_HAS_OPENMP
-        // #pragma omp parallel for
-        // #endif
-        for (uint32_t col = 0; col < numCols; col++) {
-            for (typename SparseMatrix<T, indexT, 3, columnMajor>::InnerIterator matIter(*this, col); matIter; ++matIter) {
-                newMatrix.col(matIter.row()) += matTranspose.col(col) * matIter.value();
-            }
-        }
-        return newMatrix.transpose();
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, compressionLevel, columnMajor>::operator*(Eigen::Matrix<accumT, -1, -1>& mat) {
+        return matrixMultiply(mat);
     }
 
 } // namespace IVSparse
\ No newline at end of file
@@ -40,30 +40,142 @@ namespace IVSparse {
 
     }
 
+    // Reads a single index of the given byte width
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::readIndex(uint8_t* ptr, uint8_t width) {
+        switch (width) {
+        case 1:
+            return *ptr;
+        case 2:
+            return *(uint16_t*)ptr;
+        case 4:
+            return *(uint32_t*)ptr;
+        case 8:
+            return *(uint64_t*)ptr;
+        default:
+            uint64_t index = 0;
+            for (uint8_t i = 0; i < width; i++) { index |= (uint64_t)ptr[i] << (8 * i); }
+            return index;
+        }
+    }
+
+    // Skips over the indices of a run without decoding them. The first index is
+    // absolute (and may be 0) so the delimiter search starts at the second one.
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline uint8_t* SparseMatrix<T, indexT, compressionLevel, columnMajor>::skipRun(uint8_t* indices, uint8_t width, uint64_t& length) {
+        length = 1;
+        indices += width;
+
+        switch (width) {
+        case 1:
+            for (; *indices != DELIM; indices++) { length++; }
+            break;
+        case 2:
+            for (; *(uint16_t*)indices != DELIM; indices += 2) { length++; }
+            break;
+        case 4:
+            for (; *(uint32_t*)indices != DELIM; indices += 4) { length++; }
+            break;
+        case 8:
+            for (; *(uint64_t*)indices != DELIM; indices += 8) { length++; }
+            break;
+        default:
+            for (; readIndex(indices, width) != DELIM; indices += width) { length++; }
+            break;
+        }
+
+        // step over the delimiter
+        return indices + width;
+    }
+
+    // Grows data and endPointers geometrically so they fit at least newOuterDim vectors
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::growOuter(uint64_t newOuterDim) {
+        if (newOuterDim <= std::max(outerCapacity, outerDim)) { return; }
+
+        // at least double so a stream of small appends reallocates O(log n) times
+        uint64_t capacity = std::max<uint64_t>(newOuterDim, 2 * (uint64_t)std::max(outerCapacity, outerDim));
+        capacity = std::min<uint64_t>(capacity, UINT32_MAX);
+
+        try {
+            data = (void**)realloc(data, capacity * sizeof(void*));
+            endPointers = (void**)realloc(endPointers, capacity * sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+
+        outerCapacity = capacity;
+    }
+
+    // Builds the lookup table entries of a single vector
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::buildLookup(uint64_t vec) {
+        std::vector<std::pair<indexT, uint64_t>> entries;
+
+        uint8_t* run = (uint8_t*)data[vec];
+        while (run != nullptr && run < (uint8_t*)endPointers[vec]) {
+            uint64_t offset = run - (uint8_t*)data[vec];
+            uint8_t width = *(run + sizeof(T));
+            uint8_t* index = run + sizeof(T) + 1;
+
+            // the first index is absolute and the rest are deltas ending in a delimiter
+            uint64_t current = readIndex(index, width);
+            entries.emplace_back(current, offset);
+
+            for (index += width; readIndex(index, width) != DELIM; index += width) {
+                current += readIndex(index, width);
+                entries.emplace_back(current, offset);
+            }
+            run = index + width;
+        }
+
+        std::sort(entries.begin(), entries.end());
+
+        lookupIndices[vec].resize(entries.size());
+        lookupRuns[vec].resize(entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            lookupIndices[vec][i] = entries[i].first;
+            lookupRuns[vec][i] = entries[i].second;
+        }
+    }
+
+    // Finds a value with the lookup table, building the vector's entries if needed
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline T SparseMatrix<T, indexT, compressionLevel, columnMajor>::lookupCoeff(uint64_t vec, uint64_t index) {
+        if (lookupIndices[vec].empty()) { buildLookup(vec); }
+
+        auto pos = std::lower_bound(lookupIndices[vec].begin(), lookupIndices[vec].end(), (indexT)index);
+        if (pos == lookupIndices[vec].end() || *pos != (indexT)index) return 0;
+
+        return *(T*)((uint8_t*)data[vec] + lookupRuns[vec][pos - lookupIndices[vec].begin()]);
+    }
+
     // private ostream operator helper
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     void SparseMatrix<T, indexT, compressionLevel, columnMajor>::print(std::ostream& os) {
         os << std::endl;
         os << "IVSparse Matrix" << std::endl;
 
-        // if the matrix is less than 100 rows and columns print the whole thing
-        if (numRows < 100 && numCols < 100) {
-            // print the matrix
-            for (uint32_t i = 0; i < numRows; i++) {
-                for (uint32_t j = 0; j < numCols; j++) {
-                    os << coeff(i, j) << " ";
+        // only the first 100 rows and columns are printed
+        uint64_t rows = std::min(numRows, (uint64_t)100);
+        uint64_t cols = std::min(numCols, (uint64_t)100);
+
+        // decode each shown vector once instead of calling coeff() for every element
+        std::vector<T> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                if ((uint64_t)it.row() < rows && (uint64_t)it.col() < cols) {
+                    dense[(size_t)it.row() * cols + it.col()] = it.value();
                 }
-                os << std::endl;
             }
         }
-        else if (numRows > 100 && numCols > 100) {
-            // print the first 100 rows and columns
-            for (uint32_t i = 0; i < 100; i++) {
-                for (uint32_t j = 0; j < 100; j++) {
-                    os << coeff(i, j) << " ";
-                }
-                os << std::endl;
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << dense[(size_t)i * cols + j] << " ";
             }
+            os << std::endl;
         }
 
         os << std::endl;
@@ -126,7 +238,7 @@ namespace IVSparse {
         // compSize += (sizeof(void*) * outerDim) * 2;
 
         // add the size of the data itself
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (uint64_t i = 0; i < outerDim; i++) {
             compSize += *((uint8_t**)endPointers + i) - *((uint8_t**)data + i);
         }
     }
@@ -134,7 +246,7 @@ namespace IVSparse {
     // Compression Algorithm for going from CSC to IVCSC
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
     template <typename T2, typename indexT2> void SparseMatrix<T, indexT, compressionLevel, columnMajor>::compressCSC(
-        T2* vals, indexT2* innerIndices, indexT2* outerPointers) {
+        const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers, const indexT2* innerNonZeros) {
         uint32_t ones = 0;
         uint32_t twos = 0;
         // ---- Stage 1: Setup the Matrix ---- //
@@ -146,7 +258,7 @@ namespace IVSparse {
         index_t = sizeof(indexT);
 
         // allocate space for metadata
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = compressionLevel;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
@@ -178,19 +290,22 @@ namespace IVSparse {
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (uint64_t i = 0; i < outerDim; i++) {
             // create the data structure to temporarily hold the data
             std::map<T2, std::vector<indexT2>> dict;  // Key = value, Value = vector of indices
 
+            // the end of the column, an uncompressed Eigen matrix has gaps between its columns
+            indexT2 end = innerNonZeros == nullptr ? outerPointers[i + 1] : outerPointers[i] + innerNonZeros[i];
+
             // check if the current column is empty
-            if (outerPointers[i] == outerPointers[i + 1]) {
+            if (outerPointers[i] == end) {
                 data[i] = nullptr;
                 endPointers[i] = nullptr;
                 continue;
             }
 
             // loop through each value in the column and add it to dict
-            for (indexT2 j = outerPointers[i]; j < outerPointers[i + 1]; j++) {
+            for (indexT2 j = outerPointers[i]; j < end; j++) {
 
                 // check if the value is already in the dictionary or not
                 if (dict.find(vals[j]) != dict.end()) {
@@ -280,15 +395,15 @@ namespace IVSparse {
                         helpPtr = (uint32_t*)helpPtr + 1;
                         break;
                     case 5:
-                        *(uint64_t*)helpPtr = (uint32_t)pair.second[k] & 0xFFFFFFFFFF;
+                        *(uint64_t*)helpPtr = (uint64_t)pair.second[k] & 0xFFFFFFFFFF;
                         helpPtr = (uint8_t*)helpPtr + 5;
                         break;
                     case 6:
-                        *(uint64_t*)helpPtr = (uint32_t)pair.second[k] & 0xFFFFFFFFFFFF;
+                        *(uint64_t*)helpPtr = (uint64_t)pair.second[k] & 0xFFFFFFFFFFFF;
                         helpPtr = (uint8_t*)helpPtr + 6;
                         break;
                     case 7:
-                        *(uint64_t*)helpPtr = (uint32_t)pair.second[k] & 0xFFFFFFFFFFFF;
+                        *(uint64_t*)helpPtr = (uint64_t)pair.second[k] & 0xFFFFFFFFFFFFFF;
                         helpPtr = (uint8_t*)helpPtr + 7;
                         break;
                     case 8:
@@ -313,6 +428,158 @@ namespace IVSparse {
 
     }  // end of compressCSC
 
+    // Encodes one vector from its entries sorted by value and then index
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end) {
+
+        // check if the vector is empty
+        if (begin == end) {
+            data[vec] = nullptr;
+            endPointers[vec] = nullptr;
+            return;
+        }
+
+        // size the runs, each is a value, a width, its indices and a delimiter
+        size_t byteSize = 0;
+        for (std::pair<T, indexT>* run = begin; run < end;) {
+            size_t maxDelta = run->second;
+            std::pair<T, indexT>* next = run + 1;
+            for (; next < end && next->first == run->first; next++) {
+                maxDelta = std::max<size_t>(maxDelta, next->second - (next - 1)->second);
+            }
+
+            byteSize += sizeof(T) + 1 + byteWidth(maxDelta) * (next - run + 1);
+            run = next;
+        }
+
+        try {
+            data[vec] = malloc(byteSize);
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+        endPointers[vec] = (uint8_t*)data[vec] + byteSize;
+
+        // write the runs, the first index is absolute and the rest are deltas
+        uint8_t* helpPtr = (uint8_t*)data[vec];
+        for (std::pair<T, indexT>* run = begin; run < end;) {
+            size_t maxDelta = run->second;
+            std::pair<T, indexT>* next = run + 1;
+            for (; next < end && next->first == run->first; next++) {
+                maxDelta = std::max<size_t>(maxDelta, next->second - (next - 1)->second);
+            }
+            uint8_t width = byteWidth(maxDelta);
+
+            memcpy(helpPtr, &run->first, sizeof(T));
+            helpPtr += sizeof(T);
+            *helpPtr++ = width;
+
+            for (std::pair<T, indexT>* entry = run; entry < next; entry++) {
+                uint64_t index = entry == run ? entry->second : entry->second - (entry - 1)->second;
+                memcpy(helpPtr, &index, width);
+                helpPtr += width;
+            }
+
+            // write a delimiter of the correct width
+            memset(helpPtr, 0, width);
+            helpPtr += width;
+            run = next;
+        }
+    }
+
+
+    // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            // get the number of rows and columns
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            // get the number of non-zero elements
+            nnz = mat.nonZeros();
+
+            // an uncompressed matrix is read through its per vector non-zero counts
+            compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
+
+    // Compresses a dense Eigen matrix one vector at a time without an intermediate CSC copy
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <int options>
+    void SparseMatrix<T, indexT, compressionLevel, columnMajor>::compressDense(Eigen::Matrix<T, -1, -1, options>& mat, T epsilon) {
+
+        numRows = mat.rows();
+        numCols = mat.cols();
+        outerDim = columnMajor ? numCols : numRows;
+        innerDim = columnMajor ? numRows : numCols;
+
+        encodeValueType();
+        index_t = sizeof(indexT);
+
+        // the stride between entries of a vector and between vectors in the dense data
+        const bool rowMajorData = options & Eigen::RowMajor;
+        const uint64_t innerStride = (rowMajorData == columnMajor) ? outerDim : 1;
+        const uint64_t outerStride = (rowMajorData == columnMajor) ? 1 : innerDim;
+
+        try {
+            data = (void**)malloc(outerDim * sizeof(void*));
+            endPointers = (void**)malloc(outerDim * sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+
+        const IVSparse::ZeroScanner<T> scanner(epsilon);
+        uint64_t totalNnz = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel reduction(+ : totalNnz)
+        #endif
+        {
+            // the kept entries of the current vector
+            std::vector<std::pair<T, indexT>> entries;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp for schedule(dynamic, 16)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                entries.clear();
+                scanner.scan(mat.data() + i * outerStride, innerDim, innerStride,
+                             [&](uint64_t index, T value) { entries.emplace_back(value, index); });
+
+                std::sort(entries.begin(), entries.end());
+                compressVector(i, entries.data(), entries.data() + entries.size());
+                totalNnz += entries.size();
+            }
+        }
+
+        nnz = totalNnz;
+
+        metadata = new uint64_t[NUM_META_DATA];
+        metadata[0] = compressionLevel;
+        metadata[1] = innerDim;
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+        metadata[4] = val_t;
+        metadata[5] = index_t;
+
+        calculateCompSize();
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+    }
 
 }  // end of namespace IVSparse
 
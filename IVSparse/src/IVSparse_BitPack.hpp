@@ -0,0 +1,264 @@
+/**
+ * @file IVSparse_BitPack.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Bit Packed Blocks of Deltas with Exception Patching and SIMD Unpacking
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+// Number of deltas packed together with one bit width
+#define PACK_BLOCK_SIZE 128
+
+namespace IVSparse {
+
+    /**
+     * Blocks of up to PACK_BLOCK_SIZE 32 bit deltas packed with a bit width of
+     * their own, in the style of PFor. \n \n
+     * Each block is a header byte with its bit width, the number of exceptions
+     * if it has any, the deltas packed little endian at that width and then the
+     * exceptions. The width is the one that makes the block smallest, deltas that
+     * do not fit are exceptions which keep their low bits in the packed data and
+     * store their position and high bits after it. A single large delta no
+     * longer widens a whole run.
+     */
+    namespace BitPack {
+
+        // Number of bits needed to store a value
+        inline uint8_t bitsNeeded(uint32_t value) {
+            return value == 0 ? 0 : 32 - __builtin_clz(value);
+        }
+
+        // Loads the up to 8 bytes from p that come before end, little endian
+        inline uint64_t loadWord(const uint8_t* p, const uint8_t* end) {
+            uint64_t word = 0;
+            if (p + sizeof(uint64_t) <= end) { memcpy(&word, p, sizeof(uint64_t)); }
+            else if (p < end) { memcpy(&word, p, end - p); }
+            return word;
+        }
+
+        // ORs bits into the up to 8 bytes from p that come before end, the bits past end must be zero
+        inline void orWord(uint8_t* p, const uint8_t* end, uint64_t bits) {
+            uint64_t word = loadWord(p, end) | bits;
+            memcpy(p, &word, std::min<size_t>(sizeof(uint64_t), end - p));
+        }
+
+        // Bytes taken by one exception, its position in the block and its high bits
+        constexpr size_t exceptionSize = sizeof(uint8_t) + sizeof(uint32_t);
+
+        // Flag in the header byte of a block that has exceptions
+        constexpr uint8_t exceptionFlag = 0x80;
+
+        // Bytes of the header of a block, the exception count is only there when there are some
+        inline size_t headerSize(uint32_t exceptions) {
+            return exceptions == 0 ? 1 : 2;
+        }
+
+        // Number of bytes a count takes as a varint, 7 bits per byte
+        inline size_t countSize(uint64_t count) {
+            size_t size = 1;
+            while (count >= 0x80) {
+                count >>= 7;
+                size++;
+            }
+            return size;
+        }
+
+        // Writes a count as a varint, returns the end of it
+        inline uint8_t* writeCount(uint64_t count, uint8_t* out) {
+            while (count >= 0x80) {
+                *out++ = (uint8_t)(count | 0x80);
+                count >>= 7;
+            }
+            *out++ = (uint8_t)count;
+            return out;
+        }
+
+        // Reads a varint count, returns the end of it
+        inline const uint8_t* readCount(const uint8_t* in, uint64_t& count) {
+            count = 0;
+            for (uint8_t shift = 0;; shift += 7) {
+                uint8_t byte = *in++;
+                count |= (uint64_t)(byte & 0x7F) << shift;
+                if (byte < 0x80) { return in; }
+            }
+        }
+
+        // Picks the bit width that makes a block of n deltas smallest, returns the block size in bytes
+        inline size_t chooseWidth(const uint32_t* deltas, uint32_t n, uint8_t& bits) {
+            // how many deltas need each number of bits
+            uint32_t histogram[33] = {0};
+            for (uint32_t i = 0; i < n; i++) { histogram[bitsNeeded(deltas[i])]++; }
+
+            size_t bestSize = SIZE_MAX;
+            uint32_t exceptions = n - histogram[0];
+            for (uint8_t b = 0; b <= 32; b++) {
+                size_t size = headerSize(exceptions) + ((size_t)n * b + 7) / 8 + exceptions * exceptionSize;
+
+                // on a tie the wider block has fewer exceptions to patch
+                if (size <= bestSize) {
+                    bestSize = size;
+                    bits = b;
+                }
+                if (b < 32) { exceptions -= histogram[b + 1]; }
+            }
+            return bestSize;
+        }
+
+        // Size in bytes of a block of n deltas at its best width
+        inline size_t blockSize(const uint32_t* deltas, uint32_t n) {
+            uint8_t bits;
+            return chooseWidth(deltas, n, bits);
+        }
+
+        // Packs a block of n deltas, returns the end of the block
+        inline uint8_t* packBlock(const uint32_t* deltas, uint32_t n, uint8_t* out) {
+            uint8_t bits;
+            size_t size = chooseWidth(deltas, n, bits);
+            uint64_t mask = bits == 32 ? 0xFFFFFFFF : ((uint64_t)1 << bits) - 1;
+
+            size_t packedBytes = ((size_t)n * bits + 7) / 8;
+
+            // the low bits are ORed in through 64 bit windows, so pack into a zeroed buffer first
+            uint8_t packed[PACK_BLOCK_SIZE * sizeof(uint32_t)] = {0};
+            for (uint32_t i = 0; i < n; i++) {
+                uint64_t bitPos = (uint64_t)i * bits;
+                orWord(packed + bitPos / 8, packed + packedBytes, (deltas[i] & mask) << (bitPos % 8));
+            }
+
+            uint8_t exceptions = 0;
+            for (uint32_t i = 0; i < n; i++) { exceptions += bitsNeeded(deltas[i]) > bits; }
+
+            out[0] = exceptions == 0 ? bits : bits | exceptionFlag;
+            if (exceptions > 0) { out[1] = exceptions; }
+
+            uint8_t* helpPtr = out + headerSize(exceptions);
+            memcpy(helpPtr, packed, packedBytes);
+            helpPtr += packedBytes;
+
+            // the high bits of the deltas that do not fit go after the packed data
+            for (uint32_t i = 0; i < n; i++) {
+                if (bitsNeeded(deltas[i]) > bits) {
+                    uint32_t high = (uint32_t)((uint64_t)deltas[i] >> bits);
+                    *helpPtr++ = (uint8_t)i;
+                    memcpy(helpPtr, &high, sizeof(uint32_t));
+                    helpPtr += sizeof(uint32_t);
+                }
+            }
+            return out + size;
+        }
+
+        // Unpacks n values of the given width with scalar 64 bit loads
+        inline void unpackScalar(const uint8_t* packed, uint32_t n, uint8_t bits, uint32_t* out) {
+            if (bits == 0) {
+                memset(out, 0, sizeof(uint32_t) * n);
+                return;
+            }
+
+            const uint8_t* end = packed + ((size_t)n * bits + 7) / 8;
+            uint64_t mask = bits == 32 ? 0xFFFFFFFF : ((uint64_t)1 << bits) - 1;
+            for (uint32_t i = 0; i < n; i++) {
+                uint64_t bitPos = (uint64_t)i * bits;
+                out[i] = (uint32_t)((loadWord(packed + bitPos / 8, end) >> (bitPos % 8)) & mask);
+            }
+        }
+
+        #ifdef IVSPARSE_HAS_SIMD
+
+        // Unpacks n values of up to 25 bits, 8 lanes at a time with 4 byte gathers and variable shifts
+        __attribute__((target("avx2"))) inline void unpackAVX2(const uint8_t* packed, uint32_t n, uint8_t bits, uint32_t* out) {
+            const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256i width = _mm256_set1_epi32(bits);
+            const __m256i mask = _mm256_set1_epi32((int32_t)(((uint32_t)1 << bits) - 1));
+            const __m256i seven = _mm256_set1_epi32(7);
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i all = _mm256_set1_epi32(-1);
+
+            // a gather loads 4 bytes, the lanes that would load past the packed data go to the scalar tail
+            const uint8_t* end = packed + ((size_t)n * bits + 7) / 8;
+            uint32_t i = 0;
+            for (; i + 8 <= n && packed + ((uint64_t)(i + 7) * bits) / 8 + 4 <= end; i += 8) {
+                __m256i bitPos = _mm256_mullo_epi32(_mm256_add_epi32(lanes, _mm256_set1_epi32(i)), width);
+                __m256i bytePos = _mm256_srli_epi32(bitPos, 3);
+                __m256i words = _mm256_mask_i32gather_epi32(zero, (const int*)packed, bytePos, all, 1);
+                __m256i values = _mm256_and_si256(_mm256_srlv_epi32(words, _mm256_and_si256(bitPos, seven)), mask);
+                _mm256_storeu_si256((__m256i*)(out + i), values);
+            }
+
+            for (uint64_t bitPos = (uint64_t)i * bits; i < n; i++, bitPos += bits) {
+                out[i] = (uint32_t)((loadWord(packed + bitPos / 8, end) >> (bitPos % 8)) & (((uint64_t)1 << bits) - 1));
+            }
+        }
+
+        #endif
+
+    }  // namespace BitPack
+
+    /**
+     * Decodes runs of bit packed delta blocks into absolute indices. \n \n
+     * The instruction set is picked once on construction. Blocks of up to 25
+     * bits are unpacked with AVX2 gathers and shifts, wider blocks and other
+     * CPUs use a scalar loop.
+     */
+    class BitUnpacker {
+        private:
+
+        bool simd = false;
+
+        public:
+
+        BitUnpacker() {
+            #ifdef IVSPARSE_HAS_SIMD
+            simd = cpuHasAVX2();
+            #endif
+        }
+
+        // Unpacks and patches one block of n deltas, returns the end of the block
+        inline const uint8_t* unpackBlock(const uint8_t* block, uint32_t n, uint32_t* out) const {
+            uint8_t bits = block[0] & ~BitPack::exceptionFlag;
+            uint8_t exceptions = block[0] & BitPack::exceptionFlag ? block[1] : 0;
+            const uint8_t* packed = block + BitPack::headerSize(exceptions);
+
+            #ifdef IVSPARSE_HAS_SIMD
+            if (simd && bits > 0 && bits <= 25) { BitPack::unpackAVX2(packed, n, bits, out); }
+            else { BitPack::unpackScalar(packed, n, bits, out); }
+            #else
+            BitPack::unpackScalar(packed, n, bits, out);
+            #endif
+
+            // put the high bits back on the deltas that did not fit
+            const uint8_t* exception = packed + ((size_t)n * bits + 7) / 8;
+            for (uint8_t e = 0; e < exceptions; e++) {
+                uint32_t high;
+                memcpy(&high, exception + 1, sizeof(uint32_t));
+                out[exception[0]] |= (uint32_t)((uint64_t)high << bits);
+                exception += BitPack::exceptionSize;
+            }
+            return exception;
+        }
+
+        // Decodes the count indices of a run into out, returns the end of the run
+        inline const uint8_t* decodeRun(const uint8_t* run, uint32_t count, uint32_t* out) const {
+            for (uint32_t start = 0; start < count; start += PACK_BLOCK_SIZE) {
+                run = unpackBlock(run, std::min<uint32_t>(PACK_BLOCK_SIZE, count - start), out + start);
+            }
+
+            // the deltas become indices, the first is absolute
+            for (uint32_t i = 1; i < count; i++) { out[i] += out[i - 1]; }
+            return run;
+        }
+
+        // Skips over a run without decoding it, returns the end of the run
+        static inline const uint8_t* skipRun(const uint8_t* run, uint32_t count) {
+            for (uint32_t start = 0; start < count; start += PACK_BLOCK_SIZE) {
+                uint32_t n = std::min<uint32_t>(PACK_BLOCK_SIZE, count - start);
+                uint8_t bits = run[0] & ~BitPack::exceptionFlag;
+                uint8_t exceptions = run[0] & BitPack::exceptionFlag ? run[1] : 0;
+                run += BitPack::headerSize(exceptions) + ((size_t)n * bits + 7) / 8 + exceptions * BitPack::exceptionSize;
+            }
+            return run;
+        }
+    };
+
+}  // namespace IVSparse
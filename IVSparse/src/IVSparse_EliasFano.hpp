@@ -0,0 +1,273 @@
+/**
+ * @file IVSparse_EliasFano.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Elias-Fano Encoded Index Runs with Sublinear Seeks
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+// Number of zeros of the high bits between two skip samples
+#define EF_SAMPLE_RATE 256
+
+// Runs shorter than this are never Elias-Fano encoded
+#define EF_MIN_RUN 128
+
+namespace IVSparse {
+
+    /**
+     * Sorted runs of 32 bit indices in Elias-Fano form. \n \n
+     * Each index is split into its low bits, stored packed at a fixed width,
+     * and its high bits, stored as a unary bucket bitmap where index i sets bit
+     * i + (index >> lowBits). The size is within two bits per index of the
+     * smallest possible for the universe. A run is the number of low bits, the
+     * number of buckets as a varint, the position of every EF_SAMPLE_RATE'th
+     * zero of the bitmap, the low bits and then the bitmap. The samples let a
+     * seek jump straight to the bucket of its target instead of decoding the
+     * run from the start.
+     */
+    namespace EliasFano {
+
+        // Number of low bits per index for n indices up to last
+        inline uint8_t lowBits(uint64_t n, uint32_t last) {
+            uint64_t ratio = ((uint64_t)last + 1) / n;
+            return ratio <= 1 ? 0 : 63 - __builtin_clzll(ratio);
+        }
+
+        // Number of high bit buckets for indices up to last
+        inline uint64_t numBuckets(uint32_t last, uint8_t low) {
+            return ((uint64_t)last >> low) + 1;
+        }
+
+        // Number of skip samples for the given number of buckets
+        inline uint64_t numSamples(uint64_t buckets) {
+            return (buckets - 1) / EF_SAMPLE_RATE;
+        }
+
+        // Size in bytes of the encoded run after its header
+        inline size_t bodySize(uint64_t n, uint8_t low, uint64_t buckets) {
+            return numSamples(buckets) * sizeof(uint64_t) + (n * low + 7) / 8 + (n + buckets + 7) / 8;
+        }
+
+        // Size in bytes of an encoded run of n sorted indices
+        inline size_t size(const uint32_t* indices, uint64_t n) {
+            uint8_t low = lowBits(n, indices[n - 1]);
+            uint64_t buckets = numBuckets(indices[n - 1], low);
+            return 1 + BitPack::countSize(buckets) + bodySize(n, low, buckets);
+        }
+
+        // Encodes n sorted indices into zeroed memory, returns the end of the run
+        inline uint8_t* encode(const uint32_t* indices, uint64_t n, uint8_t* out) {
+            uint8_t low = lowBits(n, indices[n - 1]);
+            uint64_t buckets = numBuckets(indices[n - 1], low);
+            uint64_t samples = numSamples(buckets);
+
+            out[0] = low;
+            uint8_t* sampleStart = BitPack::writeCount(buckets, out + 1);
+            uint8_t* lowStart = sampleStart + samples * sizeof(uint64_t);
+            uint8_t* highStart = lowStart + (n * low + 7) / 8;
+
+            uint64_t mask = ((uint64_t)1 << low) - 1;
+            for (uint64_t i = 0; i < n; i++) {
+                uint64_t bitPos = i * low;
+                BitPack::orWord(lowStart + bitPos / 8, highStart, (indices[i] & mask) << (bitPos % 8));
+
+                uint64_t highPos = i + (indices[i] >> low);
+                highStart[highPos / 8] |= (uint8_t)(1 << (highPos % 8));
+            }
+
+            // zero z of the bitmap is at z plus the number of indices in buckets up to z
+            uint64_t i = 0;
+            for (uint64_t k = 1; k <= samples; k++) {
+                uint64_t zero = k * EF_SAMPLE_RATE;
+                while (i < n && (indices[i] >> low) <= zero) { i++; }
+                uint64_t position = zero + i;
+                memcpy(sampleStart + (k - 1) * sizeof(uint64_t), &position, sizeof(uint64_t));
+            }
+
+            return highStart + (n + buckets + 7) / 8;
+        }
+
+        // Skips over an encoded run of n indices, returns the end of it
+        inline const uint8_t* skip(const uint8_t* run, uint64_t n) {
+            uint8_t low = run[0];
+            uint64_t buckets;
+            const uint8_t* body = BitPack::readCount(run + 1, buckets);
+            return body + bodySize(n, low, buckets);
+        }
+
+        // Position of the set bit of the given rank in a word
+        inline uint32_t selectBit(uint64_t word, uint64_t rank) {
+            for (uint64_t r = 0; r < rank; r++) { word &= word - 1; }
+            return __builtin_ctzll(word);
+        }
+
+    }  // namespace EliasFano
+
+    /**
+     * Reads and seeks through one Elias-Fano encoded run. \n \n
+     * nextGEQ moves a cursor forward to the first index at or after its target.
+     * Targets in a later bucket jump there through the skip samples, so seeking
+     * costs a sample lookup and a short scan rather than decoding everything
+     * before the target.
+     */
+    class EliasFanoReader {
+        private:
+
+        const uint8_t* samples = nullptr;  // Skip samples of the bitmap
+        const uint8_t* low = nullptr;      // Packed low bits
+        const uint8_t* high = nullptr;     // Unary bucket bitmap
+        const uint8_t* endPtr = nullptr;   // End of the run
+
+        uint64_t n = 0;        // Number of indices
+        uint64_t buckets = 0;  // Number of buckets
+        uint8_t lowBits = 0;   // Width of the low bits
+
+        uint64_t i = 0;    // Rank of the cursor
+        uint64_t pos = 0;  // Bitmap position of the cursor, i ones come before it
+
+        // Loads the 56 bitmap bits starting at a bit position, the bits past the bitmap are zero
+        inline uint64_t loadHigh(uint64_t bitPos) const {
+            return (BitPack::loadWord(high + bitPos / 8, endPtr) >> (bitPos % 8)) & (((uint64_t)1 << 56) - 1);
+        }
+
+        // Low bits of the index of a rank
+        inline uint64_t lowOf(uint64_t rank) const {
+            if (lowBits == 0) return 0;
+            uint64_t bitPos = rank * lowBits;
+            return (BitPack::loadWord(low + bitPos / 8, high) >> (bitPos % 8)) & (((uint64_t)1 << lowBits) - 1);
+        }
+
+        // Bitmap position of the zero of a rank, starting from the closest sample before it
+        inline uint64_t selectZero(uint64_t rank) const {
+            uint64_t sample = rank / EF_SAMPLE_RATE;
+            uint64_t p = 0;
+            if (sample > 0) {
+                memcpy(&p, samples + (sample - 1) * sizeof(uint64_t), sizeof(uint64_t));
+                rank -= sample * EF_SAMPLE_RATE;
+            }
+
+            while (true) {
+                uint64_t zeros = ~loadHigh(p) & (((uint64_t)1 << 56) - 1);
+                uint64_t count = __builtin_popcountll(zeros);
+                if (rank < count) { return p + EliasFano::selectBit(zeros, rank); }
+                rank -= count;
+                p += 56;
+            }
+        }
+
+        public:
+
+        EliasFanoReader() {};
+
+        // Reads the header of a run of count indices
+        EliasFanoReader(const uint8_t* run, uint64_t count) : n(count) {
+            lowBits = run[0];
+            samples = BitPack::readCount(run + 1, buckets);
+            low = samples + EliasFano::numSamples(buckets) * sizeof(uint64_t);
+            high = low + (n * lowBits + 7) / 8;
+            endPtr = high + (n + buckets + 7) / 8;
+        }
+
+        // End of the run
+        inline const uint8_t* end() const { return endPtr; }
+
+        // Returns the first index at or after x past the cursor and moves the cursor onto it, UINT64_MAX if there is none
+        inline uint64_t nextGEQ(uint64_t x) {
+            if (i >= n) return UINT64_MAX;
+
+            // jump to the first position of the bucket of x if it is past the cursor
+            uint64_t bucket = x >> lowBits;
+            if (bucket >= buckets) {
+                i = n;
+                return UINT64_MAX;
+            }
+            if (bucket > pos - i) {
+                pos = selectZero(bucket - 1) + 1;
+                i = pos - bucket;
+            }
+
+            while (i < n) {
+                // find the next set bit, there is one while i < n
+                uint64_t word = loadHigh(pos);
+                while (word == 0) {
+                    pos += 56;
+                    word = loadHigh(pos);
+                }
+                pos += __builtin_ctzll(word);
+
+                uint64_t index = ((pos - i) << lowBits) | lowOf(i);
+                if (index >= x) { return index; }
+                i++;
+                pos++;
+            }
+            return UINT64_MAX;
+        }
+
+        // Decodes every index of the run into out
+        inline void decode(uint32_t* out) const {
+            uint64_t rank = 0;
+            for (uint64_t w = 0; rank < n; w++) {
+                uint64_t word = BitPack::loadWord(high + w * 8, endPtr);
+
+                while (word != 0 && rank < n) {
+                    uint64_t p = w * 64 + __builtin_ctzll(word);
+                    out[rank] = (uint32_t)(((p - rank) << lowBits) | lowOf(rank));
+                    rank++;
+                    word &= word - 1;
+                }
+            }
+        }
+    };
+
+    /**
+     * Seeks through the sorted indices of a run that is either already
+     * decoded or Elias-Fano encoded, so runs of both kinds can be intersected
+     * and sliced the same way.
+     */
+    class IndexCursor {
+        private:
+
+        EliasFanoReader reader;              // Reader of an encoded run
+        const uint32_t* indices = nullptr;  // Indices of a decoded run
+        uint64_t count = 0;                 // Number of decoded indices
+        uint64_t i = 0;                     // Position in the decoded indices
+
+        public:
+
+        // Cursor over decoded indices
+        IndexCursor(const uint32_t* indices, uint64_t count) : indices(indices), count(count) {}
+
+        // Cursor over an Elias-Fano encoded run
+        IndexCursor(const EliasFanoReader& reader) : reader(reader) {}
+
+        // Returns the first index at or after x past the cursor and moves the cursor onto it, UINT64_MAX if there is none
+        inline uint64_t nextGEQ(uint64_t x) {
+            if (indices == nullptr) return reader.nextGEQ(x);
+
+            i = std::lower_bound(indices + i, indices + count, x) - indices;
+            return i < count ? indices[i] : UINT64_MAX;
+        }
+    };
+
+    // Number of indices two cursors have in common, each cursor leapfrogs to the other
+    inline uint64_t intersectionSize(IndexCursor a, IndexCursor b) {
+        uint64_t size = 0;
+        uint64_t x = a.nextGEQ(0);
+        while (x != UINT64_MAX) {
+            uint64_t y = b.nextGEQ(x);
+            if (y == UINT64_MAX) break;
+
+            if (y == x) {
+                size++;
+                x = a.nextGEQ(x + 1);
+            }
+            else {
+                x = a.nextGEQ(y);
+            }
+        }
+        return size;
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,139 @@
+/**
+ * @file IVSparse_Estimate.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Compressed Size Estimation and Level Selection
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Estimated byteSize() of a matrix at each compression level, returned by
+     * estimateSize(). \n \n
+     * The CSC size is exact. The VCSC and IVCSC sizes are extrapolated from a
+     * sample of outer vectors by their share of the non-zeros, and are exact
+     * when every vector was sampled.
+     */
+    struct SizeEstimate {
+        size_t cscBytes = 0;    // Estimated size of the CSC (level 1) matrix
+        size_t vcscBytes = 0;   // Estimated size of the VCSC (level 2) matrix
+        size_t ivcscBytes = 0;  // Estimated size of the IVCSC (level 3) matrix
+
+        uint8_t level = 1;  // The level with the smallest estimate
+
+        uint64_t sampledVectors = 0;  // Number of outer vectors that were read
+    };
+
+    /**
+     * @tparam T The value type the matrix would be built with
+     * @tparam indexT The index type the matrix would be built with
+     * @tparam columnMajor Whether the arrays are CSC (true) or CSR (false)
+     * @param samples The number of outer vectors to read, spread evenly over the matrix
+     *
+     * Estimates the size of each compression level for the given CSC arrays
+     * without building any of them. \n \n
+     * Each sampled vector is sorted by value the same way the compressed levels
+     * store it, which gives its number of unique values for VCSC and the byte
+     * width of every run's index deltas for IVCSC. Only the sampled vectors are
+     * sorted so on large matrices this is a small fraction of a full build.
+     */
+    template <typename T, typename indexT, bool columnMajor = true, typename T2, typename indexT2>
+    inline SizeEstimate estimateSize(T2* vals, indexT2* innerIndices, indexT2* outerPtr,
+                                     uint64_t num_rows, uint64_t num_cols, uint64_t nnz, uint64_t samples = 1024) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(samples > 0 && "Error: At least one vector has to be sampled");
+        #endif
+
+        uint64_t outerDim = columnMajor ? num_cols : num_rows;
+
+        SizeEstimate estimate;
+        estimate.cscBytes = META_DATA_SIZE + (sizeof(T) + sizeof(indexT)) * nnz + sizeof(indexT) * (outerDim + 1);
+        estimate.sampledVectors = std::min(samples, outerDim);
+
+        uint64_t sampledNnz = 0, sampledRuns = 0, sampledRunBytes = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 8) reduction(+ : sampledNnz, sampledRuns, sampledRunBytes)
+        #endif
+        for (int64_t s = 0; s < (int64_t)estimate.sampledVectors; s++) {
+            uint64_t vec = s * outerDim / estimate.sampledVectors;
+
+            // group the vector by value and then index, the order the compressed levels store it in
+            std::vector<std::pair<T, uint64_t>> entries;
+            entries.reserve(outerPtr[vec + 1] - outerPtr[vec]);
+            for (uint64_t k = outerPtr[vec]; k < (uint64_t)outerPtr[vec + 1]; k++) {
+                entries.emplace_back(static_cast<T>(vals[k]), innerIndices[k]);
+            }
+            std::sort(entries.begin(), entries.end());
+
+            // each IVCSC run is a value, a width, its indices and a delimiter
+            for (size_t run = 0; run < entries.size();) {
+                uint64_t maxDelta = entries[run].second;
+                size_t next = run + 1;
+                for (; next < entries.size() && entries[next].first == entries[run].first; next++) {
+                    maxDelta = std::max(maxDelta, entries[next].second - entries[next - 1].second);
+                }
+
+                uint8_t width = 1;
+                while (width < 8 && (maxDelta >> (8 * width)) != 0) { width++; }
+
+                sampledRunBytes += sizeof(T) + 1 + width * (next - run + 1);
+                sampledRuns++;
+                run = next;
+            }
+            sampledNnz += entries.size();
+        }
+
+        // scale the sample up by its share of the non-zeros
+        double scale = sampledNnz == 0 ? 0 : (double)nnz / sampledNnz;
+        uint64_t runs = (uint64_t)(sampledRuns * scale);
+
+        estimate.vcscBytes = sizeof(uint64_t) * 2 * (outerDim + 1) + (sizeof(T) + sizeof(indexT)) * runs + sizeof(indexT) * nnz;
+        estimate.ivcscBytes = (size_t)(sampledRunBytes * scale);
+
+        if (estimate.vcscBytes < estimate.cscBytes) { estimate.level = 2; }
+        if (estimate.ivcscBytes < std::min(estimate.cscBytes, estimate.vcscBytes)) { estimate.level = 3; }
+
+        return estimate;
+    }
+
+    // A matrix of any of the compression levels, as returned by makeSparseMatrix()
+    template <typename T, typename indexT, bool columnMajor = true>
+    using AnySparseMatrix = std::variant<SparseMatrix<T, indexT, 1, columnMajor>,
+                                         SparseMatrix<T, indexT, 2, columnMajor>,
+                                         SparseMatrix<T, indexT, 3, columnMajor>>;
+
+    /**
+     * @tparam T The value type of the matrix
+     * @tparam indexT The index type of the matrix
+     * @tparam columnMajor Whether the arrays are CSC (true) or CSR (false)
+     *
+     * Builds the compression level estimateSize() picks for the given CSC
+     * arrays. \n \n
+     * Only the chosen level is built, in place in the returned variant. Use
+     * std::visit or std::get on the result, its index() is the level minus one.
+     * When estimate is not nullptr it is filled with the estimate that was used.
+     */
+    template <typename T, typename indexT, bool columnMajor = true, typename T2, typename indexT2>
+    inline AnySparseMatrix<T, indexT, columnMajor> makeSparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr,
+                                                                    uint64_t num_rows, uint64_t num_cols, uint64_t nnz,
+                                                                    SizeEstimate* estimate = nullptr, uint64_t samples = 1024) {
+
+        SizeEstimate chosen = estimateSize<T, indexT, columnMajor>(vals, innerIndices, outerPtr, num_rows, num_cols, nnz, samples);
+        if (estimate != nullptr) { *estimate = chosen; }
+
+        switch (chosen.level) {
+        case 3:
+            return AnySparseMatrix<T, indexT, columnMajor>(std::in_place_index<2>, vals, innerIndices, outerPtr, num_rows, num_cols, nnz);
+        case 2:
+            return AnySparseMatrix<T, indexT, columnMajor>(std::in_place_index<1>, vals, innerIndices, outerPtr, num_rows, num_cols, nnz);
+        default:
+            return AnySparseMatrix<T, indexT, columnMajor>(std::in_place_index<0>, vals, innerIndices, outerPtr, num_rows, num_cols, nnz);
+        }
+    }
+
+}  // namespace IVSparse
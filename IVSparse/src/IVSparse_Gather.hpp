@@ -0,0 +1,80 @@
+/**
+ * @file IVSparse_Gather.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Batched Coefficient Lookups Shared by all Compression Levels
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Answers a batch of coefficient queries grouped by outer vector. \n \n
+     * The queries are bucketed by outer vector with a counting sort and each
+     * touched vector is handled once by a single thread. When useLookup is true
+     * lookup(vec, index) is called for each query of the vector. Otherwise
+     * decode(vec, visit) must call visit(index, value) for every entry of the
+     * vector, which is scattered into a per thread dense buffer that the queries
+     * are then read from. Results are written to out in the original query order.
+     */
+    template <typename T, typename Decode, typename Lookup>
+    inline void gatherGrouped(uint64_t outerDim, uint64_t innerDim, const uint64_t* outer, const uint64_t* inner,
+                              T* out, size_t n, bool useLookup, Decode decode, Lookup lookup) {
+
+        #ifdef IVSPARSE_DEBUG
+        for (size_t q = 0; q < n; q++) {
+            assert(outer[q] < outerDim && inner[q] < innerDim && "Query out of bounds!");
+        }
+        #endif
+
+        // bucket the queries by outer vector
+        std::vector<size_t> offsets((size_t)outerDim + 1, 0);
+        for (size_t q = 0; q < n; q++) { offsets[outer[q] + 1]++; }
+        for (uint64_t i = 0; i < outerDim; i++) { offsets[i + 1] += offsets[i]; }
+
+        std::vector<size_t> order(n);
+        std::vector<size_t> position(offsets.begin(), offsets.end() - 1);
+        for (size_t q = 0; q < n; q++) { order[position[outer[q]]++] = q; }
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel
+        #endif
+        {
+            // dense copy of the current vector, stamp marks which entries belong to it
+            std::vector<T> dense;
+            std::vector<uint64_t> stamp;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp for schedule(dynamic, 16)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                if (offsets[i] == offsets[i + 1]) continue;
+
+                if (useLookup) {
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                        out[order[k]] = lookup(i, inner[order[k]]);
+                    }
+                    continue;
+                }
+
+                if (dense.empty()) {
+                    dense.resize(innerDim);
+                    stamp.assign(innerDim, 0);
+                }
+
+                decode(i, [&](uint64_t index, T value) {
+                    dense[index] = value;
+                    stamp[index] = i + 1;
+                });
+
+                for (size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                    uint64_t index = inner[order[k]];
+                    out[order[k]] = stamp[index] == (uint64_t)i + 1 ? dense[index] : 0;
+                }
+            }
+        }
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,565 @@
+/**
+ * @file IVSparse_IndexSet.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Roaring Style Sets of Inner Indices with Set Algebra
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+// Number of indices covered by one container
+#define ROARING_CHUNK 65536
+
+// Number of words in a bitmap container
+#define ROARING_BITMAP_WORDS (ROARING_CHUNK / 64)
+
+namespace IVSparse {
+
+    /**
+     * The layout of one container of an IndexSet.
+     */
+    enum RoaringContainer : uint8_t {
+        ROARING_ARRAY = 0,   // The sorted low 16 bits of each index
+        ROARING_BITMAP = 1,  // One bit for each of the ROARING_CHUNK indices
+        ROARING_RUNS = 2     // Intervals of consecutive indices as their first and last low bits
+    };
+
+    /**
+     * A set of 32 bit indices split in the style of Roaring bitmaps. \n \n
+     * The indices are grouped by their high 16 bits into containers, each
+     * stored as a sorted array when sparse, a bitmap when dense or a list of
+     * intervals when the indices are mostly consecutive, whichever is smallest.
+     * Intersections, unions and the size of an intersection work a container at
+     * a time with a path for each pair of layouts, so two bitmaps are combined
+     * a word at a time and two interval lists by their endpoints without ever
+     * listing their indices. \n \n
+     * A set is written as the number of containers as a varint and then each
+     * container as its key, its layout, its cardinality minus one as a varint
+     * and its contents. Interval lists start with their number of intervals.
+     */
+    class IndexSet {
+        private:
+
+        struct Container {
+            uint16_t key = 0;            // High 16 bits of the indices
+            uint8_t type = ROARING_ARRAY;  // Layout of the container
+            uint32_t cardinality = 0;    // Number of indices
+
+            std::vector<uint16_t> values;  // Array values or the first and last of each interval
+            std::vector<uint64_t> bits;    // Bitmap words
+        };
+
+        std::vector<Container> containers;  // Containers in ascending key order
+
+        //* Private Container Methods *//
+
+        // Bytes of the contents of a container
+        static inline size_t contentSize(const Container& c) {
+            switch (c.type) {
+            case ROARING_ARRAY:
+                return sizeof(uint16_t) * c.values.size();
+            case ROARING_BITMAP:
+                return sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+            default:
+                return BitPack::countSize(c.values.size() / 2) + sizeof(uint16_t) * c.values.size();
+            }
+        }
+
+        // Checks if a container has the given low bits
+        static inline bool containerHas(const Container& c, uint16_t low) {
+            switch (c.type) {
+            case ROARING_ARRAY:
+                return std::binary_search(c.values.begin(), c.values.end(), low);
+            case ROARING_BITMAP:
+                return (c.bits[low / 64] >> (low % 64)) & 1;
+            default: {
+                // the last interval starting at or before low
+                size_t lo = 0, hi = c.values.size() / 2;
+                while (lo < hi) {
+                    size_t mid = (lo + hi) / 2;
+                    if (c.values[2 * mid] <= low) { lo = mid + 1; }
+                    else { hi = mid; }
+                }
+                return lo > 0 && c.values[2 * (lo - 1) + 1] >= low;
+            }
+            }
+        }
+
+        // Calls visit(low) for the low bits of every index of a container in order
+        template <typename Visit>
+        static inline void containerForEach(const Container& c, Visit visit) {
+            switch (c.type) {
+            case ROARING_ARRAY:
+                for (uint16_t low : c.values) { visit(low); }
+                break;
+            case ROARING_BITMAP:
+                for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) {
+                    for (uint64_t word = c.bits[w]; word != 0; word &= word - 1) {
+                        visit((uint16_t)(w * 64 + __builtin_ctzll(word)));
+                    }
+                }
+                break;
+            default:
+                for (size_t r = 0; r < c.values.size(); r += 2) {
+                    for (uint32_t low = c.values[r]; low <= c.values[r + 1]; low++) { visit((uint16_t)low); }
+                }
+                break;
+            }
+        }
+
+        // Bitmap words of a container
+        static inline std::vector<uint64_t> toBitmap(const Container& c) {
+            if (c.type == ROARING_BITMAP) return c.bits;
+
+            std::vector<uint64_t> bits(ROARING_BITMAP_WORDS, 0);
+            if (c.type == ROARING_RUNS) {
+                for (size_t r = 0; r < c.values.size(); r += 2) { setRange(bits.data(), c.values[r], c.values[r + 1]); }
+            }
+            else {
+                for (uint16_t low : c.values) { bits[low / 64] |= (uint64_t)1 << (low % 64); }
+            }
+            return bits;
+        }
+
+        // Sets the bits first to last of a bitmap
+        static inline void setRange(uint64_t* bits, uint32_t first, uint32_t last) {
+            for (uint32_t w = first / 64; w <= last / 64; w++) {
+                uint64_t mask = ~(uint64_t)0;
+                if (w == first / 64) { mask &= ~(uint64_t)0 << (first % 64); }
+                if (w == last / 64) { mask &= ~(uint64_t)0 >> (63 - last % 64); }
+                bits[w] |= mask;
+            }
+        }
+
+        // Number of set bits first to last of a bitmap
+        static inline uint32_t countRange(const uint64_t* bits, uint32_t first, uint32_t last) {
+            uint32_t count = 0;
+            for (uint32_t w = first / 64; w <= last / 64; w++) {
+                uint64_t mask = ~(uint64_t)0;
+                if (w == first / 64) { mask &= ~(uint64_t)0 << (first % 64); }
+                if (w == last / 64) { mask &= ~(uint64_t)0 >> (63 - last % 64); }
+                count += __builtin_popcountll(bits[w] & mask);
+            }
+            return count;
+        }
+
+        // Rebuilds a container from sorted low bits in its smallest layout
+        static inline void fromSorted(Container& c, const uint16_t* lows, uint32_t n) {
+            c.cardinality = n;
+
+            // the intervals are counted first to size every layout
+            uint32_t intervals = 0;
+            for (uint32_t k = 0; k < n; k++) { intervals += k == 0 || lows[k] != lows[k - 1] + 1; }
+
+            size_t arrayBytes = sizeof(uint16_t) * n;
+            size_t bitmapBytes = sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+            size_t runBytes = BitPack::countSize(intervals) + 2 * sizeof(uint16_t) * intervals;
+
+            c.values.clear();
+            c.bits.clear();
+            if (runBytes < arrayBytes && runBytes < bitmapBytes) {
+                c.type = ROARING_RUNS;
+                c.values.reserve(2 * intervals);
+                for (uint32_t k = 0; k < n; k++) {
+                    if (k == 0 || lows[k] != lows[k - 1] + 1) {
+                        c.values.push_back(lows[k]);
+                        c.values.push_back(lows[k]);
+                    }
+                    else {
+                        c.values.back() = lows[k];
+                    }
+                }
+            }
+            else if (arrayBytes <= bitmapBytes) {
+                c.type = ROARING_ARRAY;
+                c.values.assign(lows, lows + n);
+            }
+            else {
+                c.type = ROARING_BITMAP;
+                c.bits.assign(ROARING_BITMAP_WORDS, 0);
+                for (uint32_t k = 0; k < n; k++) { c.bits[lows[k] / 64] |= (uint64_t)1 << (lows[k] % 64); }
+            }
+        }
+
+        // Rebuilds a container from bitmap words in its smallest layout
+        static inline void fromBitmap(Container& c, const std::vector<uint64_t>& bits) {
+            std::vector<uint16_t> lows;
+            for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) {
+                for (uint64_t word = bits[w]; word != 0; word &= word - 1) { lows.push_back((uint16_t)(w * 64 + __builtin_ctzll(word))); }
+            }
+            fromSorted(c, lows.data(), lows.size());
+        }
+
+        // Number of indices two containers with the same key have in common
+        static inline uint32_t andCount(const Container& a, const Container& b) {
+            if (a.type == ROARING_BITMAP && b.type == ROARING_BITMAP) {
+                uint32_t count = 0;
+                for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) { count += __builtin_popcountll(a.bits[w] & b.bits[w]); }
+                return count;
+            }
+            if (a.type == ROARING_RUNS && b.type == ROARING_RUNS) {
+                // the overlaps of two interval lists, walked by their endpoints
+                uint32_t count = 0;
+                size_t i = 0, j = 0;
+                while (i < a.values.size() && j < b.values.size()) {
+                    uint32_t first = std::max(a.values[i], b.values[j]);
+                    uint32_t last = std::min(a.values[i + 1], b.values[j + 1]);
+                    if (first <= last) { count += last - first + 1; }
+                    if (a.values[i + 1] < b.values[j + 1]) { i += 2; }
+                    else { j += 2; }
+                }
+                return count;
+            }
+            if (a.type == ROARING_RUNS && b.type == ROARING_BITMAP) {
+                uint32_t count = 0;
+                for (size_t r = 0; r < a.values.size(); r += 2) { count += countRange(b.bits.data(), a.values[r], a.values[r + 1]); }
+                return count;
+            }
+            if (a.type == ROARING_BITMAP && b.type == ROARING_RUNS) { return andCount(b, a); }
+
+            // an array is probed against the other container, the smaller side is walked
+            const Container& small = a.type == ROARING_ARRAY && (b.type != ROARING_ARRAY || a.cardinality <= b.cardinality) ? a : b;
+            const Container& large = &small == &a ? b : a;
+            uint32_t count = 0;
+            for (uint16_t low : small.values) { count += containerHas(large, low); }
+            return count;
+        }
+
+        // Intersection of two containers with the same key
+        static inline Container andContainers(const Container& a, const Container& b) {
+            Container c;
+            c.key = a.key;
+
+            if (a.type == ROARING_ARRAY || b.type == ROARING_ARRAY) {
+                const Container& small = a.type == ROARING_ARRAY && (b.type != ROARING_ARRAY || a.cardinality <= b.cardinality) ? a : b;
+                const Container& large = &small == &a ? b : a;
+                std::vector<uint16_t> lows;
+                for (uint16_t low : small.values) {
+                    if (containerHas(large, low)) { lows.push_back(low); }
+                }
+                fromSorted(c, lows.data(), lows.size());
+            }
+            else if (a.type == ROARING_RUNS && b.type == ROARING_RUNS) {
+                std::vector<uint16_t> lows;
+                size_t i = 0, j = 0;
+                while (i < a.values.size() && j < b.values.size()) {
+                    uint32_t first = std::max(a.values[i], b.values[j]);
+                    uint32_t last = std::min(a.values[i + 1], b.values[j + 1]);
+                    for (uint32_t low = first; low <= last; low++) { lows.push_back((uint16_t)low); }
+                    if (a.values[i + 1] < b.values[j + 1]) { i += 2; }
+                    else { j += 2; }
+                }
+                fromSorted(c, lows.data(), lows.size());
+            }
+            else {
+                // at least one bitmap, so the result is at most as large as a bitmap
+                std::vector<uint64_t> bits = toBitmap(a);
+                std::vector<uint64_t> other = toBitmap(b);
+                for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) { bits[w] &= other[w]; }
+                fromBitmap(c, bits);
+            }
+            return c;
+        }
+
+        // Union of two containers with the same key
+        static inline Container orContainers(const Container& a, const Container& b) {
+            Container c;
+            c.key = a.key;
+
+            if (a.type != ROARING_BITMAP && b.type != ROARING_BITMAP) {
+                // merging the sorted indices keeps consecutive runs together for fromSorted
+                std::vector<uint16_t> lows;
+                std::vector<uint16_t> lowsB;
+                containerForEach(a, [&](uint16_t low) { lows.push_back(low); });
+                containerForEach(b, [&](uint16_t low) { lowsB.push_back(low); });
+
+                std::vector<uint16_t> merged;
+                merged.reserve(lows.size() + lowsB.size());
+                std::set_union(lows.begin(), lows.end(), lowsB.begin(), lowsB.end(), std::back_inserter(merged));
+                fromSorted(c, merged.data(), merged.size());
+            }
+            else {
+                std::vector<uint64_t> bits = toBitmap(a);
+                std::vector<uint64_t> other = toBitmap(b);
+                for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) { bits[w] |= other[w]; }
+                fromBitmap(c, bits);
+            }
+            return c;
+        }
+
+        public:
+
+        //* Constructors *//
+
+        /**
+         * Empty Set Constructor
+         */
+        IndexSet() {};
+
+        /**
+         * @param indices The indices of the set in ascending order without repeats
+         * @param n The number of indices
+         */
+        IndexSet(const uint32_t* indices, uint64_t n) {
+            std::vector<uint16_t> lows;
+            for (uint64_t start = 0; start < n;) {
+                uint16_t key = indices[start] >> 16;
+                uint64_t end = start;
+                lows.clear();
+                for (; end < n && (uint16_t)(indices[end] >> 16) == key; end++) { lows.push_back((uint16_t)indices[end]); }
+
+                containers.emplace_back();
+                containers.back().key = key;
+                fromSorted(containers.back(), lows.data(), lows.size());
+                start = end;
+            }
+        }
+
+        //* Encoding *//
+
+        /**
+         * @returns The number of bytes the set takes written out.
+         */
+        inline size_t byteSize() const {
+            size_t bytes = BitPack::countSize(containers.size());
+            for (const Container& c : containers) {
+                bytes += sizeof(uint16_t) + 1 + BitPack::countSize(c.cardinality - 1) + contentSize(c);
+            }
+            return bytes;
+        }
+
+        /**
+         * Writes the set to out, which needs byteSize() bytes.
+         *
+         * @returns The end of the written set.
+         */
+        inline uint8_t* write(uint8_t* out) const {
+            out = BitPack::writeCount(containers.size(), out);
+            for (const Container& c : containers) {
+                memcpy(out, &c.key, sizeof(uint16_t));
+                out += sizeof(uint16_t);
+                *out++ = c.type;
+                out = BitPack::writeCount(c.cardinality - 1, out);
+
+                if (c.type == ROARING_BITMAP) {
+                    memcpy(out, c.bits.data(), sizeof(uint64_t) * ROARING_BITMAP_WORDS);
+                    out += sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+                    continue;
+                }
+                if (c.type == ROARING_RUNS) { out = BitPack::writeCount(c.values.size() / 2, out); }
+                memcpy(out, c.values.data(), sizeof(uint16_t) * c.values.size());
+                out += sizeof(uint16_t) * c.values.size();
+            }
+            return out;
+        }
+
+        /**
+         * Replaces the set with one written by write().
+         *
+         * @returns The end of the written set.
+         */
+        inline const uint8_t* read(const uint8_t* in) {
+            uint64_t numContainers;
+            in = BitPack::readCount(in, numContainers);
+            containers.assign(numContainers, Container());
+
+            for (Container& c : containers) {
+                memcpy(&c.key, in, sizeof(uint16_t));
+                in += sizeof(uint16_t);
+                c.type = *in++;
+                uint64_t cardinality;
+                in = BitPack::readCount(in, cardinality);
+                c.cardinality = cardinality + 1;
+
+                if (c.type == ROARING_BITMAP) {
+                    c.bits.resize(ROARING_BITMAP_WORDS);
+                    memcpy(c.bits.data(), in, sizeof(uint64_t) * ROARING_BITMAP_WORDS);
+                    in += sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+                    continue;
+                }
+
+                uint64_t size = c.cardinality;
+                if (c.type == ROARING_RUNS) {
+                    in = BitPack::readCount(in, size);
+                    size *= 2;
+                }
+                c.values.resize(size);
+                memcpy(c.values.data(), in, sizeof(uint16_t) * size);
+                in += sizeof(uint16_t) * size;
+            }
+            return in;
+        }
+
+        /**
+         * Calls visit(index) for every index of a set written by write() without
+         * reading it into a set, in ascending order.
+         *
+         * @returns The end of the written set.
+         */
+        template <typename Visit>
+        static inline const uint8_t* forEachWritten(const uint8_t* in, Visit visit) {
+            uint64_t numContainers;
+            in = BitPack::readCount(in, numContainers);
+
+            for (uint64_t k = 0; k < numContainers; k++) {
+                uint16_t key;
+                memcpy(&key, in, sizeof(uint16_t));
+                uint32_t high = (uint32_t)key << 16;
+                uint8_t type = in[sizeof(uint16_t)];
+                uint64_t cardinality;
+                in = BitPack::readCount(in + sizeof(uint16_t) + 1, cardinality);
+                cardinality++;
+
+                if (type == ROARING_BITMAP) {
+                    for (uint32_t w = 0; w < ROARING_BITMAP_WORDS; w++) {
+                        uint64_t word;
+                        memcpy(&word, in + w * sizeof(uint64_t), sizeof(uint64_t));
+                        for (; word != 0; word &= word - 1) { visit(high | (w * 64 + __builtin_ctzll(word))); }
+                    }
+                    in += sizeof(uint64_t) * ROARING_BITMAP_WORDS;
+                }
+                else if (type == ROARING_RUNS) {
+                    uint64_t intervals;
+                    in = BitPack::readCount(in, intervals);
+                    for (uint64_t r = 0; r < intervals; r++) {
+                        uint16_t bounds[2];
+                        memcpy(bounds, in, sizeof(bounds));
+                        in += sizeof(bounds);
+                        for (uint32_t low = bounds[0]; low <= bounds[1]; low++) { visit(high | low); }
+                    }
+                }
+                else {
+                    for (uint64_t v = 0; v < cardinality; v++) {
+                        uint16_t low;
+                        memcpy(&low, in, sizeof(uint16_t));
+                        in += sizeof(uint16_t);
+                        visit(high | low);
+                    }
+                }
+            }
+            return in;
+        }
+
+        /**
+         * Skips over a set written by write() without reading its contents.
+         *
+         * @returns The end of the written set.
+         */
+        static inline const uint8_t* skipWritten(const uint8_t* in) {
+            uint64_t numContainers;
+            in = BitPack::readCount(in, numContainers);
+
+            for (uint64_t k = 0; k < numContainers; k++) {
+                uint8_t type = in[sizeof(uint16_t)];
+                uint64_t size;
+                in = BitPack::readCount(in + sizeof(uint16_t) + 1, size);
+                size++;
+
+                if (type == ROARING_BITMAP) { in += sizeof(uint64_t) * ROARING_BITMAP_WORDS; }
+                else {
+                    if (type == ROARING_RUNS) {
+                        in = BitPack::readCount(in, size);
+                        size *= 2;
+                    }
+                    in += sizeof(uint16_t) * size;
+                }
+            }
+            return in;
+        }
+
+        //* Queries *//
+
+        /**
+         * @returns The number of indices in the set.
+         */
+        inline uint64_t cardinality() const {
+            uint64_t count = 0;
+            for (const Container& c : containers) { count += c.cardinality; }
+            return count;
+        }
+
+        /**
+         * @returns True if the index is in the set.
+         */
+        inline bool contains(uint32_t index) const {
+            uint16_t key = index >> 16;
+            auto c = std::lower_bound(containers.begin(), containers.end(), key,
+                                      [](const Container& c, uint16_t key) { return c.key < key; });
+            return c != containers.end() && c->key == key && containerHas(*c, (uint16_t)index);
+        }
+
+        /**
+         * Calls visit(index) for every index of the set in ascending order.
+         */
+        template <typename Visit>
+        inline void forEach(Visit visit) const {
+            for (const Container& c : containers) {
+                uint32_t high = (uint32_t)c.key << 16;
+                containerForEach(c, [&](uint16_t low) { visit(high | low); });
+            }
+        }
+
+        //* Set Algebra *//
+
+        /**
+         * @returns The number of indices in both sets, without building their
+         * intersection.
+         */
+        inline uint64_t andCardinality(const IndexSet& other) const {
+            uint64_t count = 0;
+            size_t i = 0, j = 0;
+            while (i < containers.size() && j < other.containers.size()) {
+                if (containers[i].key < other.containers[j].key) { i++; }
+                else if (containers[i].key > other.containers[j].key) { j++; }
+                else { count += andCount(containers[i++], other.containers[j++]); }
+            }
+            return count;
+        }
+
+        /**
+         * @returns The indices in both sets.
+         */
+        inline IndexSet operator&(const IndexSet& other) const {
+            IndexSet result;
+            size_t i = 0, j = 0;
+            while (i < containers.size() && j < other.containers.size()) {
+                if (containers[i].key < other.containers[j].key) { i++; }
+                else if (containers[i].key > other.containers[j].key) { j++; }
+                else {
+                    Container c = andContainers(containers[i++], other.containers[j++]);
+                    if (c.cardinality > 0) { result.containers.push_back(std::move(c)); }
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @returns The indices in either set.
+         */
+        inline IndexSet operator|(const IndexSet& other) const {
+            IndexSet result;
+            size_t i = 0, j = 0;
+            while (i < containers.size() || j < other.containers.size()) {
+                if (j == other.containers.size() || (i < containers.size() && containers[i].key < other.containers[j].key)) {
+                    result.containers.push_back(containers[i++]);
+                }
+                else if (i == containers.size() || containers[i].key > other.containers[j].key) {
+                    result.containers.push_back(other.containers[j++]);
+                }
+                else {
+                    result.containers.push_back(orContainers(containers[i++], other.containers[j++]));
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @returns True if both sets have the same indices.
+         */
+        inline bool operator==(const IndexSet& other) const {
+            return cardinality() == other.cardinality() && andCardinality(other) == cardinality();
+        }
+    };
+
+}  // namespace IVSparse
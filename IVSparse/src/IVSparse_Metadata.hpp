@@ -0,0 +1,56 @@
+/**
+ * @file IVSparse_Metadata.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Matrix File Header Shared by All Levels
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Writes the metadata header of a matrix file. \n \n
+     * The header is NUM_META_DATA uint64_t in native byte order: compression
+     * level, inner dimension, outer dimension, number of non-zeros, value type
+     * and index type. The high half of the compression level word holds
+     * META_DATA_MAGIC so readers can tell this header from the older one.
+     */
+    inline void writeMetadata(FILE* fp, const uint64_t* metadata) {
+        uint64_t header[NUM_META_DATA];
+        memcpy(header, metadata, sizeof(uint64_t) * NUM_META_DATA);
+        header[0] = ((uint64_t)META_DATA_MAGIC << 32) | (uint32_t)metadata[0];
+
+        fwrite(header, sizeof(uint64_t), NUM_META_DATA, fp);
+    }
+
+    /**
+     * Reads the metadata header of a matrix file. \n \n
+     * Files written before the dimensions and nnz were widened have a header
+     * of NUM_META_DATA uint32_t with the same fields, so their second word is
+     * the inner dimension where the current header has META_DATA_MAGIC. The
+     * magic is above the range of a signed 32-bit index, so an old file only
+     * matches it if it had that exact number of rows with an unsigned index
+     * type. Old headers are widened on read.
+     *
+     * @returns False if the header could not be read.
+     */
+    inline bool readMetadata(FILE* fp, uint64_t* metadata) {
+        uint32_t words[2 * NUM_META_DATA];
+
+        if (fread(words, sizeof(uint32_t), NUM_META_DATA, fp) != NUM_META_DATA) { return false; }
+
+        // 32-bit header
+        if (words[1] != META_DATA_MAGIC) {
+            for (int i = 0; i < NUM_META_DATA; i++) { metadata[i] = words[i]; }
+            return true;
+        }
+
+        if (fread(words + NUM_META_DATA, sizeof(uint32_t), NUM_META_DATA, fp) != NUM_META_DATA) { return false; }
+        memcpy(metadata, words, sizeof(uint64_t) * NUM_META_DATA);
+        metadata[0] = (uint32_t)metadata[0];
+        return true;
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,263 @@
+/**
+ * @file IVSparse_Reorder.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Inner Index Reordering Before Compression
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * The ways innerPermutation() can order the inner indices (the rows of a
+     * column major matrix).
+     */
+    enum ReorderMethod : uint8_t {
+        REORDER_NONE = 0,  // Keep the original order
+        REORDER_NNZ = 1,   // Most non-zeros first
+        REORDER_GRAY = 2,  // Gray code order of the (outer index, value) pairs of each inner index
+        REORDER_RCM = 3    // Reverse Cuthill-McKee over the bipartite graph of the non-zeros
+    };
+
+    /**
+     * What reordering changed, filled in by makeReordered(). \n \n
+     * The traffic is an estimate of the bytes one matrix vector product moves:
+     * the compressed matrix once plus every cache line of the dense vector
+     * indexed by the inner indices that each outer vector touches, as if
+     * nothing stayed in cache between outer vectors.
+     */
+    struct ReorderReport {
+        size_t originalBytes = 0;   // byteSize() of the matrix in the original order
+        size_t reorderedBytes = 0;  // byteSize() of the reordered matrix
+
+        uint64_t originalTraffic = 0;   // Estimated bytes of a product in the original order
+        uint64_t reorderedTraffic = 0;  // Estimated bytes of a product after reordering
+    };
+
+    namespace Reorder {
+
+        // Bytes of the cache lines a product streams through
+        constexpr uint64_t cacheLine = 64;
+
+        // Number of cache lines of a dense vector of valueSize byte values the outer vectors touch
+        template <typename indexT2>
+        inline uint64_t denseLines(const indexT2* innerIndices, const indexT2* outerPtr, uint64_t outerDim, size_t valueSize) {
+            uint64_t lines = 0;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64) reduction(+ : lines)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                std::vector<uint64_t> touched;
+                touched.reserve(outerPtr[i + 1] - outerPtr[i]);
+                for (uint64_t k = outerPtr[i]; k < (uint64_t)outerPtr[i + 1]; k++) {
+                    touched.push_back((uint64_t)innerIndices[k] * valueSize / cacheLine);
+                }
+
+                std::sort(touched.begin(), touched.end());
+                lines += std::unique(touched.begin(), touched.end()) - touched.begin();
+            }
+            return lines;
+        }
+
+        // The outer index and value of every non-zero grouped by inner index, the transpose of the arrays
+        template <typename T2, typename indexT2>
+        inline void transpose(const T2* vals, const indexT2* innerIndices, const indexT2* outerPtr, uint64_t innerDim, uint64_t outerDim,
+                              std::vector<uint64_t>& innerPtr, std::vector<std::pair<uint64_t, T2>>& entries) {
+            innerPtr.assign(innerDim + 1, 0);
+            for (uint64_t k = 0; k < (uint64_t)outerPtr[outerDim]; k++) { innerPtr[innerIndices[k] + 1]++; }
+            for (uint64_t i = 0; i < innerDim; i++) { innerPtr[i + 1] += innerPtr[i]; }
+
+            // filled in outer order so each inner index lists its outer indices ascending
+            entries.resize(innerPtr[innerDim]);
+            std::vector<uint64_t> next(innerPtr.begin(), innerPtr.end() - 1);
+            for (uint64_t j = 0; j < outerDim; j++) {
+                for (uint64_t k = outerPtr[j]; k < (uint64_t)outerPtr[j + 1]; k++) {
+                    entries[next[innerIndices[k]]++] = std::make_pair(j, vals[k]);
+                }
+            }
+        }
+
+        // Inner indices ordered by reverse Cuthill-McKee, a breadth first search through the shared outer vectors
+        template <typename indexT2>
+        inline std::vector<uint64_t> cuthillMcKee(const indexT2* innerIndices, const indexT2* outerPtr, uint64_t innerDim, uint64_t outerDim,
+                                                  const std::vector<uint64_t>& innerPtr, const std::vector<uint64_t>& outerOf) {
+            auto degree = [&](uint64_t i) { return innerPtr[i + 1] - innerPtr[i]; };
+
+            // every component starts from its lowest degree inner index
+            std::vector<uint64_t> starts(innerDim);
+            std::iota(starts.begin(), starts.end(), 0);
+            std::stable_sort(starts.begin(), starts.end(), [&](uint64_t a, uint64_t b) { return degree(a) < degree(b); });
+
+            std::vector<bool> innerSeen(innerDim, false);
+            std::vector<bool> outerSeen(outerDim, false);
+            std::vector<uint64_t> order;
+            order.reserve(innerDim);
+
+            for (uint64_t start : starts) {
+                if (innerSeen[start]) continue;
+                innerSeen[start] = true;
+                order.push_back(start);
+
+                // order doubles as the queue, each outer vector is expanded once
+                for (uint64_t head = order.size() - 1; head < order.size(); head++) {
+                    uint64_t i = order[head];
+                    for (uint64_t k = innerPtr[i]; k < innerPtr[i + 1]; k++) {
+                        uint64_t j = outerOf[k];
+                        if (outerSeen[j]) continue;
+                        outerSeen[j] = true;
+
+                        size_t first = order.size();
+                        for (uint64_t p = outerPtr[j]; p < (uint64_t)outerPtr[j + 1]; p++) {
+                            if (!innerSeen[innerIndices[p]]) {
+                                innerSeen[innerIndices[p]] = true;
+                                order.push_back(innerIndices[p]);
+                            }
+                        }
+                        std::stable_sort(order.begin() + first, order.end(), [&](uint64_t a, uint64_t b) { return degree(a) < degree(b); });
+                    }
+                }
+            }
+
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+    }  // namespace Reorder
+
+    /**
+     * @tparam columnMajor Whether the arrays are CSC (true) or CSR (false)
+     * @param method How to order the inner indices
+     * @returns The permutation, the inner index i moves to permutation[i]
+     *
+     * Picks an order for the inner indices of the given CSC arrays that shrinks
+     * the gaps inside each run of a value. \n \n
+     * REORDER_GRAY sorts each inner index by its (outer index, value) pairs in
+     * Gray code order so neighbours differ in as few pairs as possible,
+     * REORDER_RCM keeps inner indices that share outer vectors together
+     * regardless of value and REORDER_NNZ moves the dense inner indices to the
+     * front. Small gaps go straight into narrower bit widths in the packed level
+     * and fewer cache lines touched by a product. The byte width levels also
+     * size a run by its first index, which is absolute, so they only shrink when
+     * the runs start early as well. makeReordered() reports whether they did.
+     * A dense vector indexed by inner index is permuted the same way with
+     * out[permutation[i]] = in[i].
+     */
+    template <bool columnMajor = true, typename T2, typename indexT2>
+    inline std::vector<uint64_t> innerPermutation(const T2* vals, const indexT2* innerIndices, const indexT2* outerPtr,
+                                                  uint64_t num_rows, uint64_t num_cols, ReorderMethod method) {
+        uint64_t innerDim = columnMajor ? num_rows : num_cols;
+        uint64_t outerDim = columnMajor ? num_cols : num_rows;
+
+        std::vector<uint64_t> innerPtr;
+        std::vector<std::pair<uint64_t, T2>> entries;
+        if (method != REORDER_NONE) { Reorder::transpose(vals, innerIndices, outerPtr, innerDim, outerDim, innerPtr, entries); }
+
+        // the inner indices in their new order
+        std::vector<uint64_t> order(innerDim);
+        std::iota(order.begin(), order.end(), 0);
+
+        switch (method) {
+        case REORDER_NNZ:
+            std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+                return innerPtr[a + 1] - innerPtr[a] > innerPtr[b + 1] - innerPtr[b];
+            });
+            break;
+
+        case REORDER_GRAY:
+            // two inner indices are compared at the first pair where they differ, which only one of them has. After an
+            // even number of shared pairs the one without that pair comes first, after an odd number the comparison
+            // flips, which is the reflected Gray code order of their pair sets.
+            std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+                uint64_t k = 0;
+                uint64_t lengthA = innerPtr[a + 1] - innerPtr[a], lengthB = innerPtr[b + 1] - innerPtr[b];
+                while (k < lengthA && k < lengthB && entries[innerPtr[a] + k] == entries[innerPtr[b] + k]) { k++; }
+                if (k == lengthA && k == lengthB) return false;
+
+                bool aHasIt = k == lengthB || (k < lengthA && entries[innerPtr[a] + k] < entries[innerPtr[b] + k]);
+                return aHasIt != (k % 2 == 0);
+            });
+            break;
+
+        case REORDER_RCM: {
+            std::vector<uint64_t> outerOf(entries.size());
+            for (size_t k = 0; k < entries.size(); k++) { outerOf[k] = entries[k].first; }
+            order = Reorder::cuthillMcKee(innerIndices, outerPtr, innerDim, outerDim, innerPtr, outerOf);
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        std::vector<uint64_t> permutation(innerDim);
+        for (uint64_t k = 0; k < innerDim; k++) { permutation[order[k]] = k; }
+        return permutation;
+    }
+
+    /**
+     * @tparam T The value type of the matrix
+     * @tparam indexT The index type of the matrix
+     * @tparam compressionLevel The level to build
+     * @tparam columnMajor Whether the arrays are CSC (true) or CSR (false)
+     * @param method How to order the inner indices
+     * @param permutation Set to the permutation that was applied, see innerPermutation()
+     * @param report When not nullptr, filled in with the size and traffic before and after
+     * @param operandSize Bytes of one element of the dense operand the traffic is estimated for,
+     * sizeof(accumT) for a product accumulated in accumT
+     *
+     * Builds a matrix from the given CSC arrays with its inner indices
+     * reordered by innerPermutation(). \n \n
+     * The product of the reordered matrix with a dense vector is the original
+     * product permuted along the inner dimension, so for a column major matrix
+     * the result is permuted back with y[i] = result[permutation[i]], and for a
+     * row major matrix the dense vector is permuted before the product. Filling
+     * in the report builds the matrix in the original order as well.
+     */
+    template <typename T, typename indexT, uint8_t compressionLevel = 3, bool columnMajor = true, typename T2, typename indexT2>
+    inline SparseMatrix<T, indexT, compressionLevel, columnMajor> makeReordered(T2* vals, indexT2* innerIndices, indexT2* outerPtr,
+                                                                                uint64_t num_rows, uint64_t num_cols, uint64_t nnz,
+                                                                                ReorderMethod method, std::vector<uint64_t>& permutation,
+                                                                                ReorderReport* report = nullptr, size_t operandSize = sizeof(T)) {
+        uint64_t outerDim = columnMajor ? num_cols : num_rows;
+
+        permutation = innerPermutation<columnMajor>(vals, innerIndices, outerPtr, num_rows, num_cols, method);
+
+        // relabel the inner indices and put each vector back in index order
+        std::vector<T2> newVals(nnz);
+        std::vector<indexT2> newInner(nnz);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            std::vector<std::pair<uint64_t, T2>> entries;
+            entries.reserve(outerPtr[i + 1] - outerPtr[i]);
+            for (uint64_t k = outerPtr[i]; k < (uint64_t)outerPtr[i + 1]; k++) {
+                entries.emplace_back(permutation[innerIndices[k]], vals[k]);
+            }
+            std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            for (size_t k = 0; k < entries.size(); k++) {
+                newInner[outerPtr[i] + k] = (indexT2)entries[k].first;
+                newVals[outerPtr[i] + k] = entries[k].second;
+            }
+        }
+
+        SparseMatrix<T, indexT, compressionLevel, columnMajor> reordered(newVals.data(), newInner.data(), outerPtr, num_rows, num_cols, nnz);
+
+        if (report != nullptr) {
+            SparseMatrix<T, indexT, compressionLevel, columnMajor> original(vals, innerIndices, outerPtr, num_rows, num_cols, nnz);
+            report->originalBytes = original.byteSize();
+            report->reorderedBytes = reordered.byteSize();
+
+            report->originalTraffic = report->originalBytes + Reorder::cacheLine * Reorder::denseLines(innerIndices, outerPtr, outerDim, operandSize);
+            report->reorderedTraffic = report->reorderedBytes + Reorder::cacheLine * Reorder::denseLines(newInner.data(), outerPtr, outerDim, operandSize);
+        }
+
+        return reordered;
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,258 @@
+/**
+ * @file IVSparse_Simd.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief SIMD Kernels over Runs of Indices and Dense Data with Runtime CPU Dispatch
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    #ifdef IVSPARSE_HAS_SIMD
+
+    // CPU features are only queried once
+    inline bool cpuHasAVX2() {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        return avx2;
+    }
+
+    inline bool cpuHasAVX512() {
+        static const bool avx512 = __builtin_cpu_supports("avx512f");
+        return avx512;
+    }
+
+    // Sums x at n indices, 256 bit gathers with a scalar tail.
+    // The gathers are masked with a zeroed source so no lane starts undefined.
+    template <typename T>
+    __attribute__((target("avx2"))) inline T gatherSumAVX2(const T* x, const int32_t* index, uint64_t n) {
+        T sum = 0;
+        uint64_t i = 0;
+
+        if constexpr (std::is_same_v<T, double>) {
+            const __m256d zero = _mm256_setzero_pd();
+            const __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+            __m256d acc = zero;
+            for (; i + 4 <= n; i += 4) {
+                __m128i idx = _mm_loadu_si128((const __m128i*)(index + i));
+                acc = _mm256_add_pd(acc, _mm256_mask_i32gather_pd(zero, x, idx, mask, 8));
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            __m256 acc = zero;
+            for (; i + 8 <= n; i += 8) {
+                __m256i idx = _mm256_loadu_si256((const __m256i*)(index + i));
+                acc = _mm256_add_ps(acc, _mm256_mask_i32gather_ps(zero, x, idx, mask, 4));
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, acc);
+            for (int l = 0; l < 8; l++) { sum += lanes[l]; }
+        }
+        else {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i mask = _mm256_set1_epi32(-1);
+            __m256i acc = zero;
+            for (; i + 8 <= n; i += 8) {
+                __m256i idx = _mm256_loadu_si256((const __m256i*)(index + i));
+                acc = _mm256_add_epi32(acc, _mm256_mask_i32gather_epi32(zero, (const int*)x, idx, mask, 4));
+            }
+            alignas(32) int32_t lanes[8];
+            _mm256_store_si256((__m256i*)lanes, acc);
+            for (int l = 0; l < 8; l++) { sum += lanes[l]; }
+        }
+
+        for (; i < n; i++) { sum += x[index[i]]; }
+        return sum;
+    }
+
+    // Adds value to y at n distinct indices, 512 bit gather/add/scatter with a scalar tail.
+    // The gathers are masked with a zeroed source so no lane starts undefined.
+    template <typename T>
+    __attribute__((target("avx512f"))) inline void scatterAddAVX512(T* y, const int32_t* index, uint64_t n, T value) {
+        uint64_t i = 0;
+
+        if constexpr (std::is_same_v<T, double>) {
+            __m512d add = _mm512_set1_pd(value);
+            __m512d zero = _mm512_setzero_pd();
+            for (; i + 8 <= n; i += 8) {
+                __m256i idx = _mm256_loadu_si256((const __m256i*)(index + i));
+                __m512d sum = _mm512_add_pd(_mm512_mask_i32gather_pd(zero, 0xFF, idx, y, 8), add);
+                _mm512_i32scatter_pd(y, idx, sum, 8);
+            }
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            __m512 add = _mm512_set1_ps(value);
+            __m512 zero = _mm512_setzero_ps();
+            for (; i + 16 <= n; i += 16) {
+                __m512i idx = _mm512_loadu_si512((const void*)(index + i));
+                __m512 sum = _mm512_add_ps(_mm512_mask_i32gather_ps(zero, 0xFFFF, idx, y, 4), add);
+                _mm512_i32scatter_ps(y, idx, sum, 4);
+            }
+        }
+        else {
+            __m512i add = _mm512_set1_epi32(value);
+            __m512i zero = _mm512_setzero_si512();
+            for (; i + 16 <= n; i += 16) {
+                __m512i idx = _mm512_loadu_si512((const void*)(index + i));
+                __m512i sum = _mm512_add_epi32(_mm512_mask_i32gather_epi32(zero, 0xFFFF, idx, (const int*)y, 4), add);
+                _mm512_i32scatter_epi32((int*)y, idx, sum, 4);
+            }
+        }
+
+        for (; i < n; i++) { y[index[i]] += value; }
+    }
+
+    // Finds the first of x[i, end) with a magnitude above epsilon, 256 bit compares with a scalar tail
+    template <typename T>
+    __attribute__((target("avx2"))) inline uint64_t nextNonZeroAVX2(const T* x, uint64_t i, uint64_t end, T epsilon) {
+        if constexpr (std::is_same_v<T, double>) {
+            __m256d eps = _mm256_set1_pd(epsilon);
+            __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+            for (; i + 4 <= end; i += 4) {
+                __m256d v = _mm256_and_pd(_mm256_loadu_pd(x + i), absMask);
+                int mask = _mm256_movemask_pd(_mm256_cmp_pd(v, eps, _CMP_GT_OQ));
+                if (mask) { return i + __builtin_ctz(mask); }
+            }
+        }
+        else {
+            __m256 eps = _mm256_set1_ps(epsilon);
+            __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+            for (; i + 8 <= end; i += 8) {
+                __m256 v = _mm256_and_ps(_mm256_loadu_ps(x + i), absMask);
+                int mask = _mm256_movemask_ps(_mm256_cmp_ps(v, eps, _CMP_GT_OQ));
+                if (mask) { return i + __builtin_ctz(mask); }
+            }
+        }
+
+        for (; i < end; i++) {
+            if (x[i] > epsilon || x[i] < -epsilon) { return i; }
+        }
+        return end;
+    }
+
+    #endif
+
+    /**
+     * Kernels for the runs of a VCSC vector, where one value is shared by a
+     * block of contiguous indices. \n \n
+     * The instruction set is picked once on construction. Sums gather with AVX2
+     * and scattered adds use AVX-512 gather/scatter. Both fall back to scalar
+     * loops for other CPUs, value types other than float, double and 32 bit
+     * integers, index types that are not 32 bits wide, or dense lengths that do
+     * not fit in a signed 32 bit lane offset. Vectorized sums add in a different
+     * order than the scalar loop so floating point results can differ by rounding.
+     */
+    template <typename T, typename indexT>
+    class RunKernels {
+        private:
+
+        static constexpr bool vectorizable = sizeof(indexT) == 4 &&
+            (std::is_same_v<T, double> || std::is_same_v<T, float> || std::is_same_v<T, int32_t>);
+
+        bool gatherSIMD = false;
+        bool scatterSIMD = false;
+
+        public:
+
+        // length is the size of the dense vector the indices point into
+        RunKernels(uint64_t length) {
+            #ifdef IVSPARSE_HAS_SIMD
+            if constexpr (vectorizable) {
+                if (length <= INT32_MAX) {
+                    gatherSIMD = cpuHasAVX2();
+                    scatterSIMD = cpuHasAVX512();
+                }
+            }
+            #endif
+        }
+
+        // Returns the sum of x over n indices
+        inline T gatherSum(const T* x, const indexT* index, uint64_t n) const {
+            #ifdef IVSPARSE_HAS_SIMD
+            if constexpr (vectorizable) {
+                if (gatherSIMD) { return gatherSumAVX2<T>(x, (const int32_t*)index, n); }
+            }
+            #endif
+
+            T sum = 0;
+            for (uint64_t i = 0; i < n; i++) { sum += x[index[i]]; }
+            return sum;
+        }
+
+        // Adds value to y at n indices, which must be distinct
+        inline void scatterAdd(T* y, const indexT* index, uint64_t n, T value) const {
+            #ifdef IVSPARSE_HAS_SIMD
+            if constexpr (vectorizable) {
+                if (scatterSIMD) { scatterAddAVX512<T>(y, (const int32_t*)index, n, value); return; }
+            }
+            #endif
+
+            for (uint64_t i = 0; i < n; i++) { y[index[i]] += value; }
+        }
+    };
+
+    /**
+     * Finds the entries of dense data that are kept when it is compressed, those
+     * with a magnitude above epsilon. \n \n
+     * Contiguous float and double data is searched with AVX2 compares that skip
+     * whole blocks of zeros when the CPU supports it, picked once on construction.
+     * Other value types and strided data use a scalar loop. NaN is never kept.
+     */
+    template <typename T>
+    class ZeroScanner {
+        private:
+
+        static constexpr bool vectorizable = std::is_same_v<T, double> || std::is_same_v<T, float>;
+
+        T epsilon;
+        bool simd = false;
+
+        public:
+
+        ZeroScanner(T epsilon) : epsilon(epsilon) {
+            #ifdef IVSPARSE_HAS_SIMD
+            if constexpr (vectorizable) { simd = cpuHasAVX2(); }
+            #endif
+        }
+
+        // Returns true if the value is kept
+        inline bool keep(T value) const {
+            if constexpr (std::is_unsigned_v<T>) { return value > epsilon; }
+            else { return value > epsilon || value < -epsilon; }
+        }
+
+        // Returns the first kept index of x in [i, end), or end if there is none
+        inline uint64_t next(const T* x, uint64_t i, uint64_t end) const {
+            #ifdef IVSPARSE_HAS_SIMD
+            if constexpr (vectorizable) {
+                if (simd) { return nextNonZeroAVX2<T>(x, i, end, epsilon); }
+            }
+            #endif
+
+            for (; i < end; i++) {
+                if (keep(x[i])) { return i; }
+            }
+            return end;
+        }
+
+        // Calls visit(index, value) for each kept entry of a length long vector with the given stride
+        template <typename Visit>
+        inline void scan(const T* x, uint64_t length, uint64_t stride, Visit visit) const {
+            if (stride == 1) {
+                for (uint64_t i = next(x, 0, length); i < length; i = next(x, i + 1, length)) { visit(i, x[i]); }
+                return;
+            }
+
+            for (uint64_t i = 0; i < length; i++) {
+                if (keep(x[i * stride])) { visit(i, x[i * stride]); }
+            }
+        }
+    };
+
+}  // namespace IVSparse
@@ -0,0 +1,362 @@
+/**
+ * @file IVSparse_Stats.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Summary Statistics and Reductions Shared by all Compression Levels
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Count, mean and sum of squared deviations (M2) of a group of values. \n \n
+     * Values are added one at a time with Welford's update and groups are
+     * merged with the parallel formula of Chan et al. Neither subtracts two
+     * large sums, so the variance keeps its precision when the mean is large
+     * next to the spread.
+     */
+    struct Moments {
+        uint64_t count = 0;
+        double mean = 0;
+        double m2 = 0;
+
+        // Adds copies of the same value
+        inline void add(double value, uint64_t copies = 1) {
+            uint64_t total = count + copies;
+            double delta = value - mean;
+            mean += delta * copies / total;
+            m2 += delta * delta * ((double)count * copies / total);
+            count = total;
+        }
+
+        // Merges another group into this one
+        inline void merge(const Moments& other) {
+            if (other.count == 0) return;
+            uint64_t total = count + other.count;
+            double delta = other.mean - mean;
+            mean += delta * other.count / total;
+            m2 += other.m2 + delta * delta * ((double)count * other.count / total);
+            count = total;
+        }
+    };
+
+    /**
+     * Per vector summary statistics returned by columnStats() and rowStats(). \n \n
+     * Every member holds one entry per column (or row). The mean, variance and
+     * dispersion are taken over the full length of the vector so implicit zeros
+     * are counted. Variance is the unbiased (n - 1) sample variance and dispersion
+     * is variance / mean, which is left at 0 for vectors with a mean of 0.
+     */
+    struct SummaryStats {
+        std::vector<uint64_t> nnz;       // Number of stored non-zeros
+        std::vector<double> sum;         // Sum of the values
+        std::vector<double> sumSq;       // Sum of the squared values
+        std::vector<double> mean;        // Mean of the vector
+        std::vector<double> variance;    // Sample variance of the vector
+        std::vector<double> dispersion;  // Variance over mean
+
+        SummaryStats() {};
+
+        SummaryStats(size_t size) : nnz(size), sum(size), sumSq(size), mean(size), variance(size), dispersion(size) {};
+
+        // Fills in nnz, mean, variance and dispersion from the moments of the non-zeros of each vector
+        inline void finalize(std::vector<Moments>& moments, uint64_t length) {
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for
+            #endif
+            for (int64_t i = 0; i < (int64_t)sum.size(); i++) {
+                Moments& m = moments[i];
+                nnz[i] = m.count;
+
+                // the implicit zeros are a group with a mean and M2 of 0
+                Moments zeros;
+                zeros.count = length - m.count;
+                m.merge(zeros);
+
+                mean[i] = m.mean;
+                if (length > 1) { variance[i] = m.m2 / (length - 1); }
+                dispersion[i] = mean[i] == 0 ? 0 : variance[i] / mean[i];
+            }
+        }
+    };
+
+    // Number of partial buffers used for scatter (inner dimension) reductions.
+    // This only depends on the shape of the matrix so the order floating point
+    // partials are added in, and therefore the result, does not change with the
+    // number of threads.
+    inline uint32_t reductionBlocks(uint64_t outerDim, uint64_t innerDim) {
+        uint64_t blocks = IVSPARSE_REDUCTION_BLOCKS;
+
+        // cap the buffer space at roughly REDUCTION_BUFFER_MAX entries
+        if (innerDim > 0 && blocks * innerDim > REDUCTION_BUFFER_MAX)
+            blocks = REDUCTION_BUFFER_MAX / innerDim;
+
+        if (blocks > outerDim) blocks = outerDim;
+        return blocks == 0 ? 1 : (uint32_t)blocks;
+    }
+
+    /**
+     * Accumulates per inner index statistics for a matrix. \n \n
+     * The outer vectors are split into reductionBlocks() fixed ranges that are
+     * processed in parallel into private buffers. The buffers are then merged
+     * in block order. scatter(vec, sum, sumSq, moments) must add the entries of
+     * outer vector vec into the given buffers.
+     */
+    template <typename Scatter>
+    inline void blockedInnerStats(uint64_t outerDim, uint64_t innerDim, SummaryStats& stats, Scatter scatter) {
+        uint32_t blocks = reductionBlocks(outerDim, innerDim);
+
+        std::vector<double> sums((size_t)blocks * innerDim);
+        std::vector<double> sumSqs((size_t)blocks * innerDim);
+        std::vector<Moments> moments((size_t)blocks * innerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (uint32_t b = 0; b < blocks; b++) {
+            uint64_t start = (uint64_t)outerDim * b / blocks;
+            uint64_t end = (uint64_t)outerDim * (b + 1) / blocks;
+            size_t offset = (size_t)b * innerDim;
+
+            for (uint64_t i = start; i < end; i++) {
+                scatter(i, sums.data() + offset, sumSqs.data() + offset, moments.data() + offset);
+            }
+        }
+
+        // merge the partial buffers in block order, into the first block
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for
+        #endif
+        for (int64_t j = 0; j < (int64_t)innerDim; j++) {
+            for (uint32_t b = 0; b < blocks; b++) {
+                size_t offset = (size_t)b * innerDim + j;
+                stats.sum[j] += sums[offset];
+                stats.sumSq[j] += sumSqs[offset];
+                if (b > 0) { moments[j].merge(moments[offset]); }
+            }
+        }
+
+        moments.resize(innerDim);
+        stats.finalize(moments, outerDim);
+    }
+
+    /**
+     * Adds scattered contributions along the inner dimension into result. \n \n
+     * Uses the same fixed ranges of outer vectors as blockedInnerStats() so the
+     * result does not change with the number of threads. scatter(vec, buffer)
+     * must add the contribution of outer vector vec into buffer.
+     */
+    template <typename T, typename Scatter>
+    inline void blockedInnerSum(uint64_t outerDim, uint64_t innerDim, T* result, Scatter scatter) {
+        uint32_t blocks = reductionBlocks(outerDim, innerDim);
+
+        // a single block can go straight into the result
+        if (blocks == 1) {
+            for (uint64_t i = 0; i < outerDim; i++) { scatter(i, result); }
+            return;
+        }
+
+        std::vector<T> sums((size_t)blocks * innerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (uint32_t b = 0; b < blocks; b++) {
+            uint64_t start = (uint64_t)outerDim * b / blocks;
+            uint64_t end = (uint64_t)outerDim * (b + 1) / blocks;
+
+            for (uint64_t i = start; i < end; i++) {
+                scatter(i, sums.data() + (size_t)b * innerDim);
+            }
+        }
+
+        // merge the partial buffers in block order
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for
+        #endif
+        for (int64_t j = 0; j < (int64_t)innerDim; j++) {
+            for (uint32_t b = 0; b < blocks; b++) {
+                result[j] += sums[(size_t)b * innerDim + j];
+            }
+        }
+    }
+
+    /**
+     * Finds the minimum or maximum of each inner vector of a matrix. \n \n
+     * Each of the reductionBlocks() ranges of outer vectors is reduced into its
+     * own buffer and the buffers are merged once at the end. Vectors with fewer
+     * than outerDim non-zeros also compare against their implicit zeros. Ties go
+     * to the smallest outer index. When indices is not nullptr it is filled with
+     * the outer index of each extreme. scatter(vec, visit) must call
+     * visit(index, value) for every entry of outer vector vec.
+     */
+    template <typename T, bool isMax, typename Scatter>
+    inline std::vector<T> blockedInnerExtremes(uint64_t outerDim, uint64_t innerDim, std::vector<uint64_t>* indices, Scatter scatter) {
+        uint32_t blocks = reductionBlocks(outerDim, innerDim);
+
+        std::vector<T> best((size_t)blocks * innerDim);
+        std::vector<uint64_t> arg((size_t)blocks * innerDim);
+        std::vector<uint64_t> counts((size_t)blocks * innerDim);
+
+        // leading run of consecutive outer vectors containing each index, used to find
+        // the first implicit zero
+        std::vector<uint64_t> lead(indices == nullptr ? 0 : (size_t)blocks * innerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (uint32_t b = 0; b < blocks; b++) {
+            uint64_t start = (uint64_t)outerDim * b / blocks;
+            uint64_t end = (uint64_t)outerDim * (b + 1) / blocks;
+            size_t offset = (size_t)b * innerDim;
+
+            T* blockBest = best.data() + offset;
+            uint64_t* blockArg = arg.data() + offset;
+            uint64_t* blockCount = counts.data() + offset;
+            uint64_t* blockLead = indices == nullptr ? nullptr : lead.data() + offset;
+
+            for (uint64_t i = start; i < end; i++) {
+                scatter(i, [&](uint64_t index, T value) {
+                    if (blockCount[index] == 0 || (isMax ? value > blockBest[index] : value < blockBest[index])) {
+                        blockBest[index] = value;
+                        blockArg[index] = i;
+                    }
+                    blockCount[index]++;
+
+                    if (blockLead != nullptr && blockLead[index] == i - start) { blockLead[index]++; }
+                });
+            }
+        }
+
+        std::vector<T> result(innerDim);
+        if (indices != nullptr) { indices->assign(innerDim, 0); }
+
+        // merge the blocks in order so ties keep the smallest outer index
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for
+        #endif
+        for (int64_t j = 0; j < (int64_t)innerDim; j++) {
+            bool found = false;
+            T value = 0;
+            uint64_t index = 0;
+            uint64_t total = 0;
+
+            for (uint32_t b = 0; b < blocks; b++) {
+                size_t offset = (size_t)b * innerDim + j;
+                if (counts[offset] == 0) continue;
+
+                total += counts[offset];
+                if (!found || (isMax ? best[offset] > value : best[offset] < value)) {
+                    value = best[offset];
+                    index = arg[offset];
+                    found = true;
+                }
+            }
+
+            // compare against the implicit zeros
+            if (total < outerDim && (!found || (isMax ? value < 0 : value > 0))) {
+                value = 0;
+
+                if (indices != nullptr) {
+                    for (uint32_t b = 0; b < blocks; b++) {
+                        uint64_t start = (uint64_t)outerDim * b / blocks;
+                        uint64_t end = (uint64_t)outerDim * (b + 1) / blocks;
+
+                        if (lead[(size_t)b * innerDim + j] < end - start) {
+                            index = start + lead[(size_t)b * innerDim + j];
+                            break;
+                        }
+                    }
+                }
+            }
+
+            result[j] = value;
+            if (indices != nullptr) { (*indices)[j] = index; }
+        }
+
+        return result;
+    }
+
+    /**
+     * Average value redundancy of the outer vectors of a matrix. \n \n
+     * count(vec, unique, nnz) must set the number of unique values and the
+     * number of non-zeros of outer vector vec. The redundancy of a vector is
+     * 1 - unique / nnz, or 1 when it holds a single value, and empty vectors are
+     * skipped. The vectors are counted in parallel but their terms are added in
+     * order so the result does not change with the number of threads.
+     */
+    template <typename Count>
+    inline double averageRedundancy(uint64_t outerDim, Count count) {
+        std::vector<double> redundancy(outerDim, -1);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            uint64_t unique = 0, nnz = 0;
+            count(i, unique, nnz);
+
+            if (nnz == 0) continue;
+            redundancy[i] = unique == 1 ? 1 : 1 - (double)unique / nnz;
+        }
+
+        double total = 0;
+        uint64_t vectors = 0;
+        for (uint64_t i = 0; i < outerDim; i++) {
+            if (redundancy[i] < 0) continue;
+            total += redundancy[i];
+            vectors++;
+        }
+        return vectors == 0 ? 0 : total / vectors;
+    }
+
+    /**
+     * Counts how many non-zeros of a matrix hold each value. \n \n
+     * histogram(vec) must return the (value, count) pairs of outer vector vec.
+     * Each of the reductionBlocks() ranges of outer vectors is counted into its
+     * own map in parallel and the maps are merged once at the end, so the work
+     * is proportional to the number of unique values per vector, not the
+     * number of non-zeros.
+     */
+    template <typename T, typename Histogram>
+    inline std::map<T, uint64_t> valueCounts(uint64_t outerDim, Histogram histogram) {
+        uint32_t blocks = reductionBlocks(outerDim, 0);
+        std::vector<std::map<T, uint64_t>> partial(blocks);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (uint32_t b = 0; b < blocks; b++) {
+            uint64_t start = (uint64_t)outerDim * b / blocks;
+            uint64_t end = (uint64_t)outerDim * (b + 1) / blocks;
+
+            for (uint64_t i = start; i < end; i++) {
+                for (auto& [value, count] : histogram(i)) { partial[b][value] += count; }
+            }
+        }
+
+        // merge the blocks into the first one
+        for (uint32_t b = 1; b < blocks; b++) {
+            for (auto& [value, count] : partial[b]) { partial[0][value] += count; }
+        }
+        return std::move(partial[0]);
+    }
+
+    // Shannon entropy in bits of the distribution given by counts
+    template <typename T>
+    inline double valueEntropy(const std::map<T, uint64_t>& counts) {
+        uint64_t total = 0;
+        for (auto& [value, count] : counts) { total += count; }
+        if (total == 0) return 0;
+
+        double entropy = 0;
+        for (auto& [value, count] : counts) {
+            double p = (double)count / total;
+            entropy -= p * std::log2(p);
+        }
+        return entropy;
+    }
+
+}  // namespace IVSparse
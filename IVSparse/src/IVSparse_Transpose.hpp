@@ -0,0 +1,94 @@
+/**
+ * @file IVSparse_Transpose.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Counting Sort Transpose Shared by the Compressed Levels
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Sorts the entries of a matrix into the vectors of its transpose. \n \n
+     * decode(vec, visit) must call visit(index, value) for every entry of the
+     * vector. The outer vectors are split into contiguous chunks that each count
+     * their entries per inner index, and the prefix sum of those histograms in
+     * (inner index, chunk) order gives every chunk its own write position. The
+     * chunks then scatter (value, outer index) in parallel, so the entries of
+     * each transposed vector come out in outer order without any locking. Last
+     * each transposed vector is sorted by value so equal values are contiguous
+     * with their indices still ascending. \n \n
+     * On return transposed vector i is entries[offsets[i], offsets[i + 1]).
+     * Peak memory is nnz * sizeof(std::pair<T, indexT>) for the entries, which
+     * is the uncompressed size of the matrix whatever its level, plus
+     * chunks * innerDim 8 byte counters. The number of chunks is capped so the
+     * histograms never outgrow the entries.
+     */
+    template <typename T, typename indexT, typename Decode>
+    inline void transposeEntries(uint64_t outerDim, uint64_t innerDim, uint64_t nnz, Decode decode,
+                                 std::vector<uint64_t>& offsets, std::vector<std::pair<T, indexT>>& entries) {
+
+        // one chunk per thread, but no more than there are non-zeros per inner index
+        uint64_t chunks = 1;
+        #ifdef IVSPARSE_HAS_OPENMP
+        chunks = omp_get_max_threads();
+        #endif
+        chunks = std::max<uint64_t>(1, std::min<uint64_t>({ chunks, nnz / std::max<uint64_t>(innerDim, 1), outerDim }));
+
+        // ---- Stage 1: Count the entries of each inner index per chunk ---- //
+
+        std::vector<uint64_t> histogram(chunks * innerDim, 0);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (int64_t c = 0; c < (int64_t)chunks; c++) {
+            uint64_t* count = histogram.data() + c * innerDim;
+            for (uint64_t i = outerDim * c / chunks; i < outerDim * (c + 1) / chunks; i++) {
+                decode(i, [&](uint64_t index, T) { count[index]++; });
+            }
+        }
+
+        // ---- Stage 2: Prefix sum into write positions ---- //
+
+        offsets.assign((size_t)innerDim + 1, 0);
+        uint64_t position = 0;
+        for (uint64_t r = 0; r < innerDim; r++) {
+            for (uint64_t c = 0; c < chunks; c++) {
+                uint64_t count = histogram[c * innerDim + r];
+                histogram[c * innerDim + r] = position;
+                position += count;
+            }
+            offsets[r + 1] = position;
+        }
+
+        // ---- Stage 3: Scatter the entries ---- //
+
+        entries.resize(nnz);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(static, 1)
+        #endif
+        for (int64_t c = 0; c < (int64_t)chunks; c++) {
+            uint64_t* next = histogram.data() + c * innerDim;
+            for (uint64_t i = outerDim * c / chunks; i < outerDim * (c + 1) / chunks; i++) {
+                decode(i, [&](uint64_t index, T value) { entries[next[index]++] = { value, (indexT)i }; });
+            }
+        }
+
+        // free the histograms before the output is built from the entries
+        std::vector<uint64_t>().swap(histogram);
+
+        // ---- Stage 4: Group each transposed vector by value ---- //
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t r = 0; r < (int64_t)innerDim; r++) {
+            std::sort(entries.begin() + offsets[r], entries.begin() + offsets[r + 1]);
+        }
+    }
+
+}  // namespace IVSparse
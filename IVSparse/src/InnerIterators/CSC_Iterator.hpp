@@ -47,7 +47,7 @@ namespace IVSparse {
          * will forward traverse over the given vector of the matrix. The traversal
          * is sorted by index.
          */
-        InnerIterator(SparseMatrix<T, indexT, 1, columnMajor>& mat, uint32_t vec);
+        InnerIterator(SparseMatrix<T, indexT, 1, columnMajor>& mat, uint64_t vec);
 
         /**
          * CSC Vector InnerIterator Constructor \n \n
@@ -56,6 +56,13 @@ namespace IVSparse {
          */
         InnerIterator(SparseMatrix<T, indexT, 1, columnMajor>::Vector& vec);
 
+        /**
+         * CSC Vector View InnerIterator Constructor \n \n
+         * Iterates over the vector of the parent matrix the view points to, the
+         * same as the matrix constructor.
+         */
+        InnerIterator(SparseMatrix<T, indexT, 1, columnMajor>::VectorView& view);
+
         ///@}
 
         //* Getters *//
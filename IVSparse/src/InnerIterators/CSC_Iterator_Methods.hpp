@@ -15,7 +15,7 @@ namespace IVSparse {
     // CSC Matrix Constructor
     template <typename T, typename indexT, bool columnMajor>
     inline SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator::InnerIterator(
-        SparseMatrix<T, indexT, 1, columnMajor>& mat, uint32_t vec) {
+        SparseMatrix<T, indexT, 1, columnMajor>& mat, uint64_t vec) {
 
         this->outer = vec;
 
@@ -44,16 +44,30 @@ namespace IVSparse {
 
         this->outer = 0;
 
+        // check if the vector is empty
+        if (vec.nonZeros() == 0) {
+            vals = nullptr;
+            indices = nullptr;
+            endPtr = nullptr;
+            return;
+        }
+
         // set the pointers to the correct locations
-        vals = vec.values();
-        indices = vec.indexPtr();
-        endPtr = vec.indexPtr() + vec.nonZeros();
+        vals = vec.getValues();
+        indices = vec.getInnerIndices();
+        endPtr = vec.getInnerIndices() + vec.nonZeros();
 
         // set the values of the iterator
         val = vals;
         index = indices[0];
     }
 
+    // CSC Vector View Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 1, columnMajor>::InnerIterator::InnerIterator(
+        SparseMatrix<T, indexT, 1, columnMajor>::VectorView& view)
+        : InnerIterator(view.getMatrix(), view.vectorIndex()) {}
+
     //* Overloaded Operators *//
 
     // Increment Operator
@@ -0,0 +1,110 @@
+/**
+ * @file Dictionary_Iterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Inner Iterator for Dictionary Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Dictionary Inner Iterator Class \n \n
+     * The Dictionary Inner Iterator is a forward traversal iterator over the
+     * non-zeros of one vector of a Dictionary matrix. The traversal is grouped
+     * by value in ascending order and each run looks its value up in the
+     * dictionary once.
+     *
+     * @note Values can't be changed through the iterator as a dictionary entry
+     * is shared by every vector.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator {
+        private:
+        //* Private Class Variables *//
+
+        indexT outer = 0;  // Outer dimension
+        indexT index = 0;  // Current index
+        T val = 0;         // Current value
+
+        T* dictionary = nullptr;  // The dictionary of the matrix
+        uint8_t codeWidth = 1;    // Width of the codes
+
+        uint8_t* data = nullptr;    // Current index in the vector
+        uint8_t* endPtr = nullptr;  // End of the vector
+        uint8_t indexWidth = 1;     // Width of the current run
+
+        //* Private Class Methods *//
+
+        // Moves the iterator onto the run starting at data
+        inline void readRun();
+
+        // Reads the index at data
+        inline uint64_t decodeIndex();
+
+        public:
+        //* Constructors & Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        InnerIterator() {};
+
+        /**
+         * Dictionary Matrix InnerIterator Constructor \n \n
+         * The main constructor for the Inner Iterator. Given a matrix the iterator
+         * will forward traverse over the given vector of the matrix.
+         */
+        InnerIterator(SparseMatrix<T, indexT, 5, columnMajor>& mat, uint64_t vec);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The current index of the iterator.
+          */
+        indexT getIndex();
+
+        /**
+         * @returns The current outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * @returns The current row of the iterator.
+         */
+        indexT row();
+
+        /**
+         * @returns The current column of the iterator.
+         */
+        indexT col();
+
+        /**
+         * @returns The current value of the iterator.
+         */
+        T value();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Prefix increment operator
+        void __attribute__((hot)) operator++();
+
+        // Boolean operator
+        inline __attribute__((hot)) operator bool() { return data < endPtr; }
+
+    };  // End of Dictionary Inner Iterator Class
+
+}  // namespace IVSparse
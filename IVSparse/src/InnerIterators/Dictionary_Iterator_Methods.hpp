@@ -0,0 +1,128 @@
+/**
+ * @file Dictionary_Iterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Iterator Methods for Dictionary Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    inline SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, 5, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "The vector index is out of bounds!");
+        #endif
+
+        outer = vec;
+
+        // check if the vector is empty
+        if (matrix.data[vec] == nullptr) return;
+
+        dictionary = matrix.dictionary;
+        codeWidth = matrix.codeWidth;
+
+        data = (uint8_t*)matrix.data[vec];
+        endPtr = (uint8_t*)matrix.endPointers[vec];
+
+        readRun();
+    }
+
+    //* Private Class Methods *//
+
+    // Moves the iterator onto the run starting at data
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::readRun() {
+        // look the value of the run up once
+        uint32_t code = 0;
+        memcpy(&code, data, codeWidth);
+        val = dictionary[code];
+        data += codeWidth;
+
+        indexWidth = *data;
+        data += 1;
+
+        index = decodeIndex();
+    }
+
+    // Reads the index at data
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::decodeIndex() {
+        switch (indexWidth) {
+        case 1:
+            return *data;
+        case 2:
+            return *(uint16_t*)data;
+        case 4:
+            return *(uint32_t*)data;
+        default:
+            return *(uint64_t*)data;
+        }
+    }
+
+    //* Getters *//
+
+    // Get the outer dimension
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::outerDim() {
+        return outer;
+    }
+
+    // Get the value
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::value() {
+        return val;
+    }
+
+    // Get the index
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::getIndex() {
+        return index;
+    }
+
+    // Get the current row
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::row() {
+        if constexpr (!columnMajor) {
+            return outer;
+        }
+        else {
+            return index;
+        }
+    }
+
+    // Get the current column
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::col() {
+        if constexpr (!columnMajor) {
+            return index;
+        }
+        else {
+            return outer;
+        }
+    }
+
+    //* Operator Overloads *//
+
+    // Increment Operator
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 5, columnMajor>::InnerIterator::operator++() {
+        data += indexWidth;
+        uint64_t delta = decodeIndex();
+
+        // a delimiter ends the run
+        if (delta == 0) {
+            data += indexWidth;
+            if (data < endPtr) { readRun(); }
+            return;
+        }
+        index += delta;
+    }
+
+}  // namespace IVSparse
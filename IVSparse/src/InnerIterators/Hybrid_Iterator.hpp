@@ -0,0 +1,140 @@
+/**
+ * @file Hybrid_Iterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Inner Iterator for Hybrid Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Hybrid Inner Iterator Class \n \n
+     * The Hybrid Inner Iterator is a forward traversal iterator over one vector
+     * of a Hybrid matrix. It reads the tag of the vector once and picks the
+     * step function of that encoding, so stepping never branches on the tag.
+     * CSC and dense vectors are traversed in index order, VCSC and IVCSC
+     * vectors sorted by value in ascending order.
+     *
+     * @note For whole vector calculations SparseMatrix::forEachEntry() is
+     * faster as its loops are inlined instead of called once per step.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator {
+        private:
+        //* Private Class Variables *//
+
+        uint8_t tag = HYBRID_CSC;  // The encoding of the vector
+        bool active = false;       // If the iterator points at a non-zero
+
+        indexT outer = 0;   // Outer dimension
+        indexT index = 0;   // Current index
+        T* val = nullptr;   // Current value
+        T* valsEnd = nullptr;  // End of the values of CSC and dense vectors
+
+        indexT* indices = nullptr;  // Current index of CSC and VCSC vectors
+        indexT* counts = nullptr;   // Current count of VCSC vectors
+        indexT count = 0;           // Indices left in the current VCSC run
+        indexT runsLeft = 0;        // VCSC runs left after the current one
+
+        uint64_t* bitmap = nullptr;  // Current word of dense vectors
+        uint64_t bits = 0;           // Unvisited bits of the current word
+
+        uint8_t* data = nullptr;    // Current position in IVCSC vectors
+        uint8_t* endPtr = nullptr;  // End of IVCSC vectors
+        uint8_t indexWidth = 1;     // Width of the current IVCSC run
+
+        void (InnerIterator::*step)() = nullptr;  // Step function of the encoding
+
+        //* Private Class Methods *//
+
+        // Moves an IVCSC iterator onto the run starting at data
+        inline void readRun();
+
+        // Step functions of each encoding, picked once by the constructor
+        inline void stepCSC();
+        inline void stepDense();
+        inline void stepVCSC();
+        inline void stepIVCSC();
+
+        public:
+        //* Constructors & Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        InnerIterator() {};
+
+        /**
+         * Hybrid Matrix InnerIterator Constructor \n \n
+         * The main constructor for the Inner Iterator. Given a matrix the iterator
+         * will forward traverse over the given vector of the matrix.
+         */
+        InnerIterator(SparseMatrix<T, indexT, 4, columnMajor>& mat, uint64_t vec);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The current index of the iterator.
+          */
+        indexT getIndex();
+
+        /**
+         * @returns The current outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * @returns The current row of the iterator.
+         */
+        indexT row();
+
+        /**
+         * @returns The current column of the iterator.
+         */
+        indexT col();
+
+        /**
+         * @returns The current value of the iterator.
+         */
+        T value();
+
+        /**
+         * Changes the value where the iterator is pointing.
+         *
+         * @note In VCSC and IVCSC vectors this changes every element of the run.
+         */
+        void coeff(T newValue);
+
+        /**
+         * @returns The encoding of the vector being traversed.
+         */
+        IVSparse::HybridEncoding encoding() { return (IVSparse::HybridEncoding)tag; }
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Prefix increment operator
+        inline void __attribute__((hot)) operator++() { (this->*step)(); }
+
+        // Boolean operator
+        inline __attribute__((hot)) operator bool() { return active; }
+
+        // Dereference operator
+        T& operator*();
+
+    };  // End of Hybrid Inner Iterator Class
+
+}  // namespace IVSparse
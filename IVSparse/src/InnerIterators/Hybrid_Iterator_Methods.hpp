@@ -0,0 +1,202 @@
+/**
+ * @file Hybrid_Iterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Iterator Methods for Hybrid Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    inline SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, 4, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "The vector index is out of bounds!");
+        #endif
+
+        outer = vec;
+        tag = matrix.tags[vec];
+
+        switch (tag) {
+        case HYBRID_CSC: step = &InnerIterator::stepCSC; break;
+        case HYBRID_DENSE: step = &InnerIterator::stepDense; break;
+        case HYBRID_VCSC: step = &InnerIterator::stepVCSC; break;
+        case HYBRID_IVCSC: step = &InnerIterator::stepIVCSC; break;
+        }
+
+        // check if the vector is empty
+        if (matrix.data[vec] == nullptr) return;
+
+        active = true;
+
+        switch (tag) {
+        case HYBRID_CSC: {
+            size_t n = matrix.getVectorSize(vec) / (sizeof(T) + sizeof(indexT));
+            val = (T*)matrix.data[vec];
+            valsEnd = val + n;
+            indices = (indexT*)valsEnd;
+            index = *indices;
+            break;
+        }
+        case HYBRID_DENSE: {
+            bitmap = (uint64_t*)matrix.data[vec];
+            val = (T*)(bitmap + (matrix.innerDim + 63) / 64);
+            valsEnd = (T*)matrix.endPointers[vec];
+
+            // find the first set bit, a stored vector has at least one
+            while (*bitmap == 0) { bitmap++; }
+            bits = *bitmap;
+            index = (bitmap - (uint64_t*)matrix.data[vec]) * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            // keep the start of the bitmap as the word offset
+            data = (uint8_t*)matrix.data[vec];
+            break;
+        }
+        case HYBRID_VCSC: {
+            indexT* header = (indexT*)matrix.data[vec];
+            val = (T*)(header + 1);
+            counts = (indexT*)(val + *header);
+            indices = counts + *header;
+
+            runsLeft = *header - 1;
+            count = *counts;
+            index = *indices;
+            break;
+        }
+        case HYBRID_IVCSC: {
+            data = (uint8_t*)matrix.data[vec];
+            endPtr = (uint8_t*)matrix.endPointers[vec];
+            readRun();
+            break;
+        }
+        }
+    }
+
+    //* Private Class Methods *//
+
+    // Moves an IVCSC iterator onto the run starting at data
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::readRun() {
+        val = (T*)data;
+        data += sizeof(T);
+
+        indexWidth = *data;
+        data += 1;
+
+        index = SparseMatrix<T, indexT, 4, columnMajor>::readIndex(data, indexWidth);
+    }
+
+    //* Getters *//
+
+    // Get the outer dimension
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::outerDim() {
+        return outer;
+    }
+
+    // Get the value
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::value() {
+        return *val;
+    }
+
+    // Get the index
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::getIndex() {
+        return index;
+    }
+
+    // Set the value
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::coeff(T newValue) {
+        *val = newValue;
+    }
+
+    // Get the current row
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::row() {
+        if constexpr (!columnMajor) {
+            return outer;
+        }
+        else {
+            return index;
+        }
+    }
+
+    // Get the current column
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::col() {
+        if constexpr (!columnMajor) {
+            return index;
+        }
+        else {
+            return outer;
+        }
+    }
+
+    //* Operator Overloads *//
+
+    // Dereference Operator
+    template <typename T, typename indexT, bool columnMajor>
+    T& SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::operator*() {
+        return *val;
+    }
+
+    //* Step Functions *//
+
+    // Steps through a CSC vector
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::stepCSC() {
+        if (++val == valsEnd) { active = false; return; }
+        index = *++indices;
+    }
+
+    // Steps through a dense vector
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::stepDense() {
+        if (++val == valsEnd) { active = false; return; }
+
+        // move to the next word with a set bit
+        while (bits == 0) { bits = *++bitmap; }
+        index = (bitmap - (uint64_t*)data) * 64 + __builtin_ctzll(bits);
+        bits &= bits - 1;
+    }
+
+    // Steps through a VCSC vector
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::stepVCSC() {
+        if (--count == 0) {
+            if (runsLeft == 0) { active = false; return; }
+
+            // Move to the next value
+            runsLeft--;
+            val++;
+            count = *++counts;
+        }
+        index = *++indices;
+    }
+
+    // Steps through an IVCSC vector
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 4, columnMajor>::InnerIterator::stepIVCSC() {
+        data += indexWidth;
+        uint64_t delta = SparseMatrix<T, indexT, 4, columnMajor>::readIndex(data, indexWidth);
+
+        // a delimiter ends the run
+        if (delta == 0) {
+            data += indexWidth;
+            if (data >= endPtr) { active = false; return; }
+            readRun();
+            return;
+        }
+        index += delta;
+    }
+
+}  // namespace IVSparse
@@ -63,7 +63,7 @@ namespace IVSparse {
          * is sorted by value in ascending order.
          */
         InnerIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>& mat,
-                      uint32_t col);
+                      uint64_t col);
 
         /**
          * IVCSC Vector InnerIterator Constructor \n \n
@@ -73,6 +73,13 @@ namespace IVSparse {
         InnerIterator(
             SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector& vec);
 
+        /**
+         * IVCSC Vector View InnerIterator Constructor \n \n
+         * Iterates over the vector of the parent matrix the view points to, the
+         * same as the matrix constructor.
+         */
+        InnerIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView& view);
+
         ///@}
 
         //* Getters *//
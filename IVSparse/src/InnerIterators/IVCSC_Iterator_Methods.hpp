@@ -14,7 +14,7 @@ namespace IVSparse {
 
     // Matrix Constructor
     template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-    inline SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>& matrix, uint32_t vec) {
+    inline SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>& matrix, uint64_t vec) {
         // check if the vector is out of bounds
         #ifdef IVSPARSE_DEBUG
         assert((vec < matrix.outerDim && vec >= 0) && "Vector index out of bounds.");
@@ -79,6 +79,11 @@ namespace IVSparse {
         index = newIndex;
     }
 
+    // Vector View Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator::InnerIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView& view)
+        : InnerIterator(view.getMatrix(), view.vectorIndex()) {}
+
     //* Getters *//
 
     // If the iterator is at a new run
@@ -0,0 +1,128 @@
+/**
+ * @file IVCSC_RunIterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Run Iterator for IVCSC Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * @tparam T The type of the values in the matrix
+     * @tparam indexT The type of the indices in the matrix
+     * @tparam compressionLevel The level of compression used in the matrix
+     * @tparam columnMajor Whether the matrix is column major or not
+     *
+     * IVCSC Run Iterator Class \n \n
+     * The IVCSC Run Iterator is a forward traversal iterator over the runs of a
+     * single vector, one step per unique value instead of one per non-zero. Each
+     * step gives the value, its run length and a decoder for the indices of the
+     * run, so per value work like scaling or weighted sums is done once per run
+     * and the indices are only decoded when they are needed. Finding the length
+     * of a run scans its bytes for the delimiter but does not decode them.
+     */
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    class SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator {
+        private:
+        //* Private Class Variables *//
+
+        indexT outer = 0;  // Outer dimension
+
+        uint8_t* run = nullptr;     // Start of the current run
+        uint8_t* next = nullptr;    // Start of the next run
+        uint8_t* endPtr = nullptr;  // End of the vector
+
+        uint64_t length = 0;  // Number of indices in the current run
+
+        //* Private Class Methods *//
+
+        // Finds the length and the end of the current run
+        inline void readRun();
+
+        public:
+        //* Constructors *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        RunIterator() {};
+
+        /**
+         * IVCSC Matrix RunIterator Constructor \n \n
+         * Iterates over the runs of the given vector of the matrix in ascending
+         * order of value.
+         */
+        RunIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>& mat, uint64_t vec);
+
+        /**
+         * IVCSC Vector RunIterator Constructor \n \n
+         * Same as the previous constructor but for a single standalone vector.
+         */
+        RunIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector& vec);
+
+        /**
+         * IVCSC Vector View RunIterator Constructor \n \n
+         * Iterates over the runs of the vector of the parent matrix the view
+         * points to.
+         */
+        RunIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView& view);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The value of the current run.
+          */
+        T value();
+
+        /**
+         * Changes the value of the whole current run.
+         */
+        void coeff(T newValue);
+
+        /**
+         * @returns The number of indices in the current run.
+         */
+        uint64_t runLength();
+
+        /**
+         * @returns The byte width of the indices of the current run.
+         */
+        uint8_t indexWidth();
+
+        /**
+         * @returns The outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * Decodes the indices of the current run in ascending order, calling
+         * visit(index) for each of them.
+         */
+        template <typename Visit>
+        inline void forEachIndex(Visit visit);
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Moves to the next run
+        void __attribute__((hot)) operator++();
+
+        // Bool Operator
+        inline __attribute__((hot)) operator bool() { return run < endPtr; }
+
+    };  // End of RunIterator Class
+
+}  // namespace IVSparse
@@ -0,0 +1,114 @@
+/**
+ * @file IVCSC_RunIterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Run Iterator Methods for IVCSC Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::RunIterator(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "Vector index out of bounds.");
+        #endif
+
+        outer = vec;
+
+        // an empty vector leaves run == endPtr which trips the bool operator
+        if (matrix.vectorPointer(vec) == nullptr) { return; }
+
+        run = (uint8_t*)matrix.vectorPointer(vec);
+        endPtr = run + matrix.getVectorSize(vec);
+        readRun();
+    }
+
+    // Vector Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::RunIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector& vector) {
+        if (vector.begin() == nullptr) { return; }
+
+        run = (uint8_t*)vector.begin();
+        endPtr = (uint8_t*)vector.end();
+        readRun();
+    }
+
+    // Vector View Constructor
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::RunIterator(SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView& view)
+        : RunIterator(view.getMatrix(), view.vectorIndex()) {}
+
+    //* Getters *//
+
+    // Get the value of the current run
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline T SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::value() {
+        return *(T*)run;
+    }
+
+    // Updates the value of the current run to newValue
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::coeff(T newValue) {
+        *(T*)run = newValue;
+    }
+
+    // Get the number of indices in the current run
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::runLength() {
+        return length;
+    }
+
+    // Get the byte width of the indices of the current run
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline uint8_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::indexWidth() {
+        return *(run + sizeof(T));
+    }
+
+    // Get the outer dimension of the iterator
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    indexT SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::outerDim() {
+        return outer;
+    }
+
+    // Decodes the indices of the current run, the first is absolute and the rest are deltas
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::forEachIndex(Visit visit) {
+        uint8_t width = indexWidth();
+        uint8_t* index = run + sizeof(T) + 1;
+
+        uint64_t current = SparseMatrix<T, indexT, compressionLevel, columnMajor>::readIndex(index, width);
+        visit((indexT)current);
+
+        for (uint64_t i = 1; i < length; i++) {
+            index += width;
+            current += SparseMatrix<T, indexT, compressionLevel, columnMajor>::readIndex(index, width);
+            visit((indexT)current);
+        }
+    }
+
+    //* Private Class Methods *//
+
+    // Finds the length of the current run and where the next one starts
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::readRun() {
+        next = SparseMatrix<T, indexT, compressionLevel, columnMajor>::skipRun(run + sizeof(T) + 1, indexWidth(), length);
+    }
+
+    //* Operator Overloads *//
+
+    // Increment Operator
+    template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+    inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator::operator++() {
+        run = next;
+        if (run < endPtr) { readRun(); }
+    }
+
+}  // namespace IVSparse
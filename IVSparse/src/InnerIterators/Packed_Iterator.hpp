@@ -0,0 +1,106 @@
+/**
+ * @file Packed_Iterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Inner Iterator for Packed Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Packed Inner Iterator Class \n \n
+     * The Packed Inner Iterator is a forward traversal iterator over the
+     * non-zeros of one vector of a Packed matrix. The traversal is grouped
+     * by value in ascending order and each run is unpacked into a buffer of
+     * the iterator when it is reached.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator {
+        private:
+        //* Private Class Variables *//
+
+        indexT outer = 0;  // Outer dimension
+        indexT index = 0;  // Current index
+        T val = 0;         // Current value
+
+        const uint8_t* data = nullptr;    // Start of the next run in the vector
+        const uint8_t* endPtr = nullptr;  // End of the vector
+
+        std::vector<uint32_t> indices;  // Unpacked indices of the current run
+        uint32_t count = 0;             // Number of indices in the current run
+        uint32_t position = 0;          // Position in the current run
+
+        IVSparse::BitUnpacker unpacker;  // Unpacks the blocks of a run
+
+        //* Private Class Methods *//
+
+        // Moves the iterator onto the run starting at data
+        inline void readRun();
+
+        public:
+        //* Constructors & Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        InnerIterator() {};
+
+        /**
+         * Packed Matrix InnerIterator Constructor \n \n
+         * The main constructor for the Inner Iterator. Given a matrix the iterator
+         * will forward traverse over the given vector of the matrix.
+         */
+        InnerIterator(SparseMatrix<T, indexT, 6, columnMajor>& mat, uint64_t vec);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The current index of the iterator.
+          */
+        indexT getIndex();
+
+        /**
+         * @returns The current outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * @returns The current row of the iterator.
+         */
+        indexT row();
+
+        /**
+         * @returns The current column of the iterator.
+         */
+        indexT col();
+
+        /**
+         * @returns The current value of the iterator.
+         */
+        T value();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Prefix increment operator
+        void __attribute__((hot)) operator++();
+
+        // Boolean operator
+        inline __attribute__((hot)) operator bool() { return position < count; }
+
+    };  // End of Packed Inner Iterator Class
+
+}  // namespace IVSparse
@@ -0,0 +1,107 @@
+/**
+ * @file Packed_Iterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Iterator Methods for Packed Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    inline SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "The vector index is out of bounds!");
+        #endif
+
+        outer = vec;
+
+        // check if the vector is empty
+        if (matrix.data[vec] == nullptr) return;
+
+        data = (uint8_t*)matrix.data[vec];
+        endPtr = (uint8_t*)matrix.endPointers[vec];
+
+        readRun();
+    }
+
+    //* Private Class Methods *//
+
+    // Moves the iterator onto the run starting at data
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::readRun() {
+        val = *(T*)data;
+        uint8_t encoding;
+        data = SparseMatrix<T, indexT, 6, columnMajor>::readHeader(data, count, encoding);
+
+        if (indices.size() < count) { indices.resize(count); }
+        data = SparseMatrix<T, indexT, 6, columnMajor>::decodeIndices(data, count, encoding, indices.data(), unpacker);
+
+        position = 0;
+        index = indices[0];
+    }
+
+    //* Getters *//
+
+    // Get the outer dimension
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::outerDim() {
+        return outer;
+    }
+
+    // Get the value
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::value() {
+        return val;
+    }
+
+    // Get the index
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::getIndex() {
+        return index;
+    }
+
+    // Get the current row
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::row() {
+        if constexpr (!columnMajor) {
+            return outer;
+        }
+        else {
+            return index;
+        }
+    }
+
+    // Get the current column
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::col() {
+        if constexpr (!columnMajor) {
+            return index;
+        }
+        else {
+            return outer;
+        }
+    }
+
+    //* Operator Overloads *//
+
+    // Increment Operator
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::InnerIterator::operator++() {
+        position++;
+
+        // the end of a run moves on to the next one if there is one
+        if (position == count) {
+            if (data < endPtr) { readRun(); }
+            return;
+        }
+        index = indices[position];
+    }
+
+}  // namespace IVSparse
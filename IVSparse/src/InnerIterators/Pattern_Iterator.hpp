@@ -0,0 +1,99 @@
+/**
+ * @file Pattern_Iterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Inner Iterator for Pattern Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * Pattern Inner Iterator Class \n \n
+     * The Pattern Inner Iterator is a forward traversal iterator over the
+     * entries of one vector of a Pattern matrix in ascending index order. There
+     * are no stored values, value() is always true.
+     */
+    template <typename indexT, bool columnMajor>
+    class SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator {
+        private:
+        //* Private Class Variables *//
+
+        indexT outer = 0;  // Outer dimension
+        indexT index = 0;  // Current index
+
+        uint8_t* data = nullptr;    // Current delta
+        uint8_t* endPtr = nullptr;  // End of the vector
+        uint8_t indexWidth = 1;     // Width of the deltas
+
+        //* Private Class Methods *//
+
+        // Adds the delta at data to the index
+        inline void decodeIndex();
+
+        public:
+        //* Constructors & Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        InnerIterator() {};
+
+        /**
+         * Pattern Matrix InnerIterator Constructor \n \n
+         * The main constructor for the Inner Iterator. Given a matrix the iterator
+         * will forward traverse over the given vector of the matrix.
+         */
+        InnerIterator(SparseMatrix<bool, indexT, 3, columnMajor>& mat, uint64_t vec);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The current index of the iterator.
+          */
+        indexT getIndex();
+
+        /**
+         * @returns The current outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * @returns The current row of the iterator.
+         */
+        indexT row();
+
+        /**
+         * @returns The current column of the iterator.
+         */
+        indexT col();
+
+        /**
+         * @returns Always true, every stored entry is a 1.
+         */
+        bool value() { return true; }
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Prefix increment operator
+        void __attribute__((hot)) operator++();
+
+        // Boolean operator
+        inline __attribute__((hot)) operator bool() { return data < endPtr; }
+
+    };  // End of Pattern Inner Iterator Class
+
+}  // namespace IVSparse
@@ -0,0 +1,104 @@
+/**
+ * @file Pattern_Iterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Iterator Methods for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename indexT, bool columnMajor>
+    inline SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "The vector index is out of bounds!");
+        #endif
+
+        outer = vec;
+
+        // check if the vector is empty
+        if (matrix.data[vec] == nullptr) return;
+
+        data = (uint8_t*)matrix.data[vec];
+        endPtr = (uint8_t*)matrix.endPointers[vec];
+
+        indexWidth = *data;
+        data += 1;
+
+        // the first index is stored as a delta from 0
+        decodeIndex();
+    }
+
+    //* Private Class Methods *//
+
+    // Adds the delta at data to the index
+    template <typename indexT, bool columnMajor>
+    inline void SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::decodeIndex() {
+        switch (indexWidth) {
+        case 1:
+            index += *data;
+            break;
+        case 2:
+            index += *(uint16_t*)data;
+            break;
+        case 4:
+            index += *(uint32_t*)data;
+            break;
+        default:
+            index += *(uint64_t*)data;
+            break;
+        }
+    }
+
+    //* Getters *//
+
+    // Get the outer dimension
+    template <typename indexT, bool columnMajor>
+    indexT SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::outerDim() {
+        return outer;
+    }
+
+    // Get the index
+    template <typename indexT, bool columnMajor>
+    indexT SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::getIndex() {
+        return index;
+    }
+
+    // Get the current row
+    template <typename indexT, bool columnMajor>
+    indexT SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::row() {
+        if constexpr (!columnMajor) {
+            return outer;
+        }
+        else {
+            return index;
+        }
+    }
+
+    // Get the current column
+    template <typename indexT, bool columnMajor>
+    indexT SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::col() {
+        if constexpr (!columnMajor) {
+            return index;
+        }
+        else {
+            return outer;
+        }
+    }
+
+    //* Operator Overloads *//
+
+    // Increment Operator
+    template <typename indexT, bool columnMajor>
+    inline void SparseMatrix<bool, indexT, 3, columnMajor>::InnerIterator::operator++() {
+        data += indexWidth;
+        if (data < endPtr) { decodeIndex(); }
+    }
+
+}  // namespace IVSparse
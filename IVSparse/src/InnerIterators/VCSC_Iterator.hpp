@@ -58,7 +58,7 @@ namespace IVSparse {
          * will forward traverse over the given vector of the matrix. The traversal
          * is sorted by value in ascending order.
          */
-        InnerIterator(SparseMatrix<T, indexT, 2, columnMajor>& mat, uint32_t col);
+        InnerIterator(SparseMatrix<T, indexT, 2, columnMajor>& mat, uint64_t col);
 
         /**
          * VCSC Vector InnerIterator Constructor \n \n
@@ -67,6 +67,13 @@ namespace IVSparse {
          */
         InnerIterator(SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec);
 
+        /**
+         * VCSC Vector View InnerIterator Constructor \n \n
+         * Iterates over the vector of the parent matrix the view points to, the
+         * same as the matrix constructor.
+         */
+        InnerIterator(SparseMatrix<T, indexT, 2, columnMajor>::VectorView& view);
+
         ///@}
 
         //* Getters *//
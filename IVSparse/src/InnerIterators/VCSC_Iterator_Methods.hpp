@@ -14,7 +14,7 @@ namespace IVSparse {
 
     // Matrix Constructor
     template <typename T, typename indexT, bool columnMajor>
-    inline SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, 2, columnMajor>& matrix, uint32_t vec) {
+    inline SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator::InnerIterator(IVSparse::SparseMatrix<T, indexT, 2, columnMajor>& matrix, uint64_t vec) {
 
         #ifdef IVSPARSE_DEBUG
         assert(vec < matrix.outerDim && vec >= 0 && "The vector index is out of bounds!");
@@ -85,6 +85,11 @@ namespace IVSparse {
         this->count = counts[0];
     }
 
+    // Vector View Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator::InnerIterator(SparseMatrix<T, indexT, 2, columnMajor>::VectorView& view)
+        : InnerIterator(view.getMatrix(), view.vectorIndex()) {}
+
     //* Getters *//
 
     // Get the outer dimension
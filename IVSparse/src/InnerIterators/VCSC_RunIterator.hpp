@@ -0,0 +1,118 @@
+/**
+ * @file VCSC_RunIterator.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Run Iterator for VCSC Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * VCSC Run Iterator Class \n \n
+     * The VCSC Run Iterator is a forward traversal iterator over the unique
+     * values of a single vector. Each step gives the value, how many times it
+     * appears and the span of its indices, which are stored sorted and
+     * uncompressed, so per value work like scaling or weighted sums is done once
+     * per run instead of once per non-zero.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 2, columnMajor>::RunIterator {
+        private:
+        //* Private Class Variables *//
+
+        indexT outer = 0;  // Outer dimension
+
+        T* vals = nullptr;          // Current value
+        indexT* counts = nullptr;   // Current count
+        indexT* indices = nullptr;  // First index of the current run
+
+        uint64_t run = 0;       // Current run
+        uint64_t numRuns = 0;   // Number of unique values
+
+        public:
+        //* Constructors *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Default Iterator Constructor \n \n
+          * Creates an empty iterator that can't be used on its own.
+          */
+        RunIterator() {};
+
+        /**
+         * VCSC Matrix RunIterator Constructor \n \n
+         * Iterates over the runs of the given vector of the matrix in ascending
+         * order of value.
+         */
+        RunIterator(SparseMatrix<T, indexT, 2, columnMajor>& mat, uint64_t vec);
+
+        /**
+         * VCSC Vector RunIterator Constructor \n \n
+         * Same as the previous constructor but for a single standalone vector.
+         */
+        RunIterator(SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec);
+
+        /**
+         * VCSC Vector View RunIterator Constructor \n \n
+         * Iterates over the runs of the vector of the parent matrix the view
+         * points to.
+         */
+        RunIterator(SparseMatrix<T, indexT, 2, columnMajor>::VectorView& view);
+
+        ///@}
+
+        //* Getters *//
+        /** @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns The value of the current run.
+          */
+        T value();
+
+        /**
+         * Changes the value of the whole current run.
+         */
+        void coeff(T newValue);
+
+        /**
+         * @returns The number of indices in the current run.
+         */
+        uint64_t runLength();
+
+        /**
+         * @returns A pointer to the first of the runLength() sorted indices of
+         * the current run.
+         */
+        indexT* getIndices();
+
+        /**
+         * @returns The outer dimension of the iterator.
+         */
+        indexT outerDim();
+
+        /**
+         * Calls visit(index) for each index of the current run in ascending order.
+         */
+        template <typename Visit>
+        inline void forEachIndex(Visit visit);
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        // Moves to the next run
+        void __attribute__((hot)) operator++();
+
+        // Bool Operator
+        inline __attribute__((hot)) operator bool() { return run < numRuns; }
+
+    };  // End of VCSC Run Iterator Class
+
+}  // namespace IVSparse
@@ -0,0 +1,96 @@
+/**
+ * @file VCSC_RunIterator_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Run Iterator Methods for VCSC Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Constructors *//
+
+    // Matrix Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    inline SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::RunIterator(IVSparse::SparseMatrix<T, indexT, 2, columnMajor>& matrix, uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < matrix.outerDim && "The vector index is out of bounds!");
+        #endif
+
+        outer = vec;
+        vals = matrix.getValues(vec);
+        counts = matrix.getCounts(vec);
+        indices = matrix.getIndices(vec);
+        numRuns = matrix.getNumUniqueVals(vec);
+    }
+
+    // Vector Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::RunIterator(SparseMatrix<T, indexT, 2, columnMajor>::Vector& vector) {
+        if (vector.nonZeros() == 0) { return; }
+
+        vals = vector.getValues();
+        counts = vector.getCounts();
+        indices = vector.getIndices();
+        numRuns = vector.uniqueVals();
+    }
+
+    // Vector View Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::RunIterator(SparseMatrix<T, indexT, 2, columnMajor>::VectorView& view)
+        : RunIterator(view.getMatrix(), view.vectorIndex()) {}
+
+    //* Getters *//
+
+    // Get the value of the current run
+    template <typename T, typename indexT, bool columnMajor>
+    inline T SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::value() {
+        return *vals;
+    }
+
+    // Updates the value of the current run to newValue
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::coeff(T newValue) {
+        *vals = newValue;
+    }
+
+    // Get the number of indices in the current run
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::runLength() {
+        return *counts;
+    }
+
+    // Get a pointer to the indices of the current run
+    template <typename T, typename indexT, bool columnMajor>
+    inline indexT* SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::getIndices() {
+        return indices;
+    }
+
+    // Get the outer dimension of the iterator
+    template <typename T, typename indexT, bool columnMajor>
+    indexT SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::outerDim() {
+        return outer;
+    }
+
+    // Visits the indices of the current run
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::forEachIndex(Visit visit) {
+        for (indexT k = 0; k < *counts; k++) { visit(indices[k]); }
+    }
+
+    //* Operator Overloads *//
+
+    // Increment Operator
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 2, columnMajor>::RunIterator::operator++() {
+        indices += *counts;
+        vals++;
+        counts++;
+        run++;
+    }
+
+}  // namespace IVSparse
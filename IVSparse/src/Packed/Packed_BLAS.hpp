@@ -0,0 +1,250 @@
+/**
+ * @file Packed_BLAS.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief BLAS Routines and Other Matrix Calculations for Packed Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* BLAS Level 1 Routines *//
+
+    // Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SparseMatrix<T, indexT, 6, columnMajor> SparseMatrix<T, indexT, 6, columnMajor>::scalarMultiply(T scalar) {
+        // Deep copy the matrix
+        IVSparse::SparseMatrix<T, indexT, 6, columnMajor> newMatrix(*this);
+
+        newMatrix.inPlaceScalarMultiply(scalar);
+        return newMatrix;
+    }
+
+    // In Place Scalar Multiply
+    template <typename T, typename indexT, bool columnMajor>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::inPlaceScalarMultiply(T scalar) {
+        // only the value of each run changes, the packed indices are skipped
+        for (uint64_t i = 0; i < outerDim; i++) {
+            forEachValue(i, [&](T& value, uint32_t) { value *= scalar; });
+        }
+    }
+
+    //* BLAS Level 2 Routines *//
+
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 6, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the vector is the correct size
+        assert((uint64_t)vec.rows() == numCols &&
+               "The vector must be the same size as the number of columns in the "
+               "matrix!");
+        #endif
+
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        // the unpacked indices of a run are 32 bit so they go straight to the run kernels
+        const IVSparse::RunKernels<accumT, uint32_t> kernels(innerDim);
+
+        if constexpr (columnMajor) {
+            // scatter each run scaled by its value and the vector entry, each value is only scaled once
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                if (vec(i) == 0) return;
+
+                forEachRun(i, [&](const T& value, const uint32_t* indices, uint32_t count) {
+                    kernels.scatterAdd(buffer, indices, count, static_cast<accumT>(value) * vec(i));
+                });
+            });
+        }
+        else {
+            // each row is an independent dot product, the values are factored out of their runs
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0;
+
+                forEachRun(i, [&](const T& value, const uint32_t* indices, uint32_t count) {
+                    rowSum += static_cast<accumT>(value) * kernels.gatherSum(vec.data(), indices, count);
+                });
+                eigenTemp(i) = rowSum;
+            }
+        }
+        return eigenTemp;
+    }
+
+    //* BLAS Level 3 Routines *//
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 6, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and scatters the whole matrix into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+                Eigen::Matrix<accumT, -1, 1> scaled(length);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    forEachRun(i, [&](const T& value, const uint32_t* indices, uint32_t count) {
+                        scaled = matTranspose.col(i).segment(start, length) * static_cast<accumT>(value);
+                        for (uint32_t k = 0; k < count; k++) {
+                            newMatrix.col(indices[k]).segment(start, length) += scaled;
+                        }
+                    });
+                }
+            }
+        }
+        else {
+            // each row of the result only reads the rows of mat it touches, values are applied once per run
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                Eigen::Matrix<accumT, -1, 1> runSum(width);
+
+                forEachRun(i, [&](const T& value, const uint32_t* indices, uint32_t count) {
+                    runSum.setZero();
+                    for (uint32_t k = 0; k < count; k++) { runSum += matTranspose.col(indices[k]); }
+                    newMatrix.col(i) += runSum * static_cast<accumT>(value);
+                });
+            }
+        }
+        return newMatrix.transpose();
+    }
+
+    //* Other Matrix Calculations *//
+
+    // Finds the Outer Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 6, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachValue(i, [&](T& value, uint32_t count) {
+                outerSum[i] += static_cast<accumT>(value) * count;
+            });
+        }
+        return outerSum;
+    }
+
+    // Finds the Inner Sum of the Matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 6, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
+        const IVSparse::RunKernels<accumT, uint32_t> kernels(innerDim);
+
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            forEachRun(i, [&](const T& value, const uint32_t* indices, uint32_t count) {
+                kernels.scatterAdd(buffer, indices, count, static_cast<accumT>(value));
+            });
+        });
+        return innerSum;
+    }
+
+    // Finds the sum of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 6, columnMajor>::sum() {
+        std::vector<accumT> outerSum = this->outerSum<accumT>();
+
+        accumT sum = 0;
+        for (uint64_t i = 0; i < outerDim; i++) {
+            sum += outerSum[i];
+        }
+        return sum;
+    }
+
+    // Calculates the norm of the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 6, columnMajor>::norm() {
+        accumT norm = 0;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for reduction(+ : norm)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            forEachValue(i, [&](T& value, uint32_t count) {
+                norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count;
+            });
+        }
+        return sqrt(norm);
+    }
+
+    // Finds the length of a certain vector
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 6, columnMajor>::vectorLength(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        accumT norm = 0;
+        forEachValue(vec, [&](T& value, uint32_t count) {
+            norm += static_cast<accumT>(value) * static_cast<accumT>(value) * count;
+        });
+        return sqrt(norm);
+    }
+
+    // Finds the dot product of two vectors by intersecting their runs
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 6, columnMajor>::vectorDot(uint64_t vecA, uint64_t vecB) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vecA < outerDim && vecB < outerDim && "Vector index out of bounds!");
+        #endif
+
+        std::vector<std::vector<uint32_t>> decoded;
+        auto runsA = runCursors(vecA, decoded);
+        auto runsB = runCursors(vecB, decoded);
+
+        // the cursors are copied so every pair of runs starts from the front
+        accumT dot = 0;
+        for (auto& [valueA, cursorA] : runsA) {
+            for (auto& [valueB, cursorB] : runsB) {
+                uint64_t common = IVSparse::intersectionSize(cursorA, cursorB);
+                dot += static_cast<accumT>(valueA) * static_cast<accumT>(valueB) * common;
+            }
+        }
+        return dot;
+    }
+
+    // Counts the inner indices where two vectors hold the given values
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 6, columnMajor>::cooccurrence(uint64_t vecA, T valueA, uint64_t vecB, T valueB) {
+        return indexSet(vecA, valueA).andCardinality(indexSet(vecB, valueB));
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,83 @@
+/**
+ * @file Packed_Constructors.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Constructors for Packed Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Destructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 6, columnMajor>::~SparseMatrix() {
+        freeData();
+    }
+
+    // Eigen Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 6, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T>& mat) {
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
+    }
+
+    // Eigen Row Major Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 6, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat) {
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
+    }
+
+    // Deep Copy Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 6, columnMajor>::SparseMatrix(const IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& other) {
+        *this = other;
+    }
+
+    // Conversion Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    template <uint8_t otherCompressionLevel>
+    SparseMatrix<T, indexT, 6, columnMajor>::SparseMatrix(IVSparse::SparseMatrix<T, indexT, otherCompressionLevel, columnMajor>& other) {
+        // if already the right compression level
+        if constexpr (otherCompressionLevel == 6) {
+            *this = other;
+        }
+        else {
+            // every level converts to Eigen in its own storage order
+            compressEigen(other.toEigen());
+        }
+    }
+
+    // Raw CSC Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename T2, typename indexT2>
+    SparseMatrix<T, indexT, 6, columnMajor>::SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr,
+                                                          uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(num_rows > 0 && num_cols > 0 && nnz > 0 &&
+               "Error: Matrix dimensions must be greater than 0");
+        assert(innerIndices != nullptr && outerPtr != nullptr && vals != nullptr &&
+               "Error: Pointers cannot be null");
+        #endif
+
+        // set the dimensions
+        if (columnMajor) {
+            innerDim = num_rows;
+            outerDim = num_cols;
+        }
+        else {
+            innerDim = num_cols;
+            outerDim = num_rows;
+        }
+        numRows = num_rows;
+        numCols = num_cols;
+        this->nnz = nnz;
+
+        // call the compression function
+        compressCSC(vals, innerIndices, outerPtr);
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,159 @@
+/**
+ * @file Packed_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Methods for Packed Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Getters *//
+
+    // Gets the element stored at the given row and column
+    template <typename T, typename indexT, bool columnMajor>
+    T SparseMatrix<T, indexT, 6, columnMajor>::coeff(uint64_t row, uint64_t col) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(row < numRows && col < numCols && "Invalid row and column!");
+        #endif
+
+        uint64_t vec = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        // every run has to be checked as the runs are grouped by value, Elias-Fano runs seek to the index
+        T result = 0;
+        forEachRunCursor(vec, [&](const T& value, IVSparse::IndexCursor cursor) {
+            if (cursor.nextGEQ(index) == index) { result = value; }
+        });
+        return result;
+    }
+
+    // Check for Column Major
+    template <typename T, typename indexT, bool columnMajor>
+    bool SparseMatrix<T, indexT, 6, columnMajor>::isColumnMajor() const {
+        return columnMajor;
+    }
+
+    // Gets the number of bytes of an encoded vector
+    template <typename T, typename indexT, bool columnMajor>
+    size_t SparseMatrix<T, indexT, 6, columnMajor>::getVectorSize(uint64_t vec) const {
+        return (uint8_t*)endPointers[vec] - (uint8_t*)data[vec];
+    }
+
+    // Visits every non-zero of a vector, each run is unpacked a block at a time
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachEntry(uint64_t vec, Visit visit) {
+        forEachRun(vec, [&](const T& value, const uint32_t* indices, uint32_t count) {
+            for (uint32_t k = 0; k < count; k++) { visit(indices[k], value); }
+        });
+    }
+
+    // Visits the non-zeros of a vector in a range of inner indices, each run seeks to the start
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachEntry(uint64_t vec, uint64_t start, uint64_t end, Visit visit) {
+        forEachRunCursor(vec, [&](const T& value, IVSparse::IndexCursor cursor) {
+            for (uint64_t index = cursor.nextGEQ(start); index < end; index = cursor.nextGEQ(index + 1)) {
+                visit(index, value);
+            }
+        });
+    }
+
+    // Visits the non-zeros of a vector in a mask, each run is intersected with the mask
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachEntry(uint64_t vec, const IVSparse::IndexSet& mask, Visit visit) {
+        forEachRun(vec, [&](const T& value, const uint32_t* indices, uint32_t count) {
+            (IVSparse::IndexSet(indices, count) & mask).forEach([&](uint32_t index) { visit(index, value); });
+        });
+    }
+
+    // Gets the inner indices of a vector that hold a value, a Roaring run is read as is
+    template <typename T, typename indexT, bool columnMajor>
+    IVSparse::IndexSet SparseMatrix<T, indexT, 6, columnMajor>::indexSet(uint64_t vec, T value) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        IVSparse::IndexSet set;
+        if (data[vec] == nullptr) return set;
+
+        const IVSparse::BitUnpacker unpacker;
+        std::vector<uint32_t> indices;
+
+        // the runs are in ascending order of value so the search stops at the first larger one
+        const uint8_t* run = (uint8_t*)data[vec];
+        while (run < (uint8_t*)endPointers[vec] && !(value < *(T*)run)) {
+            bool found = *(T*)run == value;
+            uint32_t count;
+            uint8_t encoding;
+            run = readHeader(run, count, encoding);
+
+            if (found && encoding == PACKED_ROARING) {
+                set.read(run);
+                break;
+            }
+
+            indices.resize(count);
+            run = decodeIndices(run, count, encoding, indices.data(), unpacker);
+            if (found) {
+                set = IVSparse::IndexSet(indices.data(), count);
+                break;
+            }
+        }
+        return set;
+    }
+
+    // Gets the inner indices of every non-zero of a vector as the union of its runs
+    template <typename T, typename indexT, bool columnMajor>
+    IVSparse::IndexSet SparseMatrix<T, indexT, 6, columnMajor>::vectorPattern(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        IVSparse::IndexSet pattern;
+        forEachRun(vec, [&](const T&, const uint32_t* indices, uint32_t count) {
+            pattern = pattern | IVSparse::IndexSet(indices, count);
+        });
+        return pattern;
+    }
+
+    //* Utility Methods *//
+
+    // Prints the matrix dense to console
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::print() {
+        print(std::cout);
+    }
+
+    // Converts the matrix to an Eigen sparse matrix
+    template <typename T, typename indexT, bool columnMajor>
+    Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> SparseMatrix<T, indexT, 6, columnMajor>::toEigen() {
+
+        #ifdef IVSPARSE_DEBUG
+        // assert that the matrix is not empty
+        assert(outerDim > 0 && "Cannot convert an empty matrix to an Eigen matrix!");
+        #endif
+
+        // the runs are grouped by value so go through triplets
+        std::vector<Eigen::Triplet<T>> triplets;
+        triplets.reserve(nnz);
+        for (uint64_t i = 0; i < outerDim; i++) {
+            forEachEntry(i, [&](uint64_t index, T value) {
+                if constexpr (columnMajor) { triplets.emplace_back(index, i, value); }
+                else { triplets.emplace_back(i, index, value); }
+            });
+        }
+
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
+        eigenMatrix.setFromTriplets(triplets.begin(), triplets.end());
+        return eigenMatrix;
+    }
+
+}  // namespace IVSparse
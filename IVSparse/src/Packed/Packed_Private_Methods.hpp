@@ -0,0 +1,386 @@
+/**
+ * @file Packed_Private_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Private Methods for Packed Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Reads the header of a run, returns the start of its indices
+    template <typename T, typename indexT, bool columnMajor>
+    inline const uint8_t* SparseMatrix<T, indexT, 6, columnMajor>::readHeader(const uint8_t* run, uint32_t& count, uint8_t& encoding) {
+        // the low bits of the count say how the indices are encoded
+        uint64_t header;
+        run = IVSparse::BitPack::readCount(run + sizeof(T), header);
+        count = header >> 2;
+        encoding = header & 3;
+        return run;
+    }
+
+    // Decodes the indices of a run into out, returns the end of the run
+    template <typename T, typename indexT, bool columnMajor>
+    inline const uint8_t* SparseMatrix<T, indexT, 6, columnMajor>::decodeIndices(const uint8_t* indices, uint32_t count, uint8_t encoding,
+                                                                                 uint32_t* out, const IVSparse::BitUnpacker& unpacker) {
+        switch (encoding) {
+        case PACKED_ELIAS_FANO: {
+            IVSparse::EliasFanoReader reader(indices, count);
+            reader.decode(out);
+            return reader.end();
+        }
+        case PACKED_ROARING:
+            return IVSparse::IndexSet::forEachWritten(indices, [&](uint32_t index) { *out++ = index; });
+        default:
+            return unpacker.decodeRun(indices, count, out);
+        }
+    }
+
+    // Calls visit(value, indices, count) for each run of a vector with its indices unpacked
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachRun(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        // the unpacked indices of the current run, reused between calls on the same thread
+        static thread_local std::vector<uint32_t> indices;
+        const IVSparse::BitUnpacker unpacker;
+
+        const uint8_t* run = (uint8_t*)data[vec];
+        while (run < (uint8_t*)endPointers[vec]) {
+            const T& value = *(T*)run;
+            uint32_t count;
+            uint8_t encoding;
+            run = readHeader(run, count, encoding);
+
+            if (indices.size() < count) { indices.resize(count); }
+            run = decodeIndices(run, count, encoding, indices.data(), unpacker);
+
+            visit(value, (const uint32_t*)indices.data(), count);
+        }
+    }
+
+    // Calls visit(value, cursor) for each run of a vector, Elias-Fano runs are not decoded
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachRunCursor(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        static thread_local std::vector<uint32_t> indices;
+        const IVSparse::BitUnpacker unpacker;
+
+        const uint8_t* run = (uint8_t*)data[vec];
+        while (run < (uint8_t*)endPointers[vec]) {
+            const T& value = *(T*)run;
+            uint32_t count;
+            uint8_t encoding;
+            run = readHeader(run, count, encoding);
+
+            if (encoding == PACKED_ELIAS_FANO) {
+                IVSparse::EliasFanoReader reader(run, count);
+                run = reader.end();
+                visit(value, IVSparse::IndexCursor(reader));
+            }
+            else {
+                if (indices.size() < count) { indices.resize(count); }
+                run = decodeIndices(run, count, encoding, indices.data(), unpacker);
+                visit(value, IVSparse::IndexCursor(indices.data(), count));
+            }
+        }
+    }
+
+    // Makes a cursor for each run of a vector, the runs that are not Elias-Fano are unpacked into decoded
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<std::pair<T, IVSparse::IndexCursor>> SparseMatrix<T, indexT, 6, columnMajor>::runCursors(uint64_t vec, std::vector<std::vector<uint32_t>>& decoded) {
+        std::vector<std::pair<T, IVSparse::IndexCursor>> cursors;
+        if (data[vec] == nullptr) return cursors;
+
+        const IVSparse::BitUnpacker unpacker;
+
+        const uint8_t* run = (uint8_t*)data[vec];
+        while (run < (uint8_t*)endPointers[vec]) {
+            const T& value = *(T*)run;
+            uint32_t count;
+            uint8_t encoding;
+            run = readHeader(run, count, encoding);
+
+            if (encoding == PACKED_ELIAS_FANO) {
+                IVSparse::EliasFanoReader reader(run, count);
+                run = reader.end();
+                cursors.emplace_back(value, IVSparse::IndexCursor(reader));
+            }
+            else {
+                // the buffers of the inner vectors stay put when decoded grows
+                decoded.emplace_back(count);
+                run = decodeIndices(run, count, encoding, decoded.back().data(), unpacker);
+                cursors.emplace_back(value, IVSparse::IndexCursor(decoded.back().data(), count));
+            }
+        }
+        return cursors;
+    }
+
+    // Calls visit(value, count) with a reference to the value of each run of a vector without unpacking it
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<T, indexT, 6, columnMajor>::forEachValue(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        uint8_t* run = (uint8_t*)data[vec];
+        while (run < (uint8_t*)endPointers[vec]) {
+            T& value = *(T*)run;
+            uint32_t count;
+            uint8_t encoding;
+            run = (uint8_t*)readHeader(run, count, encoding);
+
+            visit(value, count);
+            switch (encoding) {
+            case PACKED_ELIAS_FANO:
+                run = (uint8_t*)IVSparse::EliasFano::skip(run, count);
+                break;
+            case PACKED_ROARING:
+                run = (uint8_t*)IVSparse::IndexSet::skipWritten(run);
+                break;
+            default:
+                run = (uint8_t*)IVSparse::BitUnpacker::skipRun(run, count);
+                break;
+            }
+        }
+    }
+
+    // Allocates the per vector pointers, every vector starts empty
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::allocateOuter() {
+        try {
+            data = (void**)calloc(outerDim, sizeof(void*));
+            endPointers = (void**)calloc(outerDim, sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Frees every vector and the per vector pointers
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::freeData() {
+        if (data != nullptr) {
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (data[i] != nullptr) { free(data[i]); }
+            }
+        }
+
+        free(data);
+        free(endPointers);
+
+        data = nullptr;
+        endPointers = nullptr;
+    }
+
+    // performs some simple user checks on the matrices metadata
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::userChecks() {
+        assert((innerDim > 1 || outerDim > 1 || nnz > 1) &&
+               "The matrix must have at least one row, column, and nonzero value");
+        assert(std::is_floating_point<indexT>::value == false &&
+               "The index type must be a non-floating point type");
+        assert((std::is_arithmetic<T>::value && std::is_arithmetic<indexT>::value) &&
+               "The value and index types must be numeric types");
+        assert((std::is_same<indexT, bool>::value == false) &&
+               "The index type must not be bool");
+        assert((innerDim < std::numeric_limits<indexT>::max() &&
+                outerDim < std::numeric_limits<indexT>::max()) &&
+               "The number of rows and columns must be less than the maximum value "
+               "of the index type");
+        assert(innerDim <= UINT32_MAX && "The packed deltas are 32 bit, the inner dimension must fit in 32 bits");
+    }
+
+    // Calculates the current byte size of the matrix, the sum of the encoded vectors
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::calculateCompSize() {
+        compSize = 0;
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            compSize += getVectorSize(i);
+        }
+    }
+
+    // Compression Algorithm for going from CSC to Packed
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename T2, typename indexT2>
+    void SparseMatrix<T, indexT, 6, columnMajor>::compressCSC(const T2* vals, const indexT2* innerIndices,
+                                                                const indexT2* outerPointers, const indexT2* innerNonZeros) {
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+
+        allocateOuter();
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            // the end of the vector, an uncompressed Eigen matrix has gaps between its vectors
+            uint64_t end = innerNonZeros == nullptr ? outerPointers[i + 1] : outerPointers[i] + innerNonZeros[i];
+
+            std::vector<std::pair<T, indexT>> entries;
+            entries.reserve(end - outerPointers[i]);
+            for (uint64_t j = outerPointers[i]; j < end; j++) {
+                entries.emplace_back(static_cast<T>(vals[j]), (indexT)innerIndices[j]);
+            }
+
+            // group by value with the indices of each value ascending
+            std::sort(entries.begin(), entries.end());
+
+            compressVector(i, entries.data(), entries.data() + entries.size());
+        }
+
+        calculateCompSize();
+    }
+
+    // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, 6, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            nnz = mat.nonZeros();
+
+            compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
+
+    // Encodes one vector as runs of a value, a varint count and the indices in the encoding that suits them
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end) {
+
+        // an empty vector has no data
+        if (begin == end) {
+            data[vec] = nullptr;
+            endPointers[vec] = nullptr;
+            return;
+        }
+
+        // the first delta of each run is its first index
+        size_t n = end - begin;
+        std::vector<uint32_t> indices(n);
+        std::vector<uint32_t> deltas(n);
+        for (size_t k = 0; k < n; k++) {
+            bool newRun = k == 0 || begin[k].first != begin[k - 1].first;
+            indices[k] = begin[k].second;
+            deltas[k] = newRun ? begin[k].second : begin[k].second - begin[k - 1].second;
+        }
+
+        // long runs are Elias-Fano when that is within an eighth of the bit packed size, to seek in them,
+        // and any run is Roaring when that is smaller than both
+        std::vector<uint8_t> encodings;
+        std::vector<IVSparse::IndexSet> sets;
+        size_t bytes = 0;
+        for (size_t run = 0; run < n;) {
+            size_t next = run + 1;
+            while (next < n && begin[next].first == begin[run].first) { next++; }
+
+            size_t runBytes = 0;
+            for (size_t start = run; start < next; start += PACK_BLOCK_SIZE) {
+                runBytes += IVSparse::BitPack::blockSize(deltas.data() + start, std::min<size_t>(PACK_BLOCK_SIZE, next - start));
+            }
+            encodings.push_back(PACKED_BLOCKS);
+
+            if (next - run >= EF_MIN_RUN) {
+                size_t efBytes = IVSparse::EliasFano::size(indices.data() + run, next - run);
+                if (efBytes <= runBytes + runBytes / 8) {
+                    runBytes = efBytes;
+                    encodings.back() = PACKED_ELIAS_FANO;
+                }
+            }
+
+            sets.emplace_back(indices.data() + run, next - run);
+            size_t roaringBytes = sets.back().byteSize();
+            if (roaringBytes < runBytes) {
+                runBytes = roaringBytes;
+                encodings.back() = PACKED_ROARING;
+            }
+
+            bytes += sizeof(T) + IVSparse::BitPack::countSize((next - run) << 2) + runBytes;
+            run = next;
+        }
+
+        // the Elias-Fano bits are ORed in so the vector starts zeroed
+        try {
+            data[vec] = calloc(bytes, 1);
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+        endPointers[vec] = (uint8_t*)data[vec] + bytes;
+
+        uint8_t* helpPtr = (uint8_t*)data[vec];
+        size_t runNum = 0;
+        for (size_t run = 0; run < n; runNum++) {
+            size_t next = run + 1;
+            while (next < n && begin[next].first == begin[run].first) { next++; }
+
+            memcpy(helpPtr, &begin[run].first, sizeof(T));
+            helpPtr += sizeof(T);
+            helpPtr = IVSparse::BitPack::writeCount((next - run) << 2 | encodings[runNum], helpPtr);
+
+            switch (encodings[runNum]) {
+            case PACKED_ELIAS_FANO:
+                helpPtr = IVSparse::EliasFano::encode(indices.data() + run, next - run, helpPtr);
+                break;
+            case PACKED_ROARING:
+                helpPtr = sets[runNum].write(helpPtr);
+                break;
+            default:
+                for (size_t start = run; start < next; start += PACK_BLOCK_SIZE) {
+                    helpPtr = IVSparse::BitPack::packBlock(deltas.data() + start, std::min<size_t>(PACK_BLOCK_SIZE, next - start), helpPtr);
+                }
+                break;
+            }
+            run = next;
+        }
+    }
+
+    // Prints the matrix dense to the given stream
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 6, columnMajor>::print(std::ostream& os) {
+        os << std::endl;
+        os << "IVSparse Matrix" << std::endl;
+
+        // only the first 100 rows and columns are printed
+        uint32_t rows = std::min(numRows, (uint64_t)100);
+        uint32_t cols = std::min(numCols, (uint64_t)100);
+
+        std::vector<T> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            forEachEntry(i, [&](uint64_t index, T value) {
+                uint64_t row = columnMajor ? index : i;
+                uint64_t col = columnMajor ? i : index;
+                if (row < rows && col < cols) { dense[(size_t)row * cols + col] = value; }
+            });
+        }
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << dense[(size_t)i * cols + j] << " ";
+            }
+            os << std::endl;
+        }
+
+        os << std::endl;
+    }
+
+}  // namespace IVSparse
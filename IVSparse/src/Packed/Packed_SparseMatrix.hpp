@@ -0,0 +1,404 @@
+/**
+ * @file Packed_SparseMatrix.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Header File for Packed Sparse Matrix Declarations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * The encoding of the indices of one run of a Packed matrix, kept in the
+     * low bits of its count.
+     */
+    enum PackedEncoding : uint8_t {
+        PACKED_BLOCKS = 0,      // Bit packed blocks of deltas with exceptions
+        PACKED_ELIAS_FANO = 1,  // Elias-Fano with skip samples
+        PACKED_ROARING = 2      // Roaring style containers of arrays, bitmaps and intervals
+    };
+
+    /**
+     * The Packed Sparse Matrix Class is IVCSC with its index deltas bit
+     * packed. \n \n
+     * IVCSC rounds the deltas of a run up to whole bytes and one large delta
+     * widens the whole run. Here each run is its value, its varint number of indices
+     * and then blocks of up to 128 deltas, each packed at the number of bits that
+     * makes the block smallest. Deltas too large for the width of their block are
+     * patched in from a short list of exceptions (see IVSparse_BitPack.hpp).
+     * Runs are unpacked a block at a time with AVX2 when the CPU supports it and
+     * then handed to the same SIMD run kernels as VCSC. \n \n
+     * Runs of at least EF_MIN_RUN indices are stored Elias-Fano instead when
+     * that is no more than an eighth larger (see IVSparse_EliasFano.hpp). Those
+     * runs can be seeked into without decoding them, which coeff(), vector dot
+     * products and visiting a range of a vector take advantage of. Runs that
+     * are smaller still as Roaring style containers are stored that way (see
+     * IVSparse_IndexSet.hpp), which mostly catches runs of consecutive indices
+     * and dense runs. The index set of a run can be taken out for masking,
+     * subsetting and co-occurrence counts with set algebra.
+     *
+     * @note The inner dimension must fit in 32 bits.
+     */
+    template <typename T, typename indexT, bool columnMajor>
+    class SparseMatrix<T, indexT, 6, columnMajor> {
+        private:
+        //* The Matrix Data *//
+
+        void** data = nullptr;         // The start of each encoded vector
+        void** endPointers = nullptr;  // The end of each encoded vector
+
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
+
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
+
+        size_t compSize = 0;  // The size of the compressed matrix in bytes
+
+        //* Private Methods *//
+
+        // Calls visit(value, indices, count) for each run of a vector with its indices unpacked
+        template <typename Visit>
+        inline void forEachRun(uint64_t vec, Visit visit);
+
+        // Reads the header of a run, returns the start of its indices
+        static inline const uint8_t* readHeader(const uint8_t* run, uint32_t& count, uint8_t& encoding);
+
+        // Decodes the indices of a run into out, returns the end of the run
+        static inline const uint8_t* decodeIndices(const uint8_t* indices, uint32_t count, uint8_t encoding,
+                                                   uint32_t* out, const IVSparse::BitUnpacker& unpacker);
+
+        // Calls visit(value, cursor) for each run of a vector, only bit packed runs are unpacked
+        template <typename Visit>
+        inline void forEachRunCursor(uint64_t vec, Visit visit);
+
+        // Makes a cursor for each run of a vector, bit packed runs are unpacked into decoded
+        inline std::vector<std::pair<T, IVSparse::IndexCursor>> runCursors(uint64_t vec, std::vector<std::vector<uint32_t>>& decoded);
+
+        // Calls visit(value, count) with a reference to the value of each run of a vector without unpacking it
+        template <typename Visit>
+        inline void forEachValue(uint64_t vec, Visit visit);
+
+        // Allocates the per vector pointers for outerDim vectors
+        void allocateOuter();
+
+        // Frees every vector and the per vector pointers
+        void freeData();
+
+        // Compression Algorithm for going from CSC to Packed
+        template <typename T2, typename indexT2>
+        void compressCSC(const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers,
+                         const indexT2* innerNonZeros = nullptr);
+
+        // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+        template <int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat);
+
+        // Encodes one vector from its entries sorted by value and then index
+        void compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end);
+
+        // performs some simple user checks on the matrices metadata
+        void userChecks();
+
+        // Calculates the current byte size of the matrix in memory
+        void calculateCompSize();
+
+        // Scalar Multiplication
+        inline IVSparse::SparseMatrix<T, indexT, 6, columnMajor> scalarMultiply(T scalar);
+
+        // In Place Scalar Multiplication
+        inline void inPlaceScalarMultiply(T scalar);
+
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // helper for ostream operator
+        void print(std::ostream& stream);
+
+        public:
+
+        // Gets the number of rows in the matrix
+        uint64_t rows() const { return numRows; }
+
+        // Gets the number of columns in the matrix
+        uint64_t cols() const { return numCols; }
+
+        // Gets the inner dimension of the matrix
+        uint64_t innerSize() const { return innerDim; }
+
+        // Gets the outer dimension of the matrix
+        uint64_t outerSize() const { return outerDim; }
+
+        // Gets the number of non-zero elements in the matrix
+        uint64_t nonZeros() const { return nnz; }
+
+        // Gets the number of bytes needed to store the matrix
+        size_t byteSize() const { return compSize; }
+
+        //* Nested Subclasses *//
+
+        // The Iterator Class for Packed Matrices
+        class InnerIterator;
+
+        //* Constructors and Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Construct an empty IVSparse matrix \n \n
+          * The matrix will have 0 rows and 0 columns and
+          * will not be initialized with any values. All data
+          * will be set to nullptr.
+          */
+        SparseMatrix() {};
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor \n \n
+         * This constructor groups each vector of an Eigen Sparse Matrix into runs
+         * of a value and bit packs the indices of each run. The Eigen matrix is
+         * not modified, it may be in compressed or uncompressed mode.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T>& mat);
+
+        /**
+         * @param mat The Eigen Sparse Matrix to be compressed
+         *
+         * Eigen Sparse Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Sparse Matrices.
+         */
+        SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+
+        /**
+         * @tparam compressionLevel2 The compression level of the IVSparse matrix to
+         * convert
+         * @param mat The IVSparse matrix to convert
+         *
+         * Converts a IVSparse matrix of any compression level to a Packed
+         * matrix of the same storage order, value and index type.
+         */
+        template <uint8_t compressionLevel2>
+        SparseMatrix(IVSparse::SparseMatrix<T, indexT, compressionLevel2, columnMajor>& other);
+
+        /**
+         * @param other The IVSparse matrix to be copied
+         *
+         * Deep Copy Constructor \n \n
+         * This constructor takes in a Packed matrix and creates a deep copy of
+         * it.
+         */
+        SparseMatrix(const IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& other);
+
+        /**
+         * Raw CSC Constructor \n \n
+         * This constructor takes in raw CSC storage format pointers and converts it
+         * to a Packed matrix.
+         */
+        template <typename T2, typename indexT2>
+        SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
+
+        /**
+         * @brief Destroy the Sparse Matrix object
+         */
+        ~SparseMatrix();
+
+        ///@}
+
+        //* Getters *//
+        /**
+         * @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns T The value at the specified row and column. Returns 0 if the
+          * value is not found.
+          */
+        T coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @returns true If the matrix is stored in column major format
+         * @returns false If the matrix is stored in row major format
+         */
+        bool isColumnMajor() const;
+
+        /**
+         * @param vec The vector to get the size of
+         * @returns The number of bytes the encoded vector takes.
+         */
+        size_t getVectorSize(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to traverse
+         * @param visit Called as visit(index, value) for every non-zero
+         *
+         * Visits the non-zeros of a vector grouped by value. Each run is unpacked
+         * once before its indices are visited.
+         */
+        template <typename Visit>
+        inline void forEachEntry(uint64_t vec, Visit visit);
+
+        /**
+         * @param vec The vector to traverse
+         * @param start The first inner index to visit
+         * @param end One past the last inner index to visit
+         * @param visit Called as visit(index, value) for every non-zero in the range
+         *
+         * Visits the non-zeros of a vector with an inner index in [start, end),
+         * grouped by value. Elias-Fano runs seek straight to start.
+         */
+        template <typename Visit>
+        inline void forEachEntry(uint64_t vec, uint64_t start, uint64_t end, Visit visit);
+
+        /**
+         * @param vec The vector to traverse
+         * @param mask The inner indices to visit
+         * @param visit Called as visit(index, value) for every non-zero in the mask
+         *
+         * Visits the non-zeros of a vector with an inner index in the mask,
+         * grouped by value. Each run is intersected with the mask as a set.
+         */
+        template <typename Visit>
+        inline void forEachEntry(uint64_t vec, const IVSparse::IndexSet& mask, Visit visit);
+
+        /**
+         * @returns The inner indices of a vector that hold the given value.
+         */
+        IVSparse::IndexSet indexSet(uint64_t vec, T value);
+
+        /**
+         * @returns The inner indices of every non-zero of a vector.
+         */
+        IVSparse::IndexSet vectorPattern(uint64_t vec);
+
+        ///@}
+
+        //* Calculations *//
+        /**
+         * @name Calculations
+         */
+         ///@{
+
+         /**
+          * @tparam accumT The type the sums are accumulated in and returned as
+          * @returns A vector of the sum of each vector along the outer dimension.
+          */
+        template <typename accumT = T>
+        inline std::vector<accumT> outerSum();
+
+        /**
+         * @tparam accumT The type the sums are accumulated in and returned as
+         * @returns A vector of the sum of each vector along the inner dimension.
+         */
+        template <typename accumT = T>
+        inline std::vector<accumT> innerSum();
+
+        /**
+         * @tparam accumT The type the sum is accumulated in and returned as
+         * @returns The sum of all the values in the matrix.
+         */
+        template <typename accumT = T>
+        inline accumT sum();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns The frobenius norm of the matrix.
+         */
+        template <typename accumT = double>
+        inline accumT norm();
+
+        /**
+         * @tparam accumT The type the squares are accumulated in and returned as
+         * @returns Returns the length of the specified vector.
+         */
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        /**
+         * @tparam accumT The type the products are accumulated in and returned as
+         * @returns The dot product of two vectors along the outer dimension, an
+         * entry of the Gram matrix.
+         *
+         * Every run of one vector is intersected with every run of the other and
+         * the product of their values counted once per common index.
+         */
+        template <typename accumT = T>
+        inline accumT vectorDot(uint64_t vecA, uint64_t vecB);
+
+        /**
+         * @returns The number of inner indices where vector vecA holds valueA
+         * and vector vecB holds valueB.
+         */
+        inline uint64_t cooccurrence(uint64_t vecA, T valueA, uint64_t vecB, T valueB);
+
+        ///@}
+
+        //* Utility Methods *//
+        /**
+         * @name Utility Methods
+         */
+         ///@{
+
+         /**
+          * Prints "IVSparse Matrix:" followed by the dense representation of the
+          * matrix to the console.
+          *
+          * @note Useful for debugging but only goes up to 100 of either dimension.
+          */
+        void print();
+
+        /**
+         * @returns An Eigen Sparse Matrix constructed from the Packed matrix
+         * data.
+         */
+        Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> toEigen();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        friend std::ostream& operator<< (std::ostream& stream, IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& mat) {
+            mat.print(stream);
+            return stream;
+        }
+
+        // Assignment Operator
+        IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& operator=(const IVSparse::SparseMatrix<T, indexT, 6, columnMajor>& other);
+
+        // Equality Operator
+        bool operator==(const SparseMatrix<T, indexT, 6, columnMajor>& other) const;
+
+        // Inequality Operator
+        bool operator!=(const SparseMatrix<T, indexT, 6, columnMajor>& other);
+
+        // Coefficient Access Operator
+        T operator()(uint64_t row, uint64_t col);
+
+        // Scalar Multiplication
+        IVSparse::SparseMatrix<T, indexT, 6, columnMajor> operator*(T scalar);
+
+        // In Place Scalar Multiplication
+        void operator*=(T scalar);
+
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1>& mat);
+
+    };  // End of Packed Sparse Matrix Class
+
+}  // namespace IVSparse
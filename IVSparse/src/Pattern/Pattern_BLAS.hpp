@@ -0,0 +1,154 @@
+/**
+ * @file Pattern_BLAS.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief BLAS Routines and Other Matrix Calculations for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* BLAS Level 2 Routines *//
+
+    // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<bool, indexT, 3, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the vector is the correct size
+        assert((uint64_t)vec.rows() == numCols &&
+               "The vector must be the same size as the number of columns in the "
+               "matrix!");
+        #endif
+
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        if constexpr (columnMajor) {
+            // every entry is 1 so each column adds its vector entry to its rows
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                const accumT scale = vec(i);
+                if (scale == 0) return;
+
+                forEachIndex(i, [&](uint64_t index) { buffer[index] += scale; });
+            });
+        }
+        else {
+            // each row is the sum of the gathered vector entries
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0;
+                forEachIndex(i, [&](uint64_t index) { rowSum += vec(index); });
+                eigenTemp(i) = rowSum;
+            }
+        }
+        return eigenTemp;
+    }
+
+    //* BLAS Level 3 Routines *//
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<bool, indexT, 3, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and adds the rows of mat into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    forEachIndex(i, [&](uint64_t index) {
+                        newMatrix.col(index).segment(start, length) += matTranspose.col(i).segment(start, length);
+                    });
+                }
+            }
+        }
+        else {
+            // each row of the result is the sum of the rows of mat it touches
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                forEachIndex(i, [&](uint64_t index) { newMatrix.col(i) += matTranspose.col(index); });
+            }
+        }
+        return newMatrix.transpose();
+    }
+
+    //* Other Matrix Calculations *//
+
+    // Finds the number of entries in each outer vector
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<bool, indexT, 3, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            outerSum[i] = getNumIndices(i);
+        }
+        return outerSum;
+    }
+
+    // Finds the number of entries in each inner vector
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<bool, indexT, 3, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
+
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            forEachIndex(i, [&](uint64_t index) { buffer[index]++; });
+        });
+        return innerSum;
+    }
+
+    // Finds the sum of the matrix
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<bool, indexT, 3, columnMajor>::sum() {
+        return static_cast<accumT>(nnz);
+    }
+
+    // Calculates the norm of the matrix
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<bool, indexT, 3, columnMajor>::norm() {
+        return sqrt(static_cast<accumT>(nnz));
+    }
+
+    // Finds the length of a certain vector
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline accumT SparseMatrix<bool, indexT, 3, columnMajor>::vectorLength(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "Vector index out of bounds!");
+        #endif
+
+        return sqrt(static_cast<accumT>(getNumIndices(vec)));
+    }
+
+}  // namespace IVSparse
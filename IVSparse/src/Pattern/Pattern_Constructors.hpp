@@ -0,0 +1,84 @@
+/**
+ * @file Pattern_Constructors.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Constructors for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Destructor
+    template <typename indexT, bool columnMajor>
+    SparseMatrix<bool, indexT, 3, columnMajor>::~SparseMatrix() {
+        freeData();
+    }
+
+    // Eigen Constructor
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    SparseMatrix<bool, indexT, 3, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T2>& mat) {
+        // only the pattern of the matrix is kept
+        compressEigen(mat);
+    }
+
+    // Eigen Row Major Constructor
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    SparseMatrix<bool, indexT, 3, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T2, Eigen::RowMajor>& mat) {
+        // only the pattern of the matrix is kept
+        compressEigen(mat);
+    }
+
+    // Deep Copy Constructor
+    template <typename indexT, bool columnMajor>
+    SparseMatrix<bool, indexT, 3, columnMajor>::SparseMatrix(const IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& other) {
+        *this = other;
+    }
+
+    // Conversion Constructor
+    template <typename indexT, bool columnMajor>
+    template <typename T2, uint8_t compressionLevel2>
+    SparseMatrix<bool, indexT, 3, columnMajor>::SparseMatrix(IVSparse::SparseMatrix<T2, indexT, compressionLevel2, columnMajor>& other) {
+        // if already a pattern matrix
+        if constexpr (std::is_same_v<T2, bool> && compressionLevel2 == 3) {
+            *this = other;
+        }
+        else {
+            compressEigen(other.toEigen());
+        }
+    }
+
+    // Raw CSC Pattern Constructor
+    template <typename indexT, bool columnMajor>
+    template <typename indexT2>
+    SparseMatrix<bool, indexT, 3, columnMajor>::SparseMatrix(indexT2* innerIndices, indexT2* outerPtr,
+                                                             uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(num_rows > 0 && num_cols > 0 && nnz > 0 &&
+               "Error: Matrix dimensions must be greater than 0");
+        assert(innerIndices != nullptr && outerPtr != nullptr &&
+               "Error: Pointers cannot be null");
+        #endif
+
+        // set the dimensions
+        if (columnMajor) {
+            innerDim = num_rows;
+            outerDim = num_cols;
+        }
+        else {
+            innerDim = num_cols;
+            outerDim = num_rows;
+        }
+        numRows = num_rows;
+        numCols = num_cols;
+        this->nnz = nnz;
+
+        // call the compression function
+        compressCSC(innerIndices, outerPtr);
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,148 @@
+/**
+ * @file Pattern_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Methods for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    //* Getters *//
+
+    // Checks if there is an entry at the given row and column
+    template <typename indexT, bool columnMajor>
+    bool SparseMatrix<bool, indexT, 3, columnMajor>::coeff(uint64_t row, uint64_t col) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(row < numRows && col < numCols && "Invalid row and column!");
+        #endif
+
+        uint64_t vec = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        // the indices ascend so the scan stops at the first one past the index
+        uint64_t current = 0;
+        uint8_t* helpPtr = (uint8_t*)data[vec];
+        if (helpPtr == nullptr) return false;
+
+        uint8_t width = *helpPtr++;
+        for (; helpPtr < (uint8_t*)endPointers[vec]; helpPtr += width) {
+            uint64_t delta = 0;
+            memcpy(&delta, helpPtr, width);
+            current += delta;
+            if (current >= index) return current == index;
+        }
+        return false;
+    }
+
+    // Check for Column Major
+    template <typename indexT, bool columnMajor>
+    bool SparseMatrix<bool, indexT, 3, columnMajor>::isColumnMajor() const {
+        return columnMajor;
+    }
+
+    // Gets the number of bytes of an encoded vector
+    template <typename indexT, bool columnMajor>
+    size_t SparseMatrix<bool, indexT, 3, columnMajor>::getVectorSize(uint64_t vec) const {
+        return (uint8_t*)endPointers[vec] - (uint8_t*)data[vec];
+    }
+
+    // Gets the number of entries in a vector
+    template <typename indexT, bool columnMajor>
+    uint64_t SparseMatrix<bool, indexT, 3, columnMajor>::getNumIndices(uint64_t vec) const {
+        if (data[vec] == nullptr) return 0;
+        return (getVectorSize(vec) - 1) / *(uint8_t*)data[vec];
+    }
+
+    // Visits the indices of a vector in ascending order, the width is only checked once
+    template <typename indexT, bool columnMajor>
+    template <typename Visit>
+    inline void SparseMatrix<bool, indexT, 3, columnMajor>::forEachIndex(uint64_t vec, Visit visit) {
+        if (data[vec] == nullptr) return;
+
+        uint8_t* start = (uint8_t*)data[vec] + 1;
+        uint64_t n = getNumIndices(vec);
+
+        // prefix sum the deltas of the given width
+        auto decode = [&](auto* deltas) {
+            uint64_t current = 0;
+            for (uint64_t k = 0; k < n; k++) {
+                current += deltas[k];
+                visit(current);
+            }
+        };
+
+        switch (*(uint8_t*)data[vec]) {
+        case 1:
+            decode((uint8_t*)start);
+            break;
+        case 2:
+            decode((uint16_t*)start);
+            break;
+        case 4:
+            decode((uint32_t*)start);
+            break;
+        default:
+            decode((uint64_t*)start);
+            break;
+        }
+    }
+
+    //* Conversion Methods *//
+
+    // Converts the matrix to an Eigen sparse matrix with every entry 1
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    Eigen::SparseMatrix<T2, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> SparseMatrix<bool, indexT, 3, columnMajor>::toEigen() {
+
+        #ifdef IVSPARSE_DEBUG
+        // assert that the matrix is not empty
+        assert(outerDim > 0 && "Cannot convert an empty matrix to an Eigen matrix!");
+        #endif
+
+        Eigen::SparseMatrix<T2, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
+        eigenMatrix.reserve(nnz);
+
+        // the indices of each vector ascend so they can be appended in order
+        for (uint64_t i = 0; i < outerDim; i++) {
+            eigenMatrix.startVec(i);
+            forEachIndex(i, [&](uint64_t index) { eigenMatrix.insertBack(columnMajor ? index : i, columnMajor ? i : index) = 1; });
+        }
+        eigenMatrix.finalize();
+
+        return eigenMatrix;
+    }
+
+    // Converts the matrix to CSC with every entry 1
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    IVSparse::SparseMatrix<T2, indexT, 1, columnMajor> SparseMatrix<bool, indexT, 3, columnMajor>::toCSC() {
+        return IVSparse::SparseMatrix<T2, indexT, 1, columnMajor>(toEigen<T2>());
+    }
+
+    // Converts the matrix to VCSC with every entry 1
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    IVSparse::SparseMatrix<T2, indexT, 2, columnMajor> SparseMatrix<bool, indexT, 3, columnMajor>::toVCSC() {
+        return IVSparse::SparseMatrix<T2, indexT, 2, columnMajor>(toEigen<T2>());
+    }
+
+    // Converts the matrix to IVCSC with every entry 1
+    template <typename indexT, bool columnMajor>
+    template <typename T2>
+    IVSparse::SparseMatrix<T2, indexT, 3, columnMajor> SparseMatrix<bool, indexT, 3, columnMajor>::toIVCSC() {
+        return IVSparse::SparseMatrix<T2, indexT, 3, columnMajor>(toEigen<T2>());
+    }
+
+    //* Utility Methods *//
+
+    // Prints the matrix dense to console
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::print() {
+        print(std::cout);
+    }
+
+}  // namespace IVSparse
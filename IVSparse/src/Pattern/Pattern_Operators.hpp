@@ -0,0 +1,105 @@
+/**
+ * @file Pattern_Operators.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Operator Overloads for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Assignment Operator
+    template <typename indexT, bool columnMajor>
+    SparseMatrix<bool, indexT, 3, columnMajor>& SparseMatrix<bool, indexT, 3, columnMajor>::operator=(const IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& other) {
+        // check if the matrices are the same
+        if (this != &other) {
+            // free the old data
+            freeData();
+
+            // set the dimensions
+            numRows = other.numRows;
+            numCols = other.numCols;
+            outerDim = other.outerDim;
+            innerDim = other.innerDim;
+            nnz = other.nnz;
+            compSize = other.compSize;
+
+            if (other.data == nullptr) return *this;
+
+            allocateOuter();
+
+            // copy each encoded vector
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (other.data[i] == nullptr) continue;
+
+                size_t bytes = other.getVectorSize(i);
+                try {
+                    data[i] = malloc(bytes);
+                }
+                catch (std::bad_alloc& e) {
+                    std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+                    exit(1);
+                }
+                memcpy(data[i], other.data[i], bytes);
+                endPointers[i] = (uint8_t*)data[i] + bytes;
+            }
+        }
+
+        // return the new matrix
+        return *this;
+    }
+
+    // Equality Operator
+    template <typename indexT, bool columnMajor>
+    bool SparseMatrix<bool, indexT, 3, columnMajor>::operator==(const SparseMatrix<bool, indexT, 3, columnMajor>& other) const {
+        if (numRows != other.numRows || numCols != other.numCols || nnz != other.nnz) {
+            return false;
+        }
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            if (getVectorSize(i) != other.getVectorSize(i) ||
+                memcmp(data[i], other.data[i], getVectorSize(i)) != 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Inequality Operator
+    template <typename indexT, bool columnMajor>
+    bool SparseMatrix<bool, indexT, 3, columnMajor>::operator!=(const SparseMatrix<bool, indexT, 3, columnMajor>& other) {
+        return !(*this == other);
+    }
+
+    // Coefficent Access Operator
+    template <typename indexT, bool columnMajor>
+    bool SparseMatrix<bool, indexT, 3, columnMajor>::operator()(uint64_t row, uint64_t col) {
+        #ifdef IVSPARSE_DEBUG
+        // check if the row and column are in bounds
+        assert((row < numRows) && "Row index out of bounds");
+        assert((col < numCols) && "Column index out of bounds");
+        #endif
+
+        return coeff(row, col);
+    }
+
+    //* BLAS Operators *//
+
+    // Matrix Vector Multiplication
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, 1> SparseMatrix<bool, indexT, 3, columnMajor>::operator*(Eigen::Matrix<accumT, -1, 1>& vec) {
+        return vectorMultiply(vec);
+    }
+
+    // Matrix Matrix Multiplication
+    template <typename indexT, bool columnMajor>
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, -1> SparseMatrix<bool, indexT, 3, columnMajor>::operator*(Eigen::Matrix<accumT, -1, -1>& mat) {
+        return matrixMultiply(mat);
+    }
+
+}  // namespace IVSparse
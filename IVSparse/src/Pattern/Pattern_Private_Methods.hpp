@@ -0,0 +1,194 @@
+/**
+ * @file Pattern_Private_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Private Methods for Pattern Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    // Calculates the number of bytes needed to store a delta, rounded up to 1, 2, 4 or 8
+    template <typename indexT, bool columnMajor>
+    inline uint8_t SparseMatrix<bool, indexT, 3, columnMajor>::byteWidth(size_t size) {
+        if (size <= 0xFF) return 1;
+        if (size <= 0xFFFF) return 2;
+        if (size <= 0xFFFFFFFF) return 4;
+        return 8;
+    }
+
+    // Allocates the per vector pointers, every vector starts empty
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::allocateOuter() {
+        try {
+            data = (void**)calloc(outerDim, sizeof(void*));
+            endPointers = (void**)calloc(outerDim, sizeof(void*));
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for IVSparse matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Frees every vector and the per vector pointers
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::freeData() {
+        if (data != nullptr) {
+            for (uint64_t i = 0; i < outerDim; i++) {
+                if (data[i] != nullptr) { free(data[i]); }
+            }
+        }
+
+        free(data);
+        free(endPointers);
+
+        data = nullptr;
+        endPointers = nullptr;
+    }
+
+    // performs some simple user checks on the matrices metadata
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::userChecks() {
+        assert((innerDim > 1 || outerDim > 1 || nnz > 1) &&
+               "The matrix must have at least one row, column, and nonzero value");
+        assert(std::is_floating_point<indexT>::value == false &&
+               "The index type must be a non-floating point type");
+        assert((std::is_same<indexT, bool>::value == false) &&
+               "The index type must not be bool");
+        assert((innerDim < std::numeric_limits<indexT>::max() &&
+                outerDim < std::numeric_limits<indexT>::max()) &&
+               "The number of rows and columns must be less than the maximum value "
+               "of the index type");
+    }
+
+    // Calculates the current byte size of the matrix in memory
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::calculateCompSize() {
+        compSize = 0;
+
+        for (uint64_t i = 0; i < outerDim; i++) {
+            compSize += getVectorSize(i);
+        }
+    }
+
+    // Compression Algorithm for going from a CSC pattern to a Pattern matrix
+    template <typename indexT, bool columnMajor>
+    template <typename indexT2>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::compressCSC(const indexT2* innerIndices, const indexT2* outerPointers,
+                                                                 const indexT2* innerNonZeros) {
+
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+
+        allocateOuter();
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            // the end of the vector, an uncompressed Eigen matrix has gaps between its vectors
+            uint64_t end = innerNonZeros == nullptr ? outerPointers[i + 1] : outerPointers[i] + innerNonZeros[i];
+
+            std::vector<indexT> indices(innerIndices + outerPointers[i], innerIndices + end);
+            if (!std::is_sorted(indices.begin(), indices.end())) {
+                std::sort(indices.begin(), indices.end());
+            }
+
+            compressVector(i, indices.data(), indices.data() + indices.size());
+        }
+
+        calculateCompSize();
+    }
+
+    // Compresses the pattern of an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename indexT, bool columnMajor>
+    template <typename T2, int storageOrder>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::compressEigen(const Eigen::SparseMatrix<T2, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T2, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            nnz = mat.nonZeros();
+
+            compressCSC(mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
+
+    // Encodes one vector as a width byte, its first index and the deltas to the rest
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::compressVector(uint64_t vec, indexT* begin, indexT* end) {
+        size_t n = end - begin;
+
+        // an empty vector has no data
+        if (n == 0) {
+            data[vec] = nullptr;
+            endPointers[vec] = nullptr;
+            return;
+        }
+
+        uint64_t maxDelta = *begin;
+        for (indexT* index = begin + 1; index < end; index++) {
+            maxDelta = std::max<uint64_t>(maxDelta, *index - *(index - 1));
+        }
+        uint8_t width = byteWidth(maxDelta);
+
+        try {
+            data[vec] = malloc(1 + width * n);
+        }
+        catch (std::bad_alloc& e) {
+            throw std::bad_alloc();
+        }
+        endPointers[vec] = (uint8_t*)data[vec] + 1 + width * n;
+
+        uint8_t* helpPtr = (uint8_t*)data[vec];
+        *helpPtr++ = width;
+
+        for (indexT* index = begin; index < end; index++) {
+            uint64_t delta = index == begin ? *index : *index - *(index - 1);
+            memcpy(helpPtr, &delta, width);
+            helpPtr += width;
+        }
+    }
+
+    // Prints the matrix dense to the given stream
+    template <typename indexT, bool columnMajor>
+    void SparseMatrix<bool, indexT, 3, columnMajor>::print(std::ostream& os) {
+        os << std::endl;
+        os << "IVSparse Matrix" << std::endl;
+
+        // only the first 100 rows and columns are printed
+        uint32_t rows = std::min(numRows, (uint64_t)100);
+        uint32_t cols = std::min(numCols, (uint64_t)100);
+
+        std::vector<uint8_t> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            forEachIndex(i, [&](uint64_t index) {
+                uint64_t row = columnMajor ? index : i;
+                uint64_t col = columnMajor ? i : index;
+                if (row < rows && col < cols) { dense[(size_t)row * cols + col] = 1; }
+            });
+        }
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << (int)dense[(size_t)i * cols + j] << " ";
+            }
+            os << std::endl;
+        }
+
+        os << std::endl;
+    }
+
+}  // namespace IVSparse
@@ -0,0 +1,336 @@
+/**
+ * @file Pattern_SparseMatrix.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Header File for Pattern Sparse Matrix Declarations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+    /**
+     * The Pattern Sparse Matrix Class is the value free form of IVCSC for binary
+     * matrices. \n \n
+     * Every stored entry is a 1, so there is nothing to store but the inner
+     * indices. Each vector is a width byte followed by its first index and the
+     * deltas to the following indices, all of that width. The width is rounded
+     * up to 1, 2, 4 or 8 bytes so every vector decodes as a plain array and the
+     * calculations are pure index traffic. Any value type and compression level
+     * can be converted to a pattern matrix and back.
+     */
+    template <typename indexT, bool columnMajor>
+    class SparseMatrix<bool, indexT, 3, columnMajor> {
+        private:
+        //* The Matrix Data *//
+
+        void** data = nullptr;         // The start of each encoded vector
+        void** endPointers = nullptr;  // The end of each encoded vector
+
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
+
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
+
+        size_t compSize = 0;  // The size of the compressed matrix in bytes
+
+        //* Private Methods *//
+
+        // Calculates the number of bytes needed to store a delta, rounded up to 1, 2, 4 or 8
+        static inline uint8_t byteWidth(size_t size);
+
+        // Allocates the per vector pointers for outerDim vectors
+        void allocateOuter();
+
+        // Frees every vector and the per vector pointers
+        void freeData();
+
+        // Compression Algorithm for going from a CSC pattern to a Pattern matrix
+        template <typename indexT2>
+        void compressCSC(const indexT2* innerIndices, const indexT2* outerPointers,
+                         const indexT2* innerNonZeros = nullptr);
+
+        // Compresses the pattern of an Eigen matrix of any value type and storage order
+        template <typename T2, int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T2, storageOrder>& mat);
+
+        // Encodes one vector from its ascending inner indices
+        void compressVector(uint64_t vec, indexT* begin, indexT* end);
+
+        // performs some simple user checks on the matrices metadata
+        void userChecks();
+
+        // Calculates the current byte size of the matrix in memory
+        void calculateCompSize();
+
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // helper for ostream operator
+        void print(std::ostream& stream);
+
+        public:
+
+        // Gets the number of rows in the matrix
+        uint64_t rows() const { return numRows; }
+
+        // Gets the number of columns in the matrix
+        uint64_t cols() const { return numCols; }
+
+        // Gets the inner dimension of the matrix
+        uint64_t innerSize() const { return innerDim; }
+
+        // Gets the outer dimension of the matrix
+        uint64_t outerSize() const { return outerDim; }
+
+        // Gets the number of non-zero elements in the matrix
+        uint64_t nonZeros() const { return nnz; }
+
+        // Gets the number of bytes needed to store the matrix
+        size_t byteSize() const { return compSize; }
+
+        //* Nested Subclasses *//
+
+        // The Iterator Class for Pattern Matrices
+        class InnerIterator;
+
+        //* Constructors and Destructor *//
+        /** @name Constructors
+         */
+         ///@{
+
+         /**
+          * Construct an empty IVSparse matrix \n \n
+          * The matrix will have 0 rows and 0 columns and
+          * will not be initialized with any values. All data
+          * will be set to nullptr.
+          */
+        SparseMatrix() {};
+
+        /**
+         * @param mat The Eigen Sparse Matrix to take the pattern of
+         *
+         * Eigen Sparse Matrix Constructor \n \n
+         * Every stored entry of the Eigen matrix becomes a 1, whatever its value
+         * type. The Eigen matrix is not modified, it may be in compressed or
+         * uncompressed mode.
+         */
+        template <typename T2>
+        SparseMatrix(const Eigen::SparseMatrix<T2>& mat);
+
+        /**
+         * @param mat The Eigen Sparse Matrix to take the pattern of
+         *
+         * Eigen Sparse Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Sparse Matrices.
+         */
+        template <typename T2>
+        SparseMatrix(const Eigen::SparseMatrix<T2, Eigen::RowMajor>& mat);
+
+        /**
+         * @tparam T2 The value type of the IVSparse matrix to convert
+         * @tparam compressionLevel2 The compression level of the IVSparse matrix to
+         * convert
+         * @param other The IVSparse matrix to convert
+         *
+         * Takes the pattern of an IVSparse matrix of any value type and
+         * compression level with the same storage order and index type.
+         */
+        template <typename T2, uint8_t compressionLevel2>
+        SparseMatrix(IVSparse::SparseMatrix<T2, indexT, compressionLevel2, columnMajor>& other);
+
+        /**
+         * @param other The IVSparse matrix to be copied
+         *
+         * Deep Copy Constructor \n \n
+         * This constructor takes in a Pattern matrix and creates a deep copy of it.
+         */
+        SparseMatrix(const IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& other);
+
+        /**
+         * Raw CSC Pattern Constructor \n \n
+         * This constructor takes in the index arrays of a CSC matrix, there are
+         * no values to pass.
+         */
+        template <typename indexT2>
+        SparseMatrix(indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
+
+        /**
+         * @brief Destroy the Sparse Matrix object
+         */
+        ~SparseMatrix();
+
+        ///@}
+
+        //* Getters *//
+        /**
+         * @name Getters
+         */
+         ///@{
+
+         /**
+          * @returns true If there is an entry at the specified row and column.
+          */
+        bool coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @returns true If the matrix is stored in column major format
+         * @returns false If the matrix is stored in row major format
+         */
+        bool isColumnMajor() const;
+
+        /**
+         * @param vec The vector to get the size of
+         * @returns The number of bytes the encoded vector takes.
+         */
+        size_t getVectorSize(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to get the number of entries of
+         * @returns The number of entries in the vector.
+         */
+        uint64_t getNumIndices(uint64_t vec) const;
+
+        /**
+         * @param vec The vector to traverse
+         * @param visit Called as visit(index) for every entry in ascending order
+         *
+         * Visits the indices of a vector with a loop specialized to its width,
+         * which is only looked at once.
+         */
+        template <typename Visit>
+        inline void forEachIndex(uint64_t vec, Visit visit);
+
+        ///@}
+
+        //* Calculations *//
+        /**
+         * @name Calculations
+         */
+         ///@{
+
+         /**
+          * @returns A vector of the number of entries in each vector along the
+          * outer dimension.
+          */
+        template <typename accumT = uint64_t>
+        inline std::vector<accumT> outerSum();
+
+        /**
+         * @returns A vector of the number of entries in each vector along the
+         * inner dimension.
+         */
+        template <typename accumT = uint64_t>
+        inline std::vector<accumT> innerSum();
+
+        /**
+         * @returns The number of entries in the matrix.
+         */
+        template <typename accumT = uint64_t>
+        inline accumT sum();
+
+        /**
+         * @returns The frobenius norm of the matrix.
+         */
+        template <typename accumT = double>
+        inline accumT norm();
+
+        /**
+         * @returns Returns the length of the specified vector.
+         */
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        ///@}
+
+        //* Conversion Methods *//
+        /**
+         * @name Conversion Methods
+         */
+         ///@{
+
+         /**
+          * @tparam T2 The value type of the result, every entry is 1
+          * @returns An Eigen Sparse Matrix with the pattern of the matrix.
+          */
+        template <typename T2 = bool>
+        Eigen::SparseMatrix<T2, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> toEigen();
+
+        /**
+         * @tparam T2 The value type of the result, every entry is 1
+         * @returns A CSC matrix with the pattern of the matrix.
+         */
+        template <typename T2>
+        IVSparse::SparseMatrix<T2, indexT, 1, columnMajor> toCSC();
+
+        /**
+         * @tparam T2 The value type of the result, every entry is 1
+         * @returns A VCSC matrix with the pattern of the matrix.
+         */
+        template <typename T2>
+        IVSparse::SparseMatrix<T2, indexT, 2, columnMajor> toVCSC();
+
+        /**
+         * @tparam T2 The value type of the result, every entry is 1
+         * @returns An IVCSC matrix with the pattern of the matrix.
+         */
+        template <typename T2>
+        IVSparse::SparseMatrix<T2, indexT, 3, columnMajor> toIVCSC();
+
+        ///@}
+
+        //* Utility Methods *//
+        /**
+         * @name Utility Methods
+         */
+         ///@{
+
+         /**
+          * Prints "IVSparse Matrix:" followed by the dense representation of the
+          * matrix to the console.
+          *
+          * @note Useful for debugging but only goes up to 100 of either dimension.
+          */
+        void print();
+
+        ///@}
+
+        //* Operator Overloads *//
+
+        friend std::ostream& operator<< (std::ostream& stream, IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& mat) {
+            mat.print(stream);
+            return stream;
+        }
+
+        // Assignment Operator
+        IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& operator=(const IVSparse::SparseMatrix<bool, indexT, 3, columnMajor>& other);
+
+        // Equality Operator
+        bool operator==(const SparseMatrix<bool, indexT, 3, columnMajor>& other) const;
+
+        // Inequality Operator
+        bool operator!=(const SparseMatrix<bool, indexT, 3, columnMajor>& other);
+
+        // Coefficient Access Operator
+        bool operator()(uint64_t row, uint64_t col);
+
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
+
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1>& mat);
+
+    };  // End of Pattern Sparse Matrix Class
+
+}  // namespace IVSparse
@@ -22,10 +22,8 @@ namespace IVSparse {
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                newMatrix.values[i][j] *= scalar;
-            }
+        for (int64_t j = 0; j < (int64_t)valueOffsets[outerDim]; j++) {
+            newMatrix.values[j] *= scalar;
         }
         return newMatrix;
     }
@@ -37,10 +35,8 @@ namespace IVSparse {
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                values[i][j] *= scalar;
-            }
+        for (int64_t j = 0; j < (int64_t)valueOffsets[outerDim]; j++) {
+            values[j] *= scalar;
         }
     }
 
@@ -48,21 +44,47 @@ namespace IVSparse {
 
     // Matrix Vector Multiplication (IVSparse::SparseMatrix * Eigen::Vector)
     template <typename T, typename indexT, bool columnMajor>
-    inline Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::vectorMultiply(Eigen::Matrix<T, -1, 1>& vec) {
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec) {
 
         #ifdef IVSPARSE_DEBUG
         // check that the vector is the correct size
-        assert(vec.rows() == outerDim &&
+        assert((uint64_t)vec.rows() == numCols &&
                "The vector must be the same size as the number of columns in the "
                "matrix!");
         #endif
 
-        Eigen::Matrix<T, -1, 1> eigenTemp = Eigen::Matrix<T, -1, 1>::Zero(innerDim, 1);
+        Eigen::Matrix<accumT, -1, 1> eigenTemp = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        // each run of indices is handled as one block by the SIMD kernels, which work in the dense type
+        const IVSparse::RunKernels<accumT, indexT> kernels(innerDim);
+
+        if constexpr (columnMajor) {
+            // scatter each column scaled by its vector entry, each value is only scaled once
+            IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, eigenTemp.data(), [&](uint64_t i, accumT* buffer) {
+                if (vec(i) == 0) return;
 
-        // iterate over the vector and multiply the corresponding row of the matrix by the vecIter value
-        for (uint32_t i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator matIter(*this, i); matIter; ++matIter) {
-                eigenTemp(matIter.row()) += vec(matIter.col()) * matIter.value();
+                indexT* index = indices + indexOffsets[i];
+                for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                    kernels.scatterAdd(buffer, index, counts[j], static_cast<accumT>(values[j]) * vec(i));
+                    index += counts[j];
+                }
+            });
+        }
+        else {
+            // each row is an independent dot product, the values are factored out of their indices
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                accumT rowSum = 0;
+
+                indexT* index = indices + indexOffsets[i];
+                for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                    rowSum += static_cast<accumT>(values[j]) * kernels.gatherSum(vec.data(), index, counts[j]);
+                    index += counts[j];
+                }
+                eigenTemp(i) = rowSum;
             }
         }
         return eigenTemp;
@@ -71,44 +93,120 @@ namespace IVSparse {
     // Matrix Vector Multiplication (IVSparse::SparseMatrix *
     // IVSparse::SparseMatrix::Vector)
     template <typename T, typename indexT, bool columnMajor>
-    inline Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::vectorMultiply(typename SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec) {
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::vectorMultiply(typename SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec) {
 
         #ifdef IVSPARSE_DEBUG
-        if (vec.length() != outerDim)
+        if (vec.getLength() != numCols)
             throw std::invalid_argument(
                 "The vector must be the same size as the number of columns in the "
                 "matrix!");
         #endif
 
-        Eigen::Matrix<T, -1, 1> newVector = Eigen::Matrix<T, -1, 1>::Zero(innerDim, 1);
+        Eigen::Matrix<accumT, -1, 1> newVector = Eigen::Matrix<accumT, -1, 1>::Zero(numRows, 1);
+
+        if constexpr (columnMajor) {
+            const IVSparse::RunKernels<accumT, indexT> kernels(innerDim);
 
-        for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator vecIter(vec);
-             vecIter; ++vecIter) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator
-                 matIter(*this, vecIter.row());
-                 matIter; ++matIter) {
-                newVector(matIter.row()) += matIter.value() * vecIter.value();
+            // only the columns matching a non-zero of the vector are scattered
+            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+                uint64_t i = vecIter.getIndex();
+
+                indexT* index = indices + indexOffsets[i];
+                for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                    kernels.scatterAdd(newVector.data(), index, counts[j], static_cast<accumT>(values[j]) * vecIter.value());
+                    index += counts[j];
+                }
+            }
+        }
+        else {
+            // the rows gather from the vector, so it is made dense first
+            Eigen::Matrix<accumT, -1, 1> dense = Eigen::Matrix<accumT, -1, 1>::Zero(numCols, 1);
+            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator vecIter(vec); vecIter; ++vecIter) {
+                dense(vecIter.getIndex()) = vecIter.value();
             }
+            newVector = vectorMultiply(dense);
         }
         return newVector;
     }
 
     //* BLAS Level 3 Routines *//
-    // Matrix multiplication has been moved to the VCSC_Operator.hpp file
+
+    // Matrix Matrix Multiplication (IVSparse::SparseMatrix * Eigen::Matrix)
+    template <typename T, typename indexT, bool columnMajor>
+    template <typename accumT>
+    inline Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 2, columnMajor>::matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat) {
+
+        #ifdef IVSPARSE_DEBUG
+        // check that the matrix is the correct size
+        if ((uint64_t)mat.rows() != numCols)
+            throw std::invalid_argument(
+                "The left matrix must have the same # of rows as columns in the right "
+                "matrix!");
+        #endif
+
+        // work on the transposes so the rows of both dense matrices are contiguous
+        Eigen::Matrix<accumT, -1, -1> matTranspose = mat.transpose();
+        Eigen::Matrix<accumT, -1, -1> newMatrix = Eigen::Matrix<accumT, -1, -1>::Zero(mat.cols(), numRows);
+        const int64_t width = mat.cols();
+
+        if constexpr (columnMajor) {
+            // each thread owns a block of the dense columns and scatters the whole matrix into it
+            const int64_t blockWidth = 8;
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 1)
+            #endif
+            for (int64_t start = 0; start < width; start += blockWidth) {
+                const int64_t length = std::min(blockWidth, width - start);
+                Eigen::Matrix<accumT, -1, 1> scaled(length);
+
+                for (uint64_t i = 0; i < outerDim; i++) {
+                    indexT* index = indices + indexOffsets[i];
+                    for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                        scaled = matTranspose.col(i).segment(start, length) * static_cast<accumT>(values[j]);
+                        for (indexT k = 0; k < counts[j]; k++) {
+                            newMatrix.col(*index++).segment(start, length) += scaled;
+                        }
+                    }
+                }
+            }
+        }
+        else {
+            // each row of the result only reads the rows of mat it touches, values are applied once
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+            #endif
+            for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                Eigen::Matrix<accumT, -1, 1> runSum(width);
+
+                indexT* index = indices + indexOffsets[i];
+                for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                    runSum.setZero();
+                    for (indexT k = 0; k < counts[j]; k++) {
+                        runSum += matTranspose.col(*index++);
+                    }
+                    newMatrix.col(i) += runSum * static_cast<accumT>(values[j]);
+                }
+            }
+        }
+        return newMatrix.transpose();
+    }
 
     //* Other Matrix Calculations *//
 
     // Finds the Outer Sum of the Matrix
     template <typename T, typename indexT, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::outerSum() {
-        std::vector<T> outerSum = std::vector<T>(outerDim);
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 2, columnMajor>::outerSum() {
+        std::vector<accumT> outerSum = std::vector<accumT>(outerDim);
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                outerSum[i] += values[i][j] * counts[i][j];
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                outerSum[i] += static_cast<accumT>(values[j]) * counts[j];
             }
         }
         return outerSum;
@@ -116,87 +214,140 @@ namespace IVSparse {
 
     // Finds the Inner Sum of the Matrix
     template <typename T, typename indexT, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::innerSum() {std::vector<T> innerSum = std::vector<T>(innerDim);
-
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i);it; ++it) {
-                innerSum[it.row()] += it.value();
+    template <typename accumT>
+    inline std::vector<accumT> SparseMatrix<T, indexT, 2, columnMajor>::innerSum() {
+        std::vector<accumT> innerSum = std::vector<accumT>(innerDim);
+
+        const IVSparse::RunKernels<accumT, indexT> kernels(innerDim);
+
+        // scattered into fixed partial buffers so the outer vectors can be split between threads
+        IVSparse::blockedInnerSum<accumT>(outerDim, innerDim, innerSum.data(), [&](uint64_t i, accumT* buffer) {
+            indexT* index = indices + indexOffsets[i];
+            for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                kernels.scatterAdd(buffer, index, counts[j], static_cast<accumT>(values[j]));
+                index += counts[j];
             }
-        }
+        });
         return innerSum;
     }
 
     // Finds the maximum value in each column
     template <typename T, typename indexT, bool columnMajor>
     inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::maxColCoeff() {
-        std::vector<T> maxCoeff = std::vector<T>(innerDim);
+        if constexpr (columnMajor) { return outerExtremes<true>(nullptr); }
+        else { return innerExtremes<true>(nullptr); }
+    }
 
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                if (values[i][j] > maxCoeff[i]) {
-                    maxCoeff[i] = values[i][j];
-                }
-            }
-        }
-        return maxCoeff;
+    // Finds the maximum value and its row in each column
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::maxColCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return outerExtremes<true>(&indices); }
+        else { return innerExtremes<true>(&indices); }
     }
 
     // Finds the maximum value in each row
     template <typename T, typename indexT, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::maxRowCoeff() {std::vector<T> maxCoeff = std::vector<T>(innerDim);
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::maxRowCoeff() {
+        if constexpr (columnMajor) { return innerExtremes<true>(nullptr); }
+        else { return outerExtremes<true>(nullptr); }
+    }
 
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i);it; ++it) {
-                if (it.value() > maxCoeff[it.row()]) {
-                    maxCoeff[it.row()] = it.value();
-                }
-            }
-        }
-        return maxCoeff;
+    // Finds the maximum value and its column in each row
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::maxRowCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return innerExtremes<true>(&indices); }
+        else { return outerExtremes<true>(&indices); }
     }
 
     // Finds the minimum value in each column
     template <typename T, typename indexT, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minColCoeff() {std::vector<T> minCoeff = std::vector<T>(innerDim);
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minColCoeff() {
+        if constexpr (columnMajor) { return outerExtremes<false>(nullptr); }
+        else { return innerExtremes<false>(nullptr); }
+    }
 
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                if (values[i][j] < minCoeff[i]) {
-                    minCoeff[i] = values[i][j];
-                }
-            }
-        }
-        return minCoeff;
+    // Finds the minimum value and its row in each column
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minColCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return outerExtremes<false>(&indices); }
+        else { return innerExtremes<false>(&indices); }
     }
 
     // Finds the minimum value in each row
     template <typename T, typename indexT, bool columnMajor>
-    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minRowCoeff() {std::vector<T> minCoeff = std::vector<T>(innerDim);
-        memset(minCoeff.data(), 0xF, innerDim * sizeof(T));
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minRowCoeff() {
+        if constexpr (columnMajor) { return innerExtremes<false>(nullptr); }
+        else { return outerExtremes<false>(nullptr); }
+    }
+
+    // Finds the minimum value and its column in each row
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::minRowCoeff(std::vector<uint64_t>& indices) {
+        if constexpr (columnMajor) { return innerExtremes<false>(&indices); }
+        else { return outerExtremes<false>(&indices); }
+    }
+
+    // Minimum or maximum of each outer vector, only reading the unique values
+    template <typename T, typename indexT, bool columnMajor>
+    template <bool isMax>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::outerExtremes(std::vector<uint64_t>* argIndices) {
+        std::vector<T> result(outerDim);
+        if (argIndices != nullptr) { argIndices->assign(outerDim, 0); }
 
         #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic, 64)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i);it; ++it) {
-                if (it.value() < minCoeff[it.row()]) {
-                    minCoeff[it.row()] = it.value();
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            bool found = false;
+            T value = 0;
+            uint64_t index = 0, offset = 0;
+            indexT* vecIndices = indices + indexOffsets[i];
+            uint64_t numIndices = indexOffsets[i + 1] - indexOffsets[i];
+
+            for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                // the first index of a run is its smallest
+                uint64_t first = numIndices == 0 ? 0 : vecIndices[offset];
+
+                if (!found || (isMax ? values[j] > value : values[j] < value) || (values[j] == value && first < index)) {
+                    value = values[j];
+                    index = first;
+                    found = true;
+                }
+                offset += counts[j];
+            }
+
+            // compare against the implicit zeros
+            if (offset < innerDim && (!found || (isMax ? value < 0 : value > 0))) {
+                value = 0;
+
+                if (argIndices != nullptr) {
+                    std::vector<indexT> stored(vecIndices, vecIndices + numIndices);
+                    std::sort(stored.begin(), stored.end());
+
+                    index = 0;
+                    while (index < stored.size() && (uint64_t)stored[index] == index) { index++; }
                 }
             }
+
+            result[i] = value;
+            if (argIndices != nullptr) { (*argIndices)[i] = index; }
         }
-        return minCoeff;
+        return result;
+    }
+
+    // Minimum or maximum of each inner vector
+    template <typename T, typename indexT, bool columnMajor>
+    template <bool isMax>
+    inline std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::innerExtremes(std::vector<uint64_t>* argIndices) {
+        return IVSparse::blockedInnerExtremes<T, isMax>(outerDim, innerDim, argIndices, [this](uint64_t vec, auto&& visit) {
+            indexT* index = indices + indexOffsets[vec];
+
+            for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+                for (indexT k = 0; k < counts[j]; k++, index++) {
+                    visit(*index, values[j]);
+                }
+            }
+        });
     }
 
     // Calculates the trace of the matrix
@@ -212,14 +363,12 @@ namespace IVSparse {
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : trace)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i);it; ++it) {
-                if (it.row() == i) {
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            // the diagonal is where the inner index matches the outer index in either storage order
+            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                if (it.getIndex() == i) {
                     trace += it.value();
                 }
-                else if (it.row() > i) {
-                    continue;
-                }
             }
         }
         return trace;
@@ -227,54 +376,157 @@ namespace IVSparse {
 
     // Calculates the sum of the matrix
     template <typename T, typename indexT, bool columnMajor>
-    inline T SparseMatrix<T, indexT, 2, columnMajor>::sum() {
-        T sum = 0;
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 2, columnMajor>::sum() {
+        accumT sum = 0;
         // std::vector<T> outerSum = this->outerSum();
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : sum)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                sum += values[i][j] * counts[i][j];
-            }
+        for (int64_t j = 0; j < (int64_t)valueOffsets[outerDim]; j++) {
+            sum += static_cast<accumT>(values[j]) * counts[j];
         }
         return sum;
     }
 
     // Calculates the norm of the matrix
     template <typename T, typename indexT, bool columnMajor>
-    inline double SparseMatrix<T, indexT, 2, columnMajor>::norm() {
-        double norm = 0;
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 2, columnMajor>::norm() {
+        accumT norm = 0;
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : norm)
         #endif
-        for (int i = 0; i < outerDim; i++) {
-            for (int j = 0; j < valueSizes[i]; j++) {
-                norm += values[i][j] * values[i][j] * counts[i][j];
-            }
+        for (int64_t j = 0; j < (int64_t)valueOffsets[outerDim]; j++) {
+            norm += static_cast<accumT>(values[j]) * static_cast<accumT>(values[j]) * counts[j];
         }
         return sqrt(norm);
     }
 
     // Finds the length of a certain column
     template <typename T, typename indexT, bool columnMajor>
-    inline double SparseMatrix<T, indexT, 2, columnMajor>::vectorLength(uint32_t col) {
+    template <typename accumT>
+    inline accumT SparseMatrix<T, indexT, 2, columnMajor>::vectorLength(uint64_t col) {
 
         #ifdef IVSPARSE_DEBUG
         assert(col < outerDim && col >= 0 && "Column index out of bounds!");
         #endif
 
-        double norm = 0;
+        accumT norm = 0;
 
         #ifdef IVSPARSE_HAS_OPENMP
         #pragma omp parallel for reduction(+ : norm)
         #endif
-        for (int i = 0; i < valueSizes[col]; i++) {
-            norm += values[col][i] * values[col][i] * counts[col][i];
+        for (int64_t i = valueOffsets[col]; i < (int64_t)valueOffsets[col + 1]; i++) {
+            norm += static_cast<accumT>(values[i]) * static_cast<accumT>(values[i]) * counts[i];
         }
         return sqrt(norm);
     }
 
-}  // namespace IVSparse
\ No newline at end of file
+    // Finds the statistics of each column
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, 2, columnMajor>::columnStats() {
+        if constexpr (columnMajor) { return outerStats(); }
+        else { return innerStats(); }
+    }
+
+    // Finds the statistics of each row
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, 2, columnMajor>::rowStats() {
+        if constexpr (columnMajor) { return innerStats(); }
+        else { return outerStats(); }
+    }
+
+    // Statistics of each outer vector straight from the values and counts
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, 2, columnMajor>::outerStats() {
+        IVSparse::SummaryStats stats(outerDim);
+        std::vector<IVSparse::Moments> moments(outerDim);
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            double sum = 0, sumSq = 0;
+
+            for (uint64_t j = valueOffsets[i]; j < valueOffsets[i + 1]; j++) {
+                double value = static_cast<double>(values[j]);
+                sum += value * counts[j];
+                sumSq += value * value * counts[j];
+                moments[i].add(value, counts[j]);
+            }
+
+            stats.sum[i] = sum;
+            stats.sumSq[i] = sumSq;
+        }
+
+        stats.finalize(moments, innerDim);
+        return stats;
+    }
+
+    // Statistics of each inner vector
+    template <typename T, typename indexT, bool columnMajor>
+    inline IVSparse::SummaryStats SparseMatrix<T, indexT, 2, columnMajor>::innerStats() {
+        IVSparse::SummaryStats stats(innerDim);
+
+        IVSparse::blockedInnerStats(outerDim, innerDim, stats, [this](uint64_t vec, double* sum, double* sumSq, IVSparse::Moments* moments) {
+            indexT* index = indices + indexOffsets[vec];
+
+            for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+                double value = static_cast<double>(values[j]);
+                double square = value * value;
+
+                for (indexT k = 0; k < counts[j]; k++, index++) {
+                    sum[*index] += value;
+                    sumSq[*index] += square;
+                    moments[*index].add(value);
+                }
+            }
+        });
+
+        return stats;
+    }
+
+    // Histogram of a vector straight from its unique values and counts
+    template <typename T, typename indexT, bool columnMajor>
+    inline std::vector<std::pair<T, uint64_t>> SparseMatrix<T, indexT, 2, columnMajor>::valueHistogram(uint64_t vec) {
+
+        #ifdef IVSPARSE_DEBUG
+        assert(vec < outerDim && "The vector index is out of bounds!");
+        #endif
+
+        std::vector<std::pair<T, uint64_t>> histogram;
+        histogram.reserve(valueOffsets[vec + 1] - valueOffsets[vec]);
+
+        for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+            histogram.emplace_back(values[j], counts[j]);
+        }
+
+        // values are only sorted until they are modified in place
+        std::sort(histogram.begin(), histogram.end());
+        return histogram;
+    }
+
+    // Number of distinct values in the matrix
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 2, columnMajor>::uniqueValueCount() {
+        return IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }).size();
+    }
+
+    // Average redundancy of the vectors from their number of unique values
+    template <typename T, typename indexT, bool columnMajor>
+    inline double SparseMatrix<T, indexT, 2, columnMajor>::redundancy() {
+        return IVSparse::averageRedundancy(outerDim, [this](uint64_t i, uint64_t& unique, uint64_t& nnz) {
+            unique = valueOffsets[i + 1] - valueOffsets[i];
+            nnz = indexOffsets[i + 1] - indexOffsets[i];
+        });
+    }
+
+    // Shannon entropy of the values
+    template <typename T, typename indexT, bool columnMajor>
+    inline double SparseMatrix<T, indexT, 2, columnMajor>::entropy() {
+        return IVSparse::valueEntropy(IVSparse::valueCounts<T>(outerDim, [this](uint64_t i) { return valueHistogram(i); }));
+    }
+}  // namespace IVSparse
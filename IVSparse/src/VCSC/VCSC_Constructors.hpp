@@ -19,78 +19,34 @@ namespace IVSparse {
             delete[] metadata;
         }
 
-        // delete the values
-        if (values != nullptr) {
-            for (size_t i = 0; i < outerDim; i++) {
-                if (values[i] != nullptr) {
-                    free(values[i]);
-                }
-            }
-            free(values);
-        }
-        if (counts != nullptr) {
-            for (size_t i = 0; i < outerDim; i++) {
-                if (counts[i] != nullptr) {
-                    free(counts[i]);
-                }
-            }
-            free(counts);
-        }
-        if (indices != nullptr) {
-            for (size_t i = 0; i < outerDim; i++) {
-                if (indices[i] != nullptr) {
-                    free(indices[i]);
-                }
-            }
-            free(indices);
-        }
-
-        if (valueSizes != nullptr) {
-            free(valueSizes);
-        }
-        if (indexSizes != nullptr) {
-            free(indexSizes);
-        }
+        // free the contiguous arrays
+        freeData();
     }
 
     // Eigen Constructor
     template <typename T, typename indexT, bool columnMajor>
-    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T>& mat) {
-        // make sure the matrix is compressed
-        mat.makeCompressed();
-
-        // get the number of rows and columns
-        numRows = mat.rows();
-        numCols = mat.cols();
-
-        outerDim = columnMajor ? numCols : numRows;
-        innerDim = columnMajor ? numRows : numCols;
-
-        // get the number of non-zero elements
-        nnz = mat.nonZeros();
-
-        // call the compression function
-        compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr());
+    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T>& mat) {
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
     }
 
     // Eigen Row Major Constructor
     template <typename T, typename indexT, bool columnMajor>
-    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(Eigen::SparseMatrix<T, Eigen::RowMajor>& mat) {
-        // make sure the matrix is compressed
-        mat.makeCompressed();
-
-        // get the number of rows and columns
-        numRows = mat.rows();
-        numCols = mat.cols();
-
-        outerDim = numRows;
-        innerDim = numCols;
+    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat) {
+        // compress the matrix in the storage order of the matrix
+        compressEigen(mat);
+    }
 
-        // get the number of non-zero elements
-        nnz = mat.nonZeros();
+    // Eigen Dense Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1>& mat, T epsilon) {
+        compressDense(mat, epsilon);
+    }
 
-        // call the compression function
-        compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr());
+    // Eigen Dense Row Major Constructor
+    template <typename T, typename indexT, bool columnMajor>
+    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(Eigen::Matrix<T, -1, -1, Eigen::RowMajor>& mat, T epsilon) {
+        compressDense(mat, epsilon);
     }
 
     // Deep Copy Constructor
@@ -135,7 +91,7 @@ namespace IVSparse {
     template <typename T, typename indexT, bool columnMajor>
     template <typename T2, typename indexT2>
     SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(
-        T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint32_t num_rows, uint32_t num_cols, uint32_t nnz) {
+        T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
 
         #ifdef IVSPARSE_DEBUG
         assert(num_rows > 0 && num_cols > 0 && nnz > 0 &&
@@ -166,7 +122,7 @@ namespace IVSparse {
     template <typename T, typename indexT, bool columnMajor>
     template <typename T2, typename indexT2>
     SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(
-        std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint32_t num_cols, uint32_t nnz) {
+        std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint64_t num_cols, uint64_t nnz) {
 
         #ifdef IVSPARSE_DEBUG
         assert(num_rows > 0 && num_cols > 0 && nnz > 0 &&
@@ -191,123 +147,34 @@ namespace IVSparse {
         numRows = num_rows;
         numCols = num_cols;
         this->nnz = nnz;
-        encodeValueType();
-        index_t = sizeof(indexT);
 
-        metadata = new uint32_t[NUM_META_DATA];
-        metadata[0] = 2;
-        metadata[1] = innerDim;
-        metadata[2] = outerDim;
-        metadata[3] = nnz;
-        metadata[4] = val_t;
-        metadata[5] = index_t;
-
-        // allocate the vectors
-        try {
-            values = (T**)malloc(sizeof(T*) * outerDim);
-            counts = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            indices = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            valueSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-            indexSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-        }
-        catch (std::bad_alloc& ba) {
-            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-            throw std::runtime_error("Error: Could not allocate memory");
-        }
-
-        // sort the tuples by first by column then by row
+        // sort the tuples by outer then inner index
         std::sort(entries.begin(), entries.end(),
                   [](const std::tuple<indexT2, indexT2, T2>& a,
                      const std::tuple<indexT2, indexT2, T2>& b) {
-                         if (std::get<1>(a) == std::get<1>(b)) {
-                             return std::get<0>(a) < std::get<0>(b);
+                         indexT2 outerA = columnMajor ? std::get<1>(a) : std::get<0>(a);
+                         indexT2 outerB = columnMajor ? std::get<1>(b) : std::get<0>(b);
+                         if (outerA == outerB) {
+                             return (columnMajor ? std::get<0>(a) : std::get<1>(a)) < (columnMajor ? std::get<0>(b) : std::get<1>(b));
                          }
                          else {
-                             return std::get<1>(a) < std::get<1>(b);
+                             return outerA < outerB;
                          }
                   });
 
-        std::map<T2, std::vector<indexT2>> maps[outerDim];
+        // lay the tuples out as CSC so they can be compressed like any other matrix
+        std::vector<T2> vals(nnz);
+        std::vector<uint64_t> innerIndices(nnz);
+        std::vector<uint64_t> outerPointers(outerDim + 1, 0);
 
-        // loop through the tuples
         for (size_t i = 0; i < nnz; i++) {
-            // get the column
-            indexT2 row = std::get<0>(entries[i]);
-            indexT2 col = std::get<1>(entries[i]);
-            T2 val = std::get<2>(entries[i]);
-
-            // check if the value is already in the map
-            if (maps[col].find(val) != maps[col].end()) {
-                // value found positive delta encode it
-                maps[col][val].push_back(row);
-            }
-            else {
-                // value not found
-                maps[col][val] = std::vector<indexT2>{ row };
-            }
-
-        }  // end of loop through tuples
-
-        // loop through the array
-        #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
-        #endif
-        for (size_t i = 0; i < outerDim; i++) {
-            // check if the column is empty
-            if (maps[i].empty()) {
-                values[i] = nullptr;
-                counts[i] = nullptr;
-                indices[i] = nullptr;
-                valueSizes[i] = 0;
-                indexSizes[i] = 0;
-                continue;
-            }
-
-            size_t performanceVecSize = 0;
-            size_t numInidces = 0;
-
-            // loop through the vectors of the map
-            for (auto& val : maps[i]) {
-                performanceVecSize++;
-                numInidces += val.second.size();
-            }
-
-            try {
-                values[i] = (T*)malloc(sizeof(T) * maps[i].size());
-                counts[i] = (indexT*)malloc(sizeof(indexT) * maps[i].size());
-                indices[i] = (indexT*)malloc(sizeof(indexT) * numInidces);
-            }
-            catch (std::bad_alloc& ba) {
-                std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-                throw std::runtime_error("Error: Could not allocate memory");
-            }
-
-            valueSizes[i] = maps[i].size();
-            indexSizes[i] = numInidces;
-
-            size_t index = 0;
-            size_t valIndex = 0;
-
-            for (auto& val : maps[i]) {
-                values[i][valIndex] = val.first;
-                counts[i][valIndex] = val.second.size();
-
-                for (auto& indexVal : val.second) {
-                    indices[i][index] = indexVal;
-                    index++;
-                }
-
-                valIndex++;
-            }
-
-        }  // end of loop through the array
-
-        // run the user checks and calculate the compression size
-        calculateCompSize();
+            vals[i] = std::get<2>(entries[i]);
+            innerIndices[i] = columnMajor ? std::get<0>(entries[i]) : std::get<1>(entries[i]);
+            outerPointers[(columnMajor ? std::get<1>(entries[i]) : std::get<0>(entries[i])) + 1]++;
+        }
+        for (uint64_t i = 0; i < outerDim; i++) { outerPointers[i + 1] += outerPointers[i]; }
 
-        #ifdef IVSPARSE_DEBUG
-        userChecks();
-        #endif
+        compressCSC(vals.data(), innerIndices.data(), outerPointers.data());
     }
 
     // IVSparse Vector Constructor
@@ -331,7 +198,7 @@ namespace IVSparse {
         encodeValueType();
         index_t = sizeof(indexT);
 
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = 2;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
@@ -339,49 +206,21 @@ namespace IVSparse {
         metadata[4] = val_t;
         metadata[5] = index_t;
 
-        // allocate the vectors
-        try {
-            values = (T**)malloc(sizeof(T*));
-            counts = (indexT**)malloc(sizeof(indexT*));
-            indices = (indexT**)malloc(sizeof(indexT*));
-            valueSizes = (indexT*)malloc(sizeof(indexT));
-            indexSizes = (indexT*)malloc(sizeof(indexT));
-        }
-        catch (std::bad_alloc& ba) {
-            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-            throw std::runtime_error("Error: Could not allocate memory");
+        // set the sizes, an empty vector has none
+        allocateOffsets();
+        if (vec.byteSize() != 0) {
+            valueOffsets[1] = vec.uniqueVals();
+            indexOffsets[1] = vec.nonZeros();
         }
+        allocateData();
 
-        // check if the vector is empty
-        if (vec.byteSize() == 0) [[unlikely]] {
-            values[0] = nullptr;
-            counts[0] = nullptr;
-            indices[0] = nullptr;
-            valueSizes[0] = 0;
-            indexSizes[0] = 0;
-            return;
-            }
-
-            // set the sizes
-        valueSizes[0] = vec.uniqueVals();
-        indexSizes[0] = vec.nonZeros();
-
-        // allocate the memory for the one vector
-        try {
-            values[0] = (T*)malloc(sizeof(T) * valueSizes[0]);
-            counts[0] = (indexT*)malloc(sizeof(indexT) * valueSizes[0]);
-            indices[0] = (indexT*)malloc(sizeof(indexT) * indexSizes[0]);
-        }
-        catch (std::bad_alloc& ba) {
-            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-            throw std::runtime_error("Error: Could not allocate memory");
+        // copy the vector
+        if (indexOffsets[1] != 0) {
+            memcpy(values, vec.getValues(), sizeof(T) * valueOffsets[1]);
+            memcpy(counts, vec.getCounts(), sizeof(indexT) * valueOffsets[1]);
+            memcpy(indices, vec.getIndices(), sizeof(indexT) * indexOffsets[1]);
         }
 
-        // copy the values
-        memcpy(values[0], vec.getValues(), sizeof(T) * valueSizes[0]);
-        memcpy(counts[0], vec.getCounts(), sizeof(indexT) * valueSizes[0]);
-        memcpy(indices[0], vec.getIndices(), sizeof(indexT) * indexSizes[0]);
-
         // run the user checks and calculate the compression size
         calculateCompSize();
         #ifdef IVSPARSE_DEBUG
@@ -393,20 +232,55 @@ namespace IVSparse {
     template <typename T, typename indexT, bool columnMajor>
     SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(std::vector<typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector>& vecs) {
 
-        // Construct a one vector matrix to append to
-        IVSparse::SparseMatrix<T, indexT, 2, columnMajor> temp(vecs[0]);
-
-        // append the rest of the vectors
+        #ifdef IVSPARSE_DEBUG
+        assert(vecs.size() > 0 && "Cannot construct a matrix from no vectors");
         for (size_t i = 1; i < vecs.size(); i++) {
-            temp.append(vecs[i]);
+            assert(vecs[i].getLength() == vecs[0].getLength() && "All vectors must be the same length");
         }
+        #endif
 
-        // copy the temp matrix to this
-        *this = temp;
+        // Get the dimensions and metadata
+        innerDim = vecs[0].getLength();
+        outerDim = vecs.size();
+        numRows = columnMajor ? innerDim : outerDim;
+        numCols = columnMajor ? outerDim : innerDim;
+
+        nnz = 0;
+        for (size_t i = 0; i < vecs.size(); i++) { nnz += vecs[i].nonZeros(); }
+
+        encodeValueType();
+        index_t = sizeof(indexT);
+
+        metadata = new uint64_t[NUM_META_DATA];
+        metadata[0] = 2;
+        metadata[1] = innerDim;
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+        metadata[4] = val_t;
+        metadata[5] = index_t;
+
+        // size the arrays once from all of the vectors
+        allocateOffsets();
+        for (uint64_t i = 0; i < outerDim; i++) {
+            valueOffsets[i + 1] = vecs[i].uniqueVals();
+            indexOffsets[i + 1] = vecs[i].nonZeros();
+        }
+        allocateData();
+
+        // then copy each vector into its slice of the arrays
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for
+        #endif
+        for (uint64_t i = 0; i < outerDim; i++) {
+            if (vecs[i].nonZeros() == 0) { continue; }
+
+            memcpy(values + valueOffsets[i], vecs[i].getValues(), sizeof(T) * vecs[i].uniqueVals());
+            memcpy(counts + valueOffsets[i], vecs[i].getCounts(), sizeof(indexT) * vecs[i].uniqueVals());
+            memcpy(indices + indexOffsets[i], vecs[i].getIndices(), sizeof(indexT) * vecs[i].nonZeros());
+        }
 
         // run the user checks and calculate the compression size
         calculateCompSize();
-
         #ifdef IVSPARSE_DEBUG
         userChecks();
         #endif
@@ -426,8 +300,8 @@ namespace IVSparse {
         #endif
 
         // read the metadata
-        metadata = new uint32_t[NUM_META_DATA];
-        if (fread(metadata, sizeof(uint32_t), NUM_META_DATA, fp) == 0) [[unlikely]] {
+        metadata = new uint64_t[NUM_META_DATA];
+        if (!IVSparse::readMetadata(fp, metadata)) [[unlikely]] {
             throw std::runtime_error("Error: Could not read metadata");
         }
 
@@ -451,73 +325,33 @@ namespace IVSparse {
         }
         #endif
 
-        // allocate the vectors
-        try {
-            values = (T**)malloc(sizeof(T*) * outerDim);
-            counts = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            indices = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            valueSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-            indexSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-        }
-        catch (std::bad_alloc& ba) {
-            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-            throw std::runtime_error("Error: Could not allocate memory");
-        }
+        // read in the value and index sizes of each vector
+        std::vector<indexT> valueSizes(outerDim);
+        std::vector<indexT> indexSizes(outerDim);
 
-        // read in the value sizes
-        for (size_t i = 0; i < outerDim; i++) {
-            if (fread(&valueSizes[i], sizeof(indexT), 1, fp) == 0) [[unlikely]] {
-                throw std::runtime_error("Error: Could not read valueSizes");
-            }
+        if (outerDim > 0 && fread(valueSizes.data(), sizeof(indexT), outerDim, fp) != outerDim) [[unlikely]] {
+            throw std::runtime_error("Error: Could not read valueSizes");
         }
-
-        // read in the index sizes
-        for (size_t i = 0; i < outerDim; i++) {
-            if (fread(&indexSizes[i], sizeof(indexT), 1, fp) == 0) [[unlikely]] {
-                throw std::runtime_error("Error: Could not read indexSizes");
-                }
+        if (outerDim > 0 && fread(indexSizes.data(), sizeof(indexT), outerDim, fp) != outerDim) [[unlikely]] {
+            throw std::runtime_error("Error: Could not read indexSizes");
         }
 
-        // read in the values
-        for (size_t i = 0; i < outerDim; i++) {
-            try {
-                values[i] = (T*)malloc(sizeof(T) * valueSizes[i]);
-            }
-            catch (std::bad_alloc& ba) {
-                std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-                throw std::runtime_error("Error: Could not allocate memory");
-            }
-            if (fread(values[i], sizeof(T), valueSizes[i], fp) == 0) [[unlikely]] {
-                throw std::runtime_error("Error: Could not read values");
-            }
+        allocateOffsets();
+        for (uint64_t i = 0; i < outerDim; i++) {
+            valueOffsets[i + 1] = valueSizes[i];
+            indexOffsets[i + 1] = indexSizes[i];
         }
+        allocateData();
 
-        // read in the counts
-        for (size_t i = 0; i < outerDim; i++) {
-            try {
-                counts[i] = (indexT*)malloc(sizeof(indexT) * valueSizes[i]);
-            }
-            catch (std::bad_alloc& ba) {
-                std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-                throw std::runtime_error("Error: Could not allocate memory");
-            }
-            if (fread(counts[i], sizeof(indexT), valueSizes[i], fp) == 0) [[unlikely]] {
-                throw std::runtime_error("Error: Could not read counts");
-                }
+        // the values, counts and indices of all vectors are stored back to back so each is one read
+        if (fread(values, sizeof(T), valueOffsets[outerDim], fp) != valueOffsets[outerDim]) [[unlikely]] {
+            throw std::runtime_error("Error: Could not read values");
         }
-
-        // read in the indices
-        for (size_t i = 0; i < outerDim; i++) {
-            try {
-                indices[i] = (indexT*)malloc(sizeof(indexT) * indexSizes[i]);
-            }
-            catch (std::bad_alloc& ba) {
-                std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-                throw std::runtime_error("Error: Could not allocate memory");
-            }
-            if(fread(indices[i], sizeof(indexT), indexSizes[i], fp) == 0) [[unlikely]] {
-                throw std::runtime_error("Error: Could not read indices");
-            }
+        if (fread(counts, sizeof(indexT), valueOffsets[outerDim], fp) != valueOffsets[outerDim]) [[unlikely]] {
+            throw std::runtime_error("Error: Could not read counts");
+        }
+        if (fread(indices, sizeof(indexT), indexOffsets[outerDim], fp) != indexOffsets[outerDim]) [[unlikely]] {
+            throw std::runtime_error("Error: Could not read indices");
         }
 
         // close the file
@@ -536,7 +370,7 @@ namespace IVSparse {
 
     // Private Tranpose Constructor
     template <typename T, typename indexT, bool columnMajor>
-    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(std::unordered_map<T, std::vector<indexT>>* maps, uint32_t num_rows, uint32_t num_cols) {
+    SparseMatrix<T, indexT, 2, columnMajor>::SparseMatrix(std::vector<uint64_t>& offsets, std::vector<std::pair<T, indexT>>& entries, uint64_t num_rows, uint64_t num_cols) {
 
         // set class variables
         if constexpr (columnMajor) {
@@ -553,76 +387,30 @@ namespace IVSparse {
         encodeValueType();
         index_t = sizeof(indexT);
 
-        // allocate the vectors
-        try {
-            values = (T**)malloc(sizeof(T*) * outerDim);
-            counts = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            indices = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            valueSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-            indexSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-        }
-        catch (std::bad_alloc& ba) {
-            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-            throw std::runtime_error("Error: Could not allocate memory");
+        // size each vector from its sorted entries, equal values are already contiguous
+        allocateOffsets();
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            valueOffsets[i + 1] = countRuns(entries.data() + offsets[i], entries.data() + offsets[i + 1]);
+            indexOffsets[i + 1] = offsets[i + 1] - offsets[i];
         }
+        allocateData();
 
-        // loop through the array
+        // write the vectors in parallel
         #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic, 64)
         #endif
-        for (size_t i = 0; i < outerDim; i++) {
-            // check if the column is empty
-            if (maps[i].empty()) [[unlikely]] {
-                values[i] = nullptr;
-                counts[i] = nullptr;
-                indices[i] = nullptr;
-                valueSizes[i] = 0;
-                indexSizes[i] = 0;
-                continue;
-                }
-            size_t byteSize = 0;
-            size_t numInidces = 0;
-
-            // loop through the vectors of the map
-            for (auto& val : maps[i]) {
-                // add the size of the vector to the byteSize
-                byteSize += (sizeof(indexT) * val.second.size());
-
-                // add the size of the vector to the numIndices
-                numInidces += val.second.size();
-            }
-
-            try {
-                values[i] = (T*)malloc(sizeof(T) * maps[i].size());
-                counts[i] = (indexT*)malloc(sizeof(indexT) * maps[i].size());
-                indices[i] = (indexT*)malloc(sizeof(indexT) * numInidces);
-            }
-            catch (std::bad_alloc& ba) {
-                std::cerr << "bad_alloc caught: " << ba.what() << '\n';
-                throw std::runtime_error("Error: Could not allocate memory");
-            }
-
-            valueSizes[i] = maps[i].size();
-            indexSizes[i] = numInidces;
-            nnz += numInidces;
-
-            size_t index = 0;
-            size_t valIndex = 0;
-
-            for (auto& val : maps[i]) {
-                values[i][valIndex] = val.first;
-                counts[i][valIndex] = val.second.size();
-
-                memcpy(&indices[i][index], val.second.data(), sizeof(indexT) * val.second.size());
-                index += val.second.size();
-
-                valIndex++;
-            }
-
-        }  // end of loop through the array
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            compressVector(i, entries.data() + offsets[i], entries.data() + offsets[i + 1]);
+        }
+
+        nnz = indexOffsets[outerDim];
 
         // set the metadata
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = 2;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
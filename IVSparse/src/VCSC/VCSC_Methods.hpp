@@ -14,10 +14,41 @@ namespace IVSparse {
 
     // Gets the element stored at the given row and column
     template <typename T, typename indexT, bool columnMajor>
-    T SparseMatrix<T, indexT, 2, columnMajor>::coeff(uint32_t row, uint32_t col) {
+    T SparseMatrix<T, indexT, 2, columnMajor>::coeff(uint64_t row, uint64_t col) {
         return (*this)(row, col);
     }
 
+    // Gets the values at many (row, col) pairs
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::gather(const uint64_t* rows, const uint64_t* cols, T* out, size_t n) {
+        const uint64_t* outer = columnMajor ? cols : rows;
+        const uint64_t* inner = columnMajor ? rows : cols;
+
+        // search the lookup table when one is kept, otherwise decode each vector once
+        IVSparse::gatherGrouped<T>(outerDim, innerDim, outer, inner, out, n, !lookupIndices.empty(),
+            [this](uint64_t vec, auto&& visit) {
+                indexT* index = indices + indexOffsets[vec];
+                for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+                    for (indexT k = 0; k < counts[j]; k++) {
+                        visit(*index++, values[j]);
+                    }
+                }
+            },
+            [this](uint64_t vec, uint64_t index) { return lookupCoeff(vec, index); });
+    }
+
+    // Gets the values at many (row, col) pairs
+    template <typename T, typename indexT, bool columnMajor>
+    std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::gather(const std::vector<uint64_t>& rows, const std::vector<uint64_t>& cols) {
+        #ifdef IVSPARSE_DEBUG
+        assert(rows.size() == cols.size() && "Rows and columns must be the same length!");
+        #endif
+
+        std::vector<T> out(rows.size());
+        gather(rows.data(), cols.data(), out.data(), rows.size());
+        return out;
+    }
+
     // Check for Column Major
     template <typename T, typename indexT, bool columnMajor>
     bool SparseMatrix<T, indexT, 2, columnMajor>::isColumnMajor() const {
@@ -26,50 +57,57 @@ namespace IVSparse {
 
     // get the values vector
     template <typename T, typename indexT, bool columnMajor>
-    T* SparseMatrix<T, indexT, 2, columnMajor>::getValues(uint32_t vec) const {
-        return values[vec];
+    T* SparseMatrix<T, indexT, 2, columnMajor>::getValues(uint64_t vec) const {
+        return values + valueOffsets[vec];
     }
 
     // get the counts vector
     template <typename T, typename indexT, bool columnMajor>
-    indexT* SparseMatrix<T, indexT, 2, columnMajor>::getCounts(uint32_t vec) const {
-        return counts[vec];
+    indexT* SparseMatrix<T, indexT, 2, columnMajor>::getCounts(uint64_t vec) const {
+        return counts + valueOffsets[vec];
     }
 
     // get the indices vector
     template <typename T, typename indexT, bool columnMajor>
     indexT* SparseMatrix<T, indexT, 2, columnMajor>::getIndices(
-        uint32_t vec) const {
-        return indices[vec];
+        uint64_t vec) const {
+        return indices + indexOffsets[vec];
     }
 
     // get the number of unique values in a vector
     template <typename T, typename indexT, bool columnMajor>
     indexT SparseMatrix<T, indexT, 2, columnMajor>::getNumUniqueVals(
-        uint32_t vec) const {
-        if (valueSizes == nullptr) {
+        uint64_t vec) const {
+        if (valueOffsets == nullptr) {
             return 0;
         }
-        return valueSizes[vec];
+        return valueOffsets[vec + 1] - valueOffsets[vec];
     }
 
     // get the number of indices in a vector
     template <typename T, typename indexT, bool columnMajor>
     indexT SparseMatrix<T, indexT, 2, columnMajor>::getNumIndices(
-        uint32_t vec) const {
-        if (indexSizes == nullptr) {
+        uint64_t vec) const {
+        if (indexOffsets == nullptr) {
             return 0;
         }
-        return indexSizes[vec];
+        return indexOffsets[vec + 1] - indexOffsets[vec];
     }
 
     // get the vector at the given index
     template <typename T, typename indexT, bool columnMajor>
     typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector
-        SparseMatrix<T, indexT, 2, columnMajor>::getVector(uint32_t vec) {
+        SparseMatrix<T, indexT, 2, columnMajor>::getVector(uint64_t vec) {
         return (*this)[vec];
     }
 
+    // get a view of the vector at the given index
+    template <typename T, typename indexT, bool columnMajor>
+    typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::VectorView
+        SparseMatrix<T, indexT, 2, columnMajor>::getVectorView(uint64_t vec) {
+        return typename SparseMatrix<T, indexT, 2, columnMajor>::VectorView(*this, vec);
+    }
+
     //* Utility Methods *//
 
     // Writes the matrix to file
@@ -79,30 +117,22 @@ namespace IVSparse {
         FILE* fp = fopen(filename, "wb+");
 
         // Write the metadata
-        fwrite(metadata, 1, NUM_META_DATA * sizeof(uint32_t), fp);
+        IVSparse::writeMetadata(fp, metadata);
 
         // write the lengths of the vectors
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            fwrite(&valueSizes[i], 1, sizeof(indexT), fp);
-        }
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            fwrite(&indexSizes[i], 1, sizeof(indexT), fp);
-        }
-
-        // write the values
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            fwrite(values[i], 1, valueSizes[i] * sizeof(T), fp);
+        std::vector<indexT> valueSizes(outerDim);
+        std::vector<indexT> indexSizes(outerDim);
+        for (uint64_t i = 0; i < outerDim; ++i) {
+            valueSizes[i] = valueOffsets[i + 1] - valueOffsets[i];
+            indexSizes[i] = indexOffsets[i + 1] - indexOffsets[i];
         }
+        fwrite(valueSizes.data(), 1, outerDim * sizeof(indexT), fp);
+        fwrite(indexSizes.data(), 1, outerDim * sizeof(indexT), fp);
 
-        // write the counts
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            fwrite(counts[i], 1, valueSizes[i] * sizeof(indexT), fp);
-        }
-
-        // write the indices
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            fwrite(indices[i], 1, indexSizes[i] * sizeof(indexT), fp);
-        }
+        // the values, counts and indices are already laid out back to back
+        fwrite(values, 1, valueOffsets[outerDim] * sizeof(T), fp);
+        fwrite(counts, 1, valueOffsets[outerDim] * sizeof(indexT), fp);
+        fwrite(indices, 1, indexOffsets[outerDim] * sizeof(indexT), fp);
 
         // close the file
         fclose(fp);
@@ -111,30 +141,41 @@ namespace IVSparse {
     // Prints the matrix dense to console
     template <typename T, typename indexT, bool columnMajor>
     void SparseMatrix<T, indexT, 2, columnMajor>::print() {
-        std::cout << std::endl;
-        std::cout << "IVSparse Matrix" << std::endl;
-
-        // if the matrix is less than 100 rows and columns print the whole thing
-        if (numRows < 100 && numCols < 100) {
-            // print the matrix
-            for (uint32_t i = 0; i < numRows; i++) {
-                for (uint32_t j = 0; j < numCols; j++) {
-                    std::cout << coeff(i, j) << " ";
-                }
-                std::cout << std::endl;
-            }
-        }
-        else if (numRows > 100 && numCols > 100) {
-            // print the first 100 rows and columns
-            for (uint32_t i = 0; i < 100; i++) {
-                for (uint32_t j = 0; j < 100; j++) {
-                    std::cout << coeff(i, j) << " ";
-                }
-                std::cout << std::endl;
-            }
+        print(std::cout);
+    }
+
+    // Builds the random access lookup table
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::buildLookupTable(bool lazy) {
+        lookupIndices.resize(outerDim);
+        lookupRuns.resize(outerDim);
+
+        if (lazy) return;
+
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            if (lookupIndices[i].empty()) { buildLookup(i); }
         }
+    }
 
-        std::cout << std::endl;
+    // Frees the random access lookup table
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::dropLookupTable() {
+        std::vector<std::vector<indexT>>().swap(lookupIndices);
+        std::vector<std::vector<indexT>>().swap(lookupRuns);
+    }
+
+    // Gets the byte size of the random access lookup table
+    template <typename T, typename indexT, bool columnMajor>
+    size_t SparseMatrix<T, indexT, 2, columnMajor>::lookupTableSize() const {
+        size_t size = lookupIndices.capacity() * sizeof(std::vector<indexT>) + lookupRuns.capacity() * sizeof(std::vector<indexT>);
+
+        for (size_t i = 0; i < lookupIndices.size(); i++) {
+            size += lookupIndices[i].capacity() * sizeof(indexT) + lookupRuns[i].capacity() * sizeof(indexT);
+        }
+        return size;
     }
 
     // Convert a IVCSC matrix to CSC
@@ -145,7 +186,7 @@ namespace IVSparse {
             eigenMatrix(numRows, numCols);
 
         // iterate over the matrix
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it;
                  ++it) {
                 // add the value to the matrix
@@ -177,7 +218,7 @@ namespace IVSparse {
         std::map<indexT, T> dict[outerDim];
 
         // iterate through the data using the iterator
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             size_t count = 0;
 
             for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it; ++it) {
@@ -189,7 +230,7 @@ namespace IVSparse {
         size_t count = 0;
 
         // loop through the dictionary and populate values and indices
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             for (auto& pair : dict[i]) {
                 values[count] = pair.second;
                 indices[count] = pair.first;
@@ -221,7 +262,7 @@ namespace IVSparse {
         Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> eigenMatrix(numRows, numCols);
 
         // iterate over the matrix
-        for (uint32_t i = 0; i < outerDim; ++i) {
+        for (uint64_t i = 0; i < outerDim; ++i) {
             for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it; ++it) {
                 // add the value to the matrix
                 eigenMatrix.insert(it.row(), it.col()) = it.value();
@@ -248,9 +289,18 @@ namespace IVSparse {
                "matrix!");
         #endif
 
-        uint32_t oldOuterDim = outerDim;
+        // sizes of the other matrix are taken first as it may be this matrix
+        uint64_t oldOuterDim = outerDim;
+        uint64_t appendedDim = mat.outerDim;
+        uint64_t appendedValues = mat.valueOffsets[appendedDim];
+        uint64_t appendedIndices = mat.indexOffsets[appendedDim];
+        uint64_t oldValues = valueOffsets[oldOuterDim];
+        uint64_t oldIndices = indexOffsets[oldOuterDim];
 
-        outerDim += mat.outerSize();
+        // grow the arrays geometrically, the new data goes on the end of each
+        growData(oldOuterDim + appendedDim, oldValues + appendedValues, oldIndices + appendedIndices);
+
+        outerDim += appendedDim;
         nnz += mat.nonZeros();
 
         if constexpr (columnMajor) {
@@ -264,44 +314,43 @@ namespace IVSparse {
         metadata[2] = outerDim;
         metadata[3] = nnz;
 
-        // realloc the vectors
+        // copy the data of the other matrix in one block per array
+        memcpy(values + oldValues, mat.values, appendedValues * sizeof(T));
+        memcpy(counts + oldValues, mat.counts, appendedValues * sizeof(indexT));
+        memcpy(indices + oldIndices, mat.indices, appendedIndices * sizeof(indexT));
+
+        // shift the offsets of the other matrix past the existing data
+        for (uint64_t i = 1; i <= appendedDim; ++i) {
+            valueOffsets[oldOuterDim + i] = oldValues + mat.valueOffsets[i];
+            indexOffsets[oldOuterDim + i] = oldIndices + mat.indexOffsets[i];
+        }
+
+        // update the compressed size
+        calculateCompSize();
+
+        // new vectors are added to the lookup table the first time they are read
+        if (!lookupIndices.empty()) {
+            lookupIndices.resize(outerDim);
+            lookupRuns.resize(outerDim);
+        }
+    }  // end append
+
+    // reserves room for n vectors along the outer dimension
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::reserveOuter(uint64_t n) {
+        if (n <= std::max(outerCapacity, outerDim)) { return; }
+
         try {
-            values = (T**)realloc(values, outerDim * sizeof(T*));
-            counts = (indexT**)realloc(counts, outerDim * sizeof(indexT*));
-            indices = (indexT**)realloc(indices, outerDim * sizeof(indexT*));
-            valueSizes = (indexT*)realloc(valueSizes, outerDim * sizeof(indexT));
-            indexSizes = (indexT*)realloc(indexSizes, outerDim * sizeof(indexT));
+            valueOffsets = (uint64_t*)realloc(valueOffsets, (n + 1) * sizeof(uint64_t));
+            indexOffsets = (uint64_t*)realloc(indexOffsets, (n + 1) * sizeof(uint64_t));
         }
         catch (std::bad_alloc& e) {
             std::cerr << "Error: " << e.what() << std::endl;
             exit(1);
         }
 
-        // copy the data from the vector to the new vectors
-        for (uint32_t i = 0; i < outerDim - oldOuterDim; ++i) {
-            valueSizes[oldOuterDim + i] = mat.getNumUniqueVals(i);
-            indexSizes[oldOuterDim + i] = mat.getNumIndices(i);
-
-            // allocate the new vectors
-            try {
-                values[oldOuterDim + i]  = (T*)     malloc(valueSizes[oldOuterDim + i] * sizeof(T));
-                counts[oldOuterDim + i]  = (indexT*)malloc(valueSizes[oldOuterDim + i] * sizeof(indexT));
-                indices[oldOuterDim + i] = (indexT*)malloc(indexSizes[oldOuterDim + i] * sizeof(indexT));
-            }
-            catch (std::bad_alloc& e) {
-                std::cerr << "Error: " << e.what() << std::endl;
-                exit(1);
-            }
-
-            // copy the data from the vector to the new vectors
-            memcpy(values[oldOuterDim + i],  mat.getValues(i),  mat.valueSizes[i] * sizeof(T));
-            memcpy(counts[oldOuterDim + i],  mat.getCounts(i),  mat.valueSizes[i] * sizeof(indexT));
-            memcpy(indices[oldOuterDim + i], mat.getIndices(i), mat.indexSizes[i] * sizeof(indexT));
-        }
-
-        // update the compressed size
-        calculateCompSize();
-    }  // end append
+        outerCapacity = n;
+    }
 
     // Eigen -> IVSparse append
     template<typename T, typename indexT, bool columnMajor>
@@ -313,62 +362,34 @@ namespace IVSparse {
     // tranposes the ivsparse matrix
     template <typename T, typename indexT, bool columnMajor>
     IVSparse::SparseMatrix<T, indexT, 2, columnMajor> SparseMatrix<T, indexT, 2, columnMajor>::transpose() {
-        // make a data structure to store the tranpose
-        // std::unordered_map<T, std::vector<indexT>> mapsT[innerDim];
-        std::vector<std::unordered_map<T, std::vector<indexT>>> mapsT(innerDim);
-        mapsT.resize(innerDim);
 
-        // populate the transpose data structure
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it;
-                 ++it) {
-                // add the value to the map
-                if constexpr (columnMajor) {
-                    mapsT[it.row()][it.value()].push_back(it.col());
+        // counting sort the entries into the vectors of the transpose
+        std::vector<uint64_t> offsets;
+        std::vector<std::pair<T, indexT>> entries;
+        IVSparse::transposeEntries<T, indexT>(outerDim, innerDim, nnz,
+            [this](uint64_t vec, auto&& visit) {
+                indexT* index = indices + indexOffsets[vec];
+                for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+                    for (indexT k = 0; k < counts[j]; k++) {
+                        visit(*index++, values[j]);
+                    }
                 }
-                else {
-                    mapsT[it.col()][it.value()].push_back(it.row());
-                }
-            }
-        }
-
-        // create a new matrix passing in transposedMap
-        IVSparse::SparseMatrix<T, indexT, 2, columnMajor> temp(mapsT.data(), numRows, numCols);
+            },
+            offsets, entries);
 
-        // return the new matrix
-        return temp;
+        // create a new matrix from the sorted entries
+        return IVSparse::SparseMatrix<T, indexT, 2, columnMajor>(offsets, entries, numRows, numCols);
     }
 
     // Transpose In Place Method
     template <typename T, typename indexT, bool columnMajor>
     void SparseMatrix<T, indexT, 2, columnMajor>::inPlaceTranspose() {
-        // make a data structure to store the tranpose
-        // std::unordered_map<T, std::vector<indexT>> mapsT[innerDim];
-        std::vector<std::unordered_map<T, std::vector<indexT>>> mapsT(innerDim);
-        mapsT.resize(innerDim);
-
-
-        // populate the transpose data structure
-        for (uint32_t i = 0; i < outerDim; ++i) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it;
-                 ++it) {
-                // add the value to the map
-                if constexpr (columnMajor) {
-                    mapsT[it.row()][it.value()].push_back(it.col());
-                }
-                else {
-                    mapsT[it.col()][it.value()].push_back(it.row());
-                }
-            }
-        }
-
-        // set this to the transposed matrix
-        *this = IVSparse::SparseMatrix<T, indexT, 2, columnMajor>(mapsT.data(), numRows, numCols);
+        *this = transpose();
     }
 
     // slice method that returns a vector of IVSparse vectors
     template <typename T, typename indexT, bool columnMajor>
-    IVSparse::SparseMatrix<T, indexT, 2, columnMajor> SparseMatrix<T, indexT, 2, columnMajor>::slice(uint32_t start, uint32_t end) {
+    IVSparse::SparseMatrix<T, indexT, 2, columnMajor> SparseMatrix<T, indexT, 2, columnMajor>::slice(uint64_t start, uint64_t end) {
 
         #ifdef IVSPARSE_DEBUG
         assert(start < outerDim && end <= outerDim && start < end &&
@@ -380,49 +401,35 @@ namespace IVSparse {
 
         temp.innerDim = innerDim;
         temp.outerDim = end - start;
-        temp.numRows = numRows;
-        temp.numCols = temp.outerDim;
+        temp.numRows = columnMajor ? numRows : temp.outerDim;
+        temp.numCols = columnMajor ? temp.outerDim : numCols;
+
+        // the sliced vectors are one contiguous block of each array
+        temp.allocateOffsets();
+        for (uint64_t i = 0; i <= end - start; i++) {
+            temp.valueOffsets[i] = valueOffsets[i + start] - valueOffsets[start];
+            temp.indexOffsets[i] = indexOffsets[i + start] - indexOffsets[start];
+        }
 
-        // malloc the vectors
         try {
-            temp.values = (T**)malloc((end - start) * sizeof(T*));
-            temp.counts = (indexT**)malloc((end - start) * sizeof(indexT*));
-            temp.indices = (indexT**)malloc((end - start) * sizeof(indexT*));
-            temp.valueSizes = (indexT*)malloc((end - start) * sizeof(indexT));
-            temp.indexSizes = (indexT*)malloc((end - start) * sizeof(indexT));
+            temp.values = (T*)malloc(temp.valueOffsets[temp.outerDim] * sizeof(T));
+            temp.counts = (indexT*)malloc(temp.valueOffsets[temp.outerDim] * sizeof(indexT));
+            temp.indices = (indexT*)malloc(temp.indexOffsets[temp.outerDim] * sizeof(indexT));
         }
         catch (std::bad_alloc& e) {
             std::cerr << "Error: " << e.what() << std::endl;
             exit(1);
         }
 
-        // copy the data from the vector to the new vectors
-        for (int i = 0; i < end - start; i++) {
-
-            temp.valueSizes[i] = valueSizes[i + start];
-            temp.indexSizes[i] = indexSizes[i + start];
-
-            // allocate the new vectors
-            try {
-                temp.values[i] = (T*)malloc(valueSizes[i + start] * sizeof(T));
-                temp.counts[i] = (indexT*)malloc(sizeof(indexT) * valueSizes[i + start]);
-                temp.indices[i] = (indexT*)malloc(indexSizes[i + start] * sizeof(indexT));
-            }
-            catch (std::bad_alloc& e) {
-                std::cerr << "Error: " << e.what() << std::endl;
-                exit(1);
-            }
-
-            // copy the data from the vector to the new vectors
-            memcpy(temp.values[i], values[i + start], valueSizes[i + start] * sizeof(T));
-            memcpy(temp.counts[i], counts[i + start], valueSizes[i + start] * sizeof(indexT));
-            memcpy(temp.indices[i], indices[i + start], indexSizes[i + start] * sizeof(indexT));
+        memcpy(temp.values, values + valueOffsets[start], temp.valueOffsets[temp.outerDim] * sizeof(T));
+        memcpy(temp.counts, counts + valueOffsets[start], temp.valueOffsets[temp.outerDim] * sizeof(indexT));
+        memcpy(temp.indices, indices + indexOffsets[start], temp.indexOffsets[temp.outerDim] * sizeof(indexT));
 
-            temp.nnz += temp.valueSizes[i] * temp.indexSizes[i];
-
-        }
+        temp.nnz = temp.indexOffsets[temp.outerDim];
+        temp.val_t = val_t;
+        temp.index_t = index_t;
 
-        temp.metadata = new uint32_t[NUM_META_DATA];
+        temp.metadata = new uint64_t[NUM_META_DATA];
         temp.metadata[0] = 2;
         temp.metadata[1] = temp.innerDim;
         temp.metadata[2] = temp.outerDim;
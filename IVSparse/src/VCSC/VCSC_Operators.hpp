@@ -15,32 +15,11 @@ namespace IVSparse {
     SparseMatrix<T, indexT, 2, columnMajor>& SparseMatrix<T, indexT, 2, columnMajor>::operator=(const IVSparse::SparseMatrix<T, indexT, 2, columnMajor>& other) {
         // check if the matrices are the same
         if (this != &other) {
+            // the lookup table is not copied
+            dropLookupTable();
+
             // free the old data
-            if (values != nullptr) {
-                for (uint32_t i = 0; i < outerDim; i++) {
-                    if (values[i] != nullptr) free(values[i]);
-                }
-                free(values);
-            }
-            if (counts != nullptr) {
-                for (uint32_t i = 0; i < outerDim; i++) {
-                    if (counts[i] != nullptr) free(counts[i]);
-                }
-                free(counts);
-            }
-            if (indices != nullptr) {
-                for (uint32_t i = 0; i < outerDim; i++) {
-                    if (indices[i] != nullptr) free(indices[i]);
-                }
-                free(indices);
-            }
-            // free the metadata and size arrays
-            if (valueSizes != nullptr) {
-                free(valueSizes);
-            }
-            if (indexSizes != nullptr) {
-                free(indexSizes);
-            }
+            freeData();
             if (metadata != nullptr) {
                 delete[] metadata;
             }
@@ -55,14 +34,7 @@ namespace IVSparse {
 
             // allocate the memory
             try {
-                values = (T**)malloc(outerDim * sizeof(T*));
-                counts = (indexT**)malloc(outerDim * sizeof(indexT*));
-                indices = (indexT**)malloc(outerDim * sizeof(indexT*));
-
-                valueSizes = (indexT*)malloc(outerDim * sizeof(indexT));
-                indexSizes = (indexT*)malloc(outerDim * sizeof(indexT));
-
-                metadata = new uint32_t[NUM_META_DATA];
+                metadata = new uint64_t[NUM_META_DATA];
             }
             catch (std::bad_alloc& e) {
                 std::cerr << "Error: Could not allocate memory for IVSparse matrix"
@@ -71,18 +43,22 @@ namespace IVSparse {
             }
 
             // copy the metadata
-            memcpy(metadata, other.metadata, sizeof(uint32_t) * NUM_META_DATA);
+            memcpy(metadata, other.metadata, sizeof(uint64_t) * NUM_META_DATA);
 
             // set the index and value types
             encodeValueType();
             index_t = other.index_t;
 
-            // copy the data
-            for (uint32_t i = 0; i < outerDim; i++) {
+            // copy the offsets and then the data, one block per array
+            if (other.valueOffsets != nullptr) {
+                allocateOffsets();
+                memcpy(valueOffsets, other.valueOffsets, sizeof(uint64_t) * (outerDim + 1));
+                memcpy(indexOffsets, other.indexOffsets, sizeof(uint64_t) * (outerDim + 1));
+
                 try {
-                    values[i] = (T*)malloc(other.valueSizes[i] * sizeof(T));
-                    counts[i] = (indexT*)malloc(other.valueSizes[i] * sizeof(indexT));
-                    indices[i] = (indexT*)malloc(other.indexSizes[i] * sizeof(indexT));
+                    values = (T*)malloc(sizeof(T) * valueOffsets[outerDim]);
+                    counts = (indexT*)malloc(sizeof(indexT) * valueOffsets[outerDim]);
+                    indices = (indexT*)malloc(sizeof(indexT) * indexOffsets[outerDim]);
                 }
                 catch (std::bad_alloc& e) {
                     std::cerr << "Error: Could not allocate memory for IVSparse matrix"
@@ -90,14 +66,9 @@ namespace IVSparse {
                     exit(1);
                 }
 
-                // copy the data
-                memcpy(values[i], other.values[i], sizeof(T) * other.valueSizes[i]);
-                memcpy(counts[i], other.counts[i], sizeof(indexT) * other.valueSizes[i]);
-                memcpy(indices[i], other.indices[i],
-                       sizeof(indexT) * other.indexSizes[i]);
-
-                valueSizes[i] = other.valueSizes[i];
-                indexSizes[i] = other.indexSizes[i];
+                memcpy(values, other.values, sizeof(T) * valueOffsets[outerDim]);
+                memcpy(counts, other.counts, sizeof(indexT) * valueOffsets[outerDim]);
+                memcpy(indices, other.indices, sizeof(indexT) * indexOffsets[outerDim]);
             }
         }
 
@@ -110,31 +81,29 @@ namespace IVSparse {
     template <typename T, typename indexT, bool columnMajor>
     bool SparseMatrix<T, indexT, 2, columnMajor>::operator==(const SparseMatrix<T, indexT, 2, columnMajor>& other) const {
         // first check the metadata using memcompare
-        if (memcmp(metadata, other.metadata, sizeof(uint32_t) * NUM_META_DATA) != 0) {
+        if (memcmp(metadata, other.metadata, sizeof(uint64_t) * NUM_META_DATA) != 0) {
+            return false;
+        }
+
+        // check the offsets, after which each array can be compared in one go
+        if (memcmp(valueOffsets, other.valueOffsets, sizeof(uint64_t) * (outerDim + 1)) != 0 ||
+            memcmp(indexOffsets, other.indexOffsets, sizeof(uint64_t) * (outerDim + 1)) != 0) {
             return false;
         }
 
         // check the value array
-        for (uint32_t i = 0; i < outerDim; i++) {
-            if (memcmp(values[i], other.values[i], sizeof(T) * valueSizes[i]) != 0) {
-                return false;
-            }
+        if (memcmp(values, other.values, sizeof(T) * valueOffsets[outerDim]) != 0) {
+            return false;
         }
 
         // check the index array
-        for (uint32_t i = 0; i < outerDim; i++) {
-            if (memcmp(indices[i], other.indices[i], sizeof(indexT) * indexSizes[i]) !=
-                0) {
-                return false;
-            }
+        if (memcmp(indices, other.indices, sizeof(indexT) * indexOffsets[outerDim]) != 0) {
+            return false;
         }
 
         // check the count array
-        for (uint32_t i = 0; i < outerDim; i++) {
-            if (memcmp(counts[i], other.counts[i], sizeof(indexT) * valueSizes[i]) !=
-                0) {
-                return false;
-            }
+        if (memcmp(counts, other.counts, sizeof(indexT) * valueOffsets[outerDim]) != 0) {
+            return false;
         }
 
         // if all of the above checks pass then the matrices are equal
@@ -149,7 +118,7 @@ namespace IVSparse {
 
     // Coefficent Access Operator
     template <typename T, typename indexT, bool columnMajor>
-    T SparseMatrix<T, indexT, 2, columnMajor>::operator()(uint32_t row, uint32_t col) {
+    T SparseMatrix<T, indexT, 2, columnMajor>::operator()(uint64_t row, uint64_t col) {
         #ifdef IVSPARSE_DEBUG
         // check if the row and column are in bounds
         assert((row < numRows && row >= 0) && "Row index out of bounds");
@@ -164,8 +133,11 @@ namespace IVSparse {
         }
         #endif
 
-        uint32_t vector = columnMajor ? col : row;
-        uint32_t index = columnMajor ? row : col;
+        uint64_t vector = columnMajor ? col : row;
+        uint64_t index = columnMajor ? row : col;
+
+        // binary search the lookup table if one is being kept
+        if (!lookupIndices.empty()) { return lookupCoeff(vector, index); }
 
         // get an iterator for the desired vector
         for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(
@@ -182,7 +154,7 @@ namespace IVSparse {
 
     // Vector Access Operator
     template <typename T, typename indexT, bool columnMajor>
-    typename SparseMatrix<T, indexT, 2, columnMajor>::Vector SparseMatrix<T, indexT, 2, columnMajor>::operator[](uint32_t vec) {
+    typename SparseMatrix<T, indexT, 2, columnMajor>::Vector SparseMatrix<T, indexT, 2, columnMajor>::operator[](uint64_t vec) {
         #ifdef IVSPARSE_DEBUG
         // check if the vector is out of bounds
         assert((vec < outerDim && vec >= 0) && "Vector index out of bounds");
@@ -220,34 +192,16 @@ namespace IVSparse {
 
     // Matrix Vector Multiplication (IVSparse Eigen -> Eigen)
     template <typename T, typename indexT, bool columnMajor>
-    Eigen::Matrix<T, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::operator*(Eigen::Matrix<T, -1, 1>& vec) {
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, 1> SparseMatrix<T, indexT, 2, columnMajor>::operator*(Eigen::Matrix<accumT, -1, 1>& vec) {
         return vectorMultiply(vec);
     }
 
     // Matrix Matrix Multiplication (IVSparse Eigen -> Eigen)
     template <typename T, typename indexT, bool columnMajor>
-    Eigen::Matrix<T, -1, -1> SparseMatrix<T, indexT, 2, columnMajor>::operator* (Eigen::Matrix<T, -1, -1>& mat) {
-        #ifdef IVSPARSE_DEBUG
-        // check that the matrix is the correct size
-        if (mat.rows() != numCols)
-            throw std::invalid_argument(
-                "The left matrix must have the same # of rows as columns in the right "
-                "matrix!");
-        #endif
-
-        Eigen::Matrix<T, -1, -1> newMatrix = Eigen::Matrix<T, -1, -1>::Zero(mat.cols(), numRows);
-        Eigen::Matrix<T, -1, -1> matTranspose = mat.transpose();
-
-        // Fix Parallelism issue (race condition because of partial sums and
-        // orientation of Sparse * Dense)
-        for (uint32_t col = 0; col < numCols; col++) {
-            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator
-                 matIter(*this, col);
-                 matIter; ++matIter) {
-                newMatrix.col(matIter.row()) += matTranspose.col(col) * matIter.value();
-            }
-        }
-        return newMatrix.transpose();
+    template <typename accumT>
+    Eigen::Matrix<accumT, -1, -1> SparseMatrix<T, indexT, 2, columnMajor>::operator*(Eigen::Matrix<accumT, -1, -1>& mat) {
+        return matrixMultiply(mat);
     }
 
 }  // end namespace IVSparse
\ No newline at end of file
@@ -40,30 +40,153 @@ namespace IVSparse {
 
     }
 
+    // Allocates zeroed offset tables for outerDim vectors
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::allocateOffsets() {
+        try {
+            valueOffsets = (uint64_t*)calloc(outerDim + 1, sizeof(uint64_t));
+            indexOffsets = (uint64_t*)calloc(outerDim + 1, sizeof(uint64_t));
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for the matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Turns the vector sizes stored at offsets[i + 1] into prefix sums and allocates the data arrays
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::allocateData() {
+        for (uint64_t i = 0; i < outerDim; i++) {
+            valueOffsets[i + 1] += valueOffsets[i];
+            indexOffsets[i + 1] += indexOffsets[i];
+        }
+
+        try {
+            values = (T*)malloc(sizeof(T) * valueOffsets[outerDim]);
+            counts = (indexT*)malloc(sizeof(indexT) * valueOffsets[outerDim]);
+            indices = (indexT*)malloc(sizeof(indexT) * indexOffsets[outerDim]);
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for the matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Frees the data arrays and offset tables
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::freeData() {
+        if (values != nullptr) { free(values); }
+        if (counts != nullptr) { free(counts); }
+        if (indices != nullptr) { free(indices); }
+        if (valueOffsets != nullptr) { free(valueOffsets); }
+        if (indexOffsets != nullptr) { free(indexOffsets); }
+
+        values = nullptr;
+        counts = nullptr;
+        indices = nullptr;
+        valueOffsets = nullptr;
+        indexOffsets = nullptr;
+
+        outerCapacity = 0;
+        valueCapacity = 0;
+        indexCapacity = 0;
+    }
+
+    // Grows the arrays and offset tables geometrically to fit the given sizes
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::growData(uint64_t newOuterDim, uint64_t newValues, uint64_t newIndices) {
+        // the arrays are at least as large as the current sizes even if no capacity was set
+        uint64_t oldValues = valueOffsets == nullptr ? 0 : valueOffsets[outerDim];
+        uint64_t oldIndices = indexOffsets == nullptr ? 0 : indexOffsets[outerDim];
+
+        try {
+            if (newOuterDim > std::max(outerCapacity, outerDim)) {
+                uint64_t capacity = std::max<uint64_t>(newOuterDim, 2 * (uint64_t)std::max(outerCapacity, outerDim));
+                capacity = std::min<uint64_t>(capacity, UINT32_MAX);
+
+                valueOffsets = (uint64_t*)realloc(valueOffsets, (capacity + 1) * sizeof(uint64_t));
+                indexOffsets = (uint64_t*)realloc(indexOffsets, (capacity + 1) * sizeof(uint64_t));
+                outerCapacity = capacity;
+            }
+
+            if (newValues > std::max(valueCapacity, oldValues)) {
+                valueCapacity = std::max(newValues, 2 * std::max(valueCapacity, oldValues));
+
+                values = (T*)realloc(values, valueCapacity * sizeof(T));
+                counts = (indexT*)realloc(counts, valueCapacity * sizeof(indexT));
+            }
+
+            if (newIndices > std::max(indexCapacity, oldIndices)) {
+                indexCapacity = std::max(newIndices, 2 * std::max(indexCapacity, oldIndices));
+
+                indices = (indexT*)realloc(indices, indexCapacity * sizeof(indexT));
+            }
+        }
+        catch (std::bad_alloc& e) {
+            std::cerr << "Error: Could not allocate memory for the matrix" << std::endl;
+            exit(1);
+        }
+    }
+
+    // Builds the lookup table entries of a single vector
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::buildLookup(uint64_t vec) {
+        std::vector<std::pair<indexT, indexT>> entries;
+        entries.reserve(indexOffsets[vec + 1] - indexOffsets[vec]);
+
+        indexT* index = indices + indexOffsets[vec];
+        for (uint64_t j = valueOffsets[vec]; j < valueOffsets[vec + 1]; j++) {
+            for (indexT k = 0; k < counts[j]; k++) {
+                entries.emplace_back(*index++, j - valueOffsets[vec]);
+            }
+        }
+
+        std::sort(entries.begin(), entries.end());
+
+        lookupIndices[vec].resize(entries.size());
+        lookupRuns[vec].resize(entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            lookupIndices[vec][i] = entries[i].first;
+            lookupRuns[vec][i] = entries[i].second;
+        }
+    }
+
+    // Finds a value with the lookup table, building the vector's entries if needed
+    template <typename T, typename indexT, bool columnMajor>
+    inline T SparseMatrix<T, indexT, 2, columnMajor>::lookupCoeff(uint64_t vec, uint64_t index) {
+        if (lookupIndices[vec].empty()) { buildLookup(vec); }
+
+        auto pos = std::lower_bound(lookupIndices[vec].begin(), lookupIndices[vec].end(), (indexT)index);
+        if (pos == lookupIndices[vec].end() || *pos != (indexT)index) return 0;
+
+        return values[valueOffsets[vec] + lookupRuns[vec][pos - lookupIndices[vec].begin()]];
+    }
+
     // private ostream operator helper
     template <typename T, typename indexT, bool columnMajor>
     void SparseMatrix<T, indexT, 2, columnMajor>::print(std::ostream& os) {
         os << std::endl;
         os << "IVSparse Matrix" << std::endl;
 
-        // if the matrix is less than 100 rows and columns print the whole thing
-        if (numRows < 100 && numCols < 100) {
-            // print the matrix
-            for (uint32_t i = 0; i < numRows; i++) {
-                for (uint32_t j = 0; j < numCols; j++) {
-                    os << coeff(i, j) << " ";
+        // only the first 100 rows and columns are printed
+        uint64_t rows = std::min(numRows, (uint64_t)100);
+        uint64_t cols = std::min(numCols, (uint64_t)100);
+
+        // decode each shown vector once instead of calling coeff() for every element
+        std::vector<T> dense((size_t)rows * cols, 0);
+        for (uint32_t i = 0; i < (columnMajor ? cols : rows); i++) {
+            for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this, i); it; ++it) {
+                if ((uint64_t)it.row() < rows && (uint64_t)it.col() < cols) {
+                    dense[(size_t)it.row() * cols + it.col()] = it.value();
                 }
-                os << std::endl;
             }
         }
-        else if (numRows > 100 && numCols > 100) {
-            // print the first 100 rows and columns
-            for (uint32_t i = 0; i < 100; i++) {
-                for (uint32_t j = 0; j < 100; j++) {
-                    os << coeff(i, j) << " ";
-                }
-                os << std::endl;
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < cols; j++) {
+                os << dense[(size_t)i * cols + j] << " ";
             }
+            os << std::endl;
         }
 
         os << std::endl;
@@ -119,21 +242,20 @@ namespace IVSparse {
         // set compSize to zero
         compSize = 0;
 
-        compSize += (sizeof(indexT) * outerDim);  // valueSizes 4
+        // the offset tables
+        compSize += sizeof(uint64_t) * 2 * (outerDim + 1);
 
+        if (valueOffsets == nullptr || indexOffsets == nullptr) return;
 
-        for (uint32_t i = 0; i < outerDim; i++) {
-
-            compSize += (sizeof(T) * valueSizes[i]);       // values 8 -> 8 per value
-            compSize += (sizeof(indexT) * valueSizes[i]);  // counts 4 -> 4 per value
-            compSize += (sizeof(indexT) * indexSizes[i]);  // indices 4 -> 4 per index
-        }
+        compSize += (sizeof(T) + sizeof(indexT)) * valueOffsets[outerDim];  // values and counts
+        compSize += sizeof(indexT) * indexOffsets[outerDim];               // indices
     }
 
     // Compression Algorithm for going from CSC to VCSC
     template <typename T, typename indexT, bool columnMajor>
     template <typename T2, typename indexT2>
-    void SparseMatrix<T, indexT, 2, columnMajor>::compressCSC(T2* vals, indexT2* innerIndices, indexT2* outerPointers) {
+    void SparseMatrix<T, indexT, 2, columnMajor>::compressCSC(const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers,
+                                                              const indexT2* innerNonZeros) {
         // ---- Stage 1: Setup the Matrix ---- //
 
         // set the value and index types of the matrix
@@ -141,7 +263,7 @@ namespace IVSparse {
         index_t = sizeof(indexT);
 
         // allocate space for metadata
-        metadata = new uint32_t[NUM_META_DATA];
+        metadata = new uint64_t[NUM_META_DATA];
         metadata[0] = 2;
         metadata[1] = innerDim;
         metadata[2] = outerDim;
@@ -154,102 +276,188 @@ namespace IVSparse {
         userChecks();
         #endif
 
-        // allocate space for the 2D Run lenngth encoded CSC matrix
-        try {
-            values = (T**)malloc(sizeof(T*) * outerDim);
-            counts = (indexT**)malloc(sizeof(indexT*) * outerDim);
-            indices = (indexT**)malloc(sizeof(indexT*) * outerDim);
+        // ---- Stage 2: Group the Entries of Each Vector by Value ---- //
 
-            valueSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-            indexSizes = (indexT*)malloc(sizeof(indexT) * outerDim);
-        }
-        catch (std::bad_alloc& e) {
-            std::cerr << "Error: Could not allocate memory for the matrix" << std::endl;
-            exit(1);
+        // where each vector starts in entries, an uncompressed Eigen matrix has gaps between its vectors
+        std::vector<uint64_t> starts(outerDim + 1, 0);
+        for (uint64_t i = 0; i < outerDim; i++) {
+            starts[i + 1] = starts[i] + (innerNonZeros == nullptr ? outerPointers[i + 1] - outerPointers[i] : innerNonZeros[i]);
         }
 
-        // ---- Stage 2: Construct the Dictionary For Each Column ---- //
+        // sorting (value, index) pairs puts the values in ascending order with their indices ascending
+        std::vector<std::pair<T, indexT>> entries(nnz);
+        allocateOffsets();
 
-        // Loop through each column and construct a middle data structre for the matrix
         #ifdef IVSPARSE_HAS_OPENMP
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic, 64)
         #endif
-        for (uint32_t i = 0; i < outerDim; i++) {
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            size_t start = starts[i];
+            size_t end = starts[i + 1];
 
-            // create the data structure to temporarily hold the data
-            std::map<T2, std::vector<indexT2>> dict;  // Key = value, Value = vector of indices
-
-            // check if the current column is empty
-            if (outerPointers[i] == outerPointers[i + 1]) {
-                valueSizes[i] = 0;
-                indexSizes[i] = 0;
+            for (size_t j = start; j < end; j++) {
+                entries[j] = std::make_pair((T)vals[outerPointers[i] + j - start], (indexT)innerIndices[outerPointers[i] + j - start]);
+            }
+            std::sort(entries.begin() + start, entries.begin() + end);
 
-                values[i] = nullptr;
-                counts[i] = nullptr;
-                indices[i] = nullptr;
-                continue;
+            // count the unique values of the vector
+            size_t uniqueVals = 0;
+            for (size_t j = start; j < end; j++) {
+                if (j == start || entries[j].first != entries[j - 1].first) { uniqueVals++; }
             }
 
-            // create a variable to hold the size of the column
-            size_t numIndices = 0;
+            valueOffsets[i + 1] = uniqueVals;
+            indexOffsets[i + 1] = end - start;
+        }
 
-            // loop through each value in the column and add it to dict
-            for (indexT2 j = outerPointers[i]; j < outerPointers[i + 1]; j++) {
-                // check if the value is already in the dictionary or not
-                if (dict.find(vals[j]) != dict.end()) {
-                    // add the index
-                    dict[vals[j]].push_back(innerIndices[j]);
+        // ---- Stage 3: Allocate the Contiguous Arrays ---- //
 
-                    numIndices++;
-                }
-                else {
-                    // if value not already in the dictionary add it
+        allocateData();
 
-                    // create a new vector for the indices
-                    dict[vals[j]] = std::vector<indexT2>{ innerIndices[j] };
+        // ---- Stage 4: Populate the Vectors ---- //
 
-                    numIndices++;
+        #ifdef IVSPARSE_HAS_OPENMP
+        #pragma omp parallel for schedule(dynamic, 64)
+        #endif
+        for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+            uint64_t value = valueOffsets[i] - 1;
+
+            // the entries are already at their final position in indices
+            for (uint64_t j = indexOffsets[i]; j < indexOffsets[i + 1]; j++) {
+                if (j == indexOffsets[i] || entries[j].first != entries[j - 1].first) {
+                    value++;
+                    values[value] = entries[j].first;
+                    counts[value] = 0;
                 }
+                counts[value]++;
+                indices[j] = entries[j].second;
+            }
+        }
 
-            }  // end value loop
+        calculateCompSize();
 
-            // ---- Stage 3: Allocate Size of Column Data ---- //
+    }  // end compressCSC
 
-            try {
-                values[i] = (T*)malloc(sizeof(T) * dict.size());
-                counts[i] = (indexT*)malloc(sizeof(indexT) * dict.size());
-                indices[i] = (indexT*)malloc(sizeof(indexT) * numIndices);
-            }
-            catch (std::bad_alloc& e) {
-                std::cerr << "Error: Could not allocate memory for the matrix"
-                    << std::endl;
-                exit(1);
-            }
+    // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+    template <typename T, typename indexT, bool columnMajor>
+    template <int storageOrder>
+    void SparseMatrix<T, indexT, 2, columnMajor>::compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat) {
+
+        // the outer vectors of the Eigen matrix have to be the outer vectors of this matrix
+        if constexpr ((storageOrder == Eigen::ColMajor) != columnMajor) {
+            Eigen::SparseMatrix<T, columnMajor ? Eigen::ColMajor : Eigen::RowMajor> converted = mat;
+            compressEigen(converted);
+        }
+        else {
+            // get the number of rows and columns
+            numRows = mat.rows();
+            numCols = mat.cols();
+
+            outerDim = mat.outerSize();
+            innerDim = mat.innerSize();
+
+            // get the number of non-zero elements
+            nnz = mat.nonZeros();
 
-            // set the size of the column
-            valueSizes[i] = dict.size();
-            indexSizes[i] = numIndices;
-            size_t performanceVecSize = 0;
-            size_t indexSize = 0;
+            // an uncompressed matrix is read through its per vector non-zero counts
+            compressCSC(mat.valuePtr(), mat.innerIndexPtr(), mat.outerIndexPtr(), mat.innerNonZeroPtr());
+        }
+    }
 
-            // ---- Stage 4: Populate the Column Data ---- //
+    // Counts the unique values of a vector's entries sorted by value and then index
+    template <typename T, typename indexT, bool columnMajor>
+    inline uint64_t SparseMatrix<T, indexT, 2, columnMajor>::countRuns(std::pair<T, indexT>* begin, std::pair<T, indexT>* end) {
+        uint64_t runs = 0;
+        for (std::pair<T, indexT>* entry = begin; entry < end; entry++) {
+            if (entry == begin || entry->first != (entry - 1)->first) { runs++; }
+        }
+        return runs;
+    }
+
+    // Writes one vector from its entries sorted by value and then index, its offsets must be set
+    template <typename T, typename indexT, bool columnMajor>
+    void SparseMatrix<T, indexT, 2, columnMajor>::compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end) {
+        uint64_t value = valueOffsets[vec];
+        indexT* index = indices + indexOffsets[vec];
+
+        for (std::pair<T, indexT>* entry = begin; entry < end; entry++) {
+            if (entry == begin || entry->first != (entry - 1)->first) {
+                values[value] = entry->first;
+                counts[value] = 0;
+                value++;
+            }
+            counts[value - 1]++;
+            *index++ = entry->second;
+        }
+    }
 
-            for (auto& pair : dict) {
-                values[i][performanceVecSize] = pair.first;
-                counts[i][performanceVecSize] = pair.second.size();
+    // Compresses a dense Eigen matrix one vector at a time without an intermediate CSC copy
+    template <typename T, typename indexT, bool columnMajor>
+    template <int options>
+    void SparseMatrix<T, indexT, 2, columnMajor>::compressDense(Eigen::Matrix<T, -1, -1, options>& mat, T epsilon) {
 
-                // memcpy the indices into the indices array and increment the indexSize
-                memcpy(&indices[i][indexSize], &pair.second[0], sizeof(indexT) * pair.second.size());
-                indexSize += pair.second.size();
+        numRows = mat.rows();
+        numCols = mat.cols();
+        outerDim = columnMajor ? numCols : numRows;
+        innerDim = columnMajor ? numRows : numCols;
 
+        encodeValueType();
+        index_t = sizeof(indexT);
 
-                performanceVecSize++;
+        // the stride between entries of a vector and between vectors in the dense data
+        const bool rowMajorData = options & Eigen::RowMajor;
+        const uint64_t innerStride = (rowMajorData == columnMajor) ? outerDim : 1;
+        const uint64_t outerStride = (rowMajorData == columnMajor) ? 1 : innerDim;
+
+        const IVSparse::ZeroScanner<T> scanner(epsilon);
+
+        // the vectors are scanned twice, once to size the arrays and once to fill them
+        allocateOffsets();
+        for (int pass = 0; pass < 2; pass++) {
+            if (pass == 1) { allocateData(); }
+
+            #ifdef IVSPARSE_HAS_OPENMP
+            #pragma omp parallel
+            #endif
+            {
+                // the kept entries of the current vector
+                std::vector<std::pair<T, indexT>> entries;
+
+                #ifdef IVSPARSE_HAS_OPENMP
+                #pragma omp for schedule(dynamic, 16)
+                #endif
+                for (int64_t i = 0; i < (int64_t)outerDim; i++) {
+                    entries.clear();
+                    scanner.scan(mat.data() + i * outerStride, innerDim, innerStride,
+                                 [&](uint64_t index, T value) { entries.emplace_back(value, index); });
+                    std::sort(entries.begin(), entries.end());
+
+                    if (pass == 0) {
+                        valueOffsets[i + 1] = countRuns(entries.data(), entries.data() + entries.size());
+                        indexOffsets[i + 1] = entries.size();
+                    }
+                    else {
+                        compressVector(i, entries.data(), entries.data() + entries.size());
+                    }
+                }
             }
+        }
 
-        }  // end column loop
+        nnz = indexOffsets[outerDim];
+
+        metadata = new uint64_t[NUM_META_DATA];
+        metadata[0] = 2;
+        metadata[1] = innerDim;
+        metadata[2] = outerDim;
+        metadata[3] = nnz;
+        metadata[4] = val_t;
+        metadata[5] = index_t;
 
         calculateCompSize();
 
-    }  // end compressCSC
+        #ifdef IVSPARSE_DEBUG
+        userChecks();
+        #endif
+    }
 
 }  // end namespace IVSparse
\ No newline at end of file
@@ -22,20 +22,28 @@ namespace IVSparse {
         private:
         //* The Matrix Data *//
 
-        T** values = nullptr;        // The values of the matrix
-        indexT** counts = nullptr;   // The counts of the matrix
-        indexT** indices = nullptr;  // The indices of the matrix
+        // The vectors are stored back to back in three contiguous arrays. Vector i
+        // owns values and counts [valueOffsets[i], valueOffsets[i + 1]) and
+        // indices [indexOffsets[i], indexOffsets[i + 1]), like the outer pointers of CSC.
 
-        indexT* valueSizes = nullptr;  // The sizes of the value arrays
-        indexT* indexSizes = nullptr;  // The sizes of the index arrays
+        T* values = nullptr;        // The unique values of each vector
+        indexT* counts = nullptr;   // The number of indices of each value
+        indexT* indices = nullptr;  // The indices of each vector grouped by value
 
-        uint32_t innerDim = 0;  // The inner dimension of the matrix
-        uint32_t outerDim = 0;  // The outer dimension of the matrix
+        uint64_t* valueOffsets = nullptr;  // Start of each vector in values and counts (outerDim + 1)
+        uint64_t* indexOffsets = nullptr;  // Start of each vector in indices (outerDim + 1)
 
-        uint32_t numRows = 0;  // The number of rows in the matrix
-        uint32_t numCols = 0;  // The number of columns in the matrix
+        uint64_t outerCapacity = 0;  // The number of vectors the offset tables have room for
+        uint64_t valueCapacity = 0;  // The number of values and counts the arrays have room for
+        uint64_t indexCapacity = 0;  // The number of indices the array has room for
 
-        uint32_t nnz = 0;  // The number of non-zero values in the matrix
+        uint64_t innerDim = 0;  // The inner dimension of the matrix
+        uint64_t outerDim = 0;  // The outer dimension of the matrix
+
+        uint64_t numRows = 0;  // The number of rows in the matrix
+        uint64_t numCols = 0;  // The number of columns in the matrix
+
+        uint64_t nnz = 0;  // The number of non-zero values in the matrix
 
         size_t compSize = 0;  // The size of the compressed matrix in bytes
 
@@ -44,18 +52,56 @@ namespace IVSparse {
         uint32_t val_t;  // Information about the value type (size, signededness, etc.)
         uint32_t index_t;  // Information about the index type (size)
 
-        uint32_t* metadata = nullptr;  // The metadata of the matrix
+        uint64_t* metadata = nullptr;  // The metadata of the matrix
+
+        //* Random Access Lookup Table *//
+
+        std::vector<std::vector<indexT>> lookupIndices;  // Sorted inner indices of each vector
+        std::vector<std::vector<indexT>> lookupRuns;   // Position of the value in the vector for each index
 
         //* Private Methods *//
 
         // Calculates the number of bytes needed to store a value
         inline uint8_t byteWidth(size_t size);
 
+        // Builds the lookup table entries of a single vector
+        void buildLookup(uint64_t vec);
+
+        // Finds a value with the lookup table, building the vector's entries if needed
+        inline T lookupCoeff(uint64_t vec, uint64_t index);
+
         //* Private Methods *//
 
+        // Allocates zeroed offset tables for outerDim vectors
+        void allocateOffsets();
+
+        // Turns the vector sizes stored at offsets[i + 1] into prefix sums and allocates the data arrays
+        void allocateData();
+
+        // Frees the data arrays and offset tables
+        void freeData();
+
+        // Grows the arrays and offset tables geometrically to fit the given sizes
+        void growData(uint64_t newOuterDim, uint64_t newValues, uint64_t newIndices);
+
         // Compression Algorithm for going from CSC to VCSC or IVCSCC
         template <typename T2, typename indexT2>
-        void compressCSC(T2* vals, indexT2* innerIndices, indexT2* outerPointers);
+        void compressCSC(const T2* vals, const indexT2* innerIndices, const indexT2* outerPointers,
+                         const indexT2* innerNonZeros = nullptr);
+
+        // Compresses an Eigen matrix, converting it to the storage order of the matrix first if needed
+        template <int storageOrder>
+        void compressEigen(const Eigen::SparseMatrix<T, storageOrder>& mat);
+
+        // Compresses a dense Eigen matrix, dropping entries with a magnitude of at most epsilon
+        template <int options>
+        void compressDense(Eigen::Matrix<T, -1, -1, options>& mat, T epsilon);
+
+        // Counts the unique values of a vector's entries sorted by value and then index
+        static inline uint64_t countRuns(std::pair<T, indexT>* begin, std::pair<T, indexT>* end);
+
+        // Writes one vector from its entries sorted by value and then index, its offsets must be set
+        void compressVector(uint64_t vec, std::pair<T, indexT>* begin, std::pair<T, indexT>* end);
 
         // Encodes the value type of the matrix
         void encodeValueType();
@@ -75,11 +121,31 @@ namespace IVSparse {
         // In Place Scalar Multiplication
         inline void inPlaceScalarMultiply(T scalar);
 
-        // Matrix Vector Multiplication
-        inline Eigen::Matrix<T, -1, 1> vectorMultiply(Eigen::Matrix<T, -1, 1>& vec);
+        // Matrix Vector Multiplication, accumulated in the scalar type of the dense vector
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(Eigen::Matrix<accumT, -1, 1>& vec);
 
         // Matrix Vector Multiplication 2 (with IVSparse Vector)
-        inline Eigen::Matrix<T, -1, 1> vectorMultiply(typename SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec);
+        template <typename accumT = T>
+        inline Eigen::Matrix<accumT, -1, 1> vectorMultiply(typename SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec);
+
+        // Matrix Matrix Multiplication, accumulated in the scalar type of the dense matrix
+        template <typename accumT>
+        inline Eigen::Matrix<accumT, -1, -1> matrixMultiply(Eigen::Matrix<accumT, -1, -1>& mat);
+
+        // Statistics of each vector along the outer dimension
+        inline IVSparse::SummaryStats outerStats();
+
+        // Statistics of each vector along the inner dimension
+        inline IVSparse::SummaryStats innerStats();
+
+        // Minimum or maximum of each vector along the outer dimension
+        template <bool isMax>
+        inline std::vector<T> outerExtremes(std::vector<uint64_t>* indices);
+
+        // Minimum or maximum of each vector along the inner dimension
+        template <bool isMax>
+        inline std::vector<T> innerExtremes(std::vector<uint64_t>* indices);
 
         // helper for ostream operator
         void print(std::ostream& stream);
@@ -88,19 +154,19 @@ namespace IVSparse {
         public:
 
         // Gets the number of rows in the matrix
-        uint32_t rows() const { return numRows; }
+        uint64_t rows() const { return numRows; }
 
         // Gets the number of columns in the matrix
-        uint32_t cols() const { return numCols; }
+        uint64_t cols() const { return numCols; }
 
         // Gets the inner dimension of the matrix
-        uint32_t innerSize() const { return innerDim; }
+        uint64_t innerSize() const { return innerDim; }
 
         // Gets the outer dimension of the matrix
-        uint32_t outerSize() const { return outerDim; }
+        uint64_t outerSize() const { return outerDim; }
 
         // Gets the number of non-zero elements in the matrix
-        uint32_t nonZeros() const { return nnz; }
+        uint64_t nonZeros() const { return nnz; }
 
         // Gets the number of bytes needed to store the matrix
         size_t byteSize() const { return compSize; }
@@ -111,9 +177,15 @@ namespace IVSparse {
         // The Vector Class for VCSC Matrices
         class Vector;
 
+        // Non-owning Vector View Class for VCSC Matrices
+        class VectorView;
+
         // The Iterator Class for VCSC Matrices
         class InnerIterator;
 
+        // The Run Iterator Class for VCSC Matrices
+        class RunIterator;
+
         //* Constructors and Destructor *//
         /** @name Constructors
          */
@@ -131,7 +203,7 @@ namespace IVSparse {
         SparseMatrix() {};
 
         // Private Helper Constructor for tranposing a IVSparse matrix
-        SparseMatrix(std::unordered_map<T, std::vector<indexT>>* maps, uint32_t num_rows, uint32_t num_cols);
+        SparseMatrix(std::vector<uint64_t>& offsets, std::vector<std::pair<T, indexT>>& entries, uint64_t num_rows, uint64_t num_cols);
 
 
         /**
@@ -139,9 +211,10 @@ namespace IVSparse {
          *
          * Eigen Sparse Matrix Constructor \n \n
          * This constructor takes an Eigen Sparse Matrix and compresses it into a
-         * IVSparse matrix.
+         * IVSparse matrix. The Eigen matrix is not modified, it may be in compressed
+         * or uncompressed mode.
          */
-        SparseMatrix(Eigen::SparseMatrix<T>& mat);
+        SparseMatrix(const Eigen::SparseMatrix<T>& mat);
 
         /**
          * @param mat The Eigen Sparse Matrix to be compressed
@@ -149,7 +222,27 @@ namespace IVSparse {
          * Eigen Sparse Matrix Constructor (Row Major) \n \n
          * Same as previous constructor but for Row Major Eigen Sparse Matrices.
          */
-        SparseMatrix(Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+        SparseMatrix(const Eigen::SparseMatrix<T, Eigen::RowMajor>& mat);
+
+        /**
+         * @param mat The Eigen Dense Matrix to be compressed
+         * @param epsilon Entries with a magnitude of at most epsilon are dropped
+         *
+         * Eigen Dense Matrix Constructor \n \n
+         * This constructor compresses a dense Eigen Matrix directly, without going
+         * through sparseView() and an intermediate Eigen Sparse Matrix. Each vector
+         * is scanned for non-zeros in parallel and encoded on its own.
+         */
+        SparseMatrix(Eigen::Matrix<T, -1, -1>& mat, T epsilon = 0);
+
+        /**
+         * @param mat The Eigen Dense Matrix to be compressed
+         * @param epsilon Entries with a magnitude of at most epsilon are dropped
+         *
+         * Eigen Dense Matrix Constructor (Row Major) \n \n
+         * Same as previous constructor but for Row Major Eigen Dense Matrices.
+         */
+        SparseMatrix(Eigen::Matrix<T, -1, -1, Eigen::RowMajor>& mat, T epsilon = 0);
 
         /**
          * @tparam compressionLevel2 The compression level of the IVSparse matrix to
@@ -180,7 +273,7 @@ namespace IVSparse {
          * Eigen Sparse Matrix and then to a VCSC matrix.
          */
         template <typename T2, typename indexT2>
-        SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint32_t num_rows, uint32_t num_cols, uint32_t nnz);
+        SparseMatrix(T2* vals, indexT2* innerIndices, indexT2* outerPtr, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
 
         /**
          * COO Tuples Constructor \n \n
@@ -191,7 +284,7 @@ namespace IVSparse {
          * @note COO is (row, col, value) format.
          */
         template <typename T2, typename indexT2>
-        SparseMatrix(std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint32_t num_cols, uint32_t nnz);
+        SparseMatrix(std::vector<std::tuple<indexT2, indexT2, T2>>& entries, uint64_t num_rows, uint64_t num_cols, uint64_t nnz);
 
         /**
          * @param vec The vector to construct the matrix from
@@ -245,7 +338,26 @@ namespace IVSparse {
           * @warning This method is not efficient and should not be used in performance
           * critical code.
           */
-        T coeff(uint32_t row, uint32_t col);
+        T coeff(uint64_t row, uint64_t col);
+
+        /**
+         * @param rows The row of each query
+         * @param cols The column of each query
+         * @param out Filled with the value of each query in query order
+         * @param n The number of queries
+         *
+         * Gets many coefficients at once. \n \n
+         * Queries are grouped by vector so each touched vector is only decoded
+         * once, and the vectors are worked on in parallel.
+         */
+        void gather(const uint64_t* rows, const uint64_t* cols, T* out, size_t n);
+
+        /**
+         * @returns The value at each (rows[i], cols[i]) pair in query order.
+         *
+         * Same as the pointer version of gather().
+         */
+        std::vector<T> gather(const std::vector<uint64_t>& rows, const std::vector<uint64_t>& cols);
 
         /**
          * @returns true If the matrix is stored in column major format
@@ -259,32 +371,32 @@ namespace IVSparse {
          * @param vec The vector to get the values for
          * @returns A pointer to the values of a given vector in a VCSC Matrix
          */
-        T* getValues(uint32_t vec) const;
+        T* getValues(uint64_t vec) const;
 
         /**
          * @param vec The vector to get the counts for
          * @returns A pointer to the value counts of a given vector in a VCSC Matrix
          */
-        indexT* getCounts(uint32_t vec) const;
+        indexT* getCounts(uint64_t vec) const;
 
         /**
          * @param vec The vector to get the indices for
          * @returns A pointer to the indices of a given vector in a VCSC Matrix
          */
-        indexT* getIndices(uint32_t vec) const;
+        indexT* getIndices(uint64_t vec) const;
 
         /**
          * @param vec The vector to get the unique values for
          * @returns The number of unique values in a given vector in a VCSC Matrix
          */
-        indexT getNumUniqueVals(uint32_t vec) const;
+        indexT getNumUniqueVals(uint64_t vec) const;
 
         /**
          * @param vec The vector to get the the number of indices for
          * @returns The number of indices (nonzeros) in a given vector in a VCSC
          * Matrix
          */
-        indexT getNumIndices(uint32_t vec) const;
+        indexT getNumIndices(uint64_t vec) const;
 
         /**
          * @param vec The vector to get a copy of
@@ -296,7 +408,19 @@ namespace IVSparse {
          * @note Can only get vectors in the storage order of the matrix.
          */
         typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector getVector(
-            uint32_t vec);
+            uint64_t vec);
+
+        /**
+         * @param vec The vector to view
+         * @returns VectorView A view of the vector
+         *
+         * Get a view of a vector of the IVSparse matrix that reads the matrix in
+         * place instead of copying it like getVector().
+         *
+         * @note Can only get vectors in the storage order of the matrix.
+         * @warning The view is only valid while the matrix is alive and unchanged.
+         */
+        typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::VectorView getVectorView(uint64_t vec);
 
         ///@}
 
@@ -307,35 +431,82 @@ namespace IVSparse {
          ///@{
 
          /**
+          * @tparam accumT The type the sums are accumulated in and returned as
           * @returns A vector of the sum of each vector along the outer dimension.
+          *
+          * @note Small integer matrices can sum into a wider type without being
+          * converted, e.g. outerSum<uint64_t>() or outerSum<double>().
           */
-        inline std::vector<T> outerSum();
+        template <typename accumT = T>
+        inline std::vector<accumT> outerSum();
 
         /**
+         * @tparam accumT The type the sums are accumulated in and returned as
          * @returns A vector of the sum of each vector along the inner dimension.
          */
-        inline std::vector<T> innerSum();
+        template <typename accumT = T>
+        inline std::vector<accumT> innerSum();
 
         /**
          * @returns A vector of the maximum value in each column.
+         *
+         * @note Columns that are not full also count their implicit zeros.
          */
         inline std::vector<T> maxColCoeff();
 
+        /**
+         * @param indices Filled with the row of the maximum of each column.
+         * @returns A vector of the maximum value in each column.
+         *
+         * @note Ties go to the smallest row.
+         */
+        inline std::vector<T> maxColCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the maximum value in each row.
+         *
+         * @note Rows that are not full also count their implicit zeros.
          */
         inline std::vector<T> maxRowCoeff();
 
+        /**
+         * @param indices Filled with the column of the maximum of each row.
+         * @returns A vector of the maximum value in each row.
+         *
+         * @note Ties go to the smallest column.
+         */
+        inline std::vector<T> maxRowCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the minimum value in each column.
+         *
+         * @note Columns that are not full also count their implicit zeros.
          */
         inline std::vector<T> minColCoeff();
 
+        /**
+         * @param indices Filled with the row of the minimum of each column.
+         * @returns A vector of the minimum value in each column.
+         *
+         * @note Ties go to the smallest row.
+         */
+        inline std::vector<T> minColCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns A vector of the minimum value in each row.
+         *
+         * @note Rows that are not full also count their implicit zeros.
          */
         inline std::vector<T> minRowCoeff();
 
+        /**
+         * @param indices Filled with the column of the minimum of each row.
+         * @returns A vector of the minimum value in each row.
+         *
+         * @note Ties go to the smallest column.
+         */
+        inline std::vector<T> minRowCoeff(std::vector<uint64_t>& indices);
+
         /**
          * @returns The trace of the matrix.
          *
@@ -344,19 +515,65 @@ namespace IVSparse {
         inline T trace();
 
         /**
+         * @tparam accumT The type the sum is accumulated in and returned as
          * @returns The sum of all the values in the matrix.
          */
-        inline T sum();
+        template <typename accumT = T>
+        inline accumT sum();
 
         /**
+         * @tparam accumT The type the squares are accumulated in and returned as
          * @returns The frobenius norm of the matrix.
          */
-        inline double norm();
+        template <typename accumT = double>
+        inline accumT norm();
 
         /**
+         * @tparam accumT The type the squares are accumulated in and returned as
          * @returns Returns the length of the specified vector.
          */
-        inline double vectorLength(uint32_t vec);
+        template <typename accumT = double>
+        inline accumT vectorLength(uint64_t vec);
+
+        /**
+         * @returns The number of non-zeros, sum, sum of squares, mean, variance
+         * and dispersion of each column.
+         *
+         * All of the statistics are gathered in a single parallel pass. The mean,
+         * variance and dispersion count the implicit zeros of each column.
+         */
+        inline IVSparse::SummaryStats columnStats();
+
+        /**
+         * @returns The same statistics as columnStats() but for each row.
+         */
+        inline IVSparse::SummaryStats rowStats();
+
+        /**
+         * @returns The (value, count) pairs of the given vector in ascending
+         * order of value.
+         *
+         * @note Read straight from the stored unique values and counts.
+         */
+        inline std::vector<std::pair<T, uint64_t>> valueHistogram(uint64_t vec);
+
+        /**
+         * @returns The number of distinct non-zero values in the matrix.
+         */
+        inline uint64_t uniqueValueCount();
+
+        /**
+         * @returns The average value redundancy of the non-empty vectors, where
+         * the redundancy of a vector is 1 - unique values / non-zeros, or 1 for
+         * a vector holding a single value.
+         */
+        inline double redundancy();
+
+        /**
+         * @returns The Shannon entropy in bits of the non-zero values of the
+         * matrix.
+         */
+        inline double entropy();
 
         ///@}
 
@@ -374,6 +591,8 @@ namespace IVSparse {
           * Currently .ivsparse is the perfered file extension.
           *
           * @note Useful to split a matrix up and then write each part separately.
+          * @note The header stores the dimensions and nnz as 64-bit integers, files
+          * written with the older 32-bit header can still be read.
           */
         void write(const char* filename);
 
@@ -385,6 +604,31 @@ namespace IVSparse {
          */
         void print();
 
+        /**
+         * @param lazy If true the table is only set up here and each vector is
+         * indexed the first time it is read by coeff().
+         *
+         * Builds a table of the sorted inner indices of each vector so coeff() and
+         * operator() use a binary search instead of scanning the whole vector. \n \n
+         * The table takes 2 * sizeof(indexT) bytes per non-zero, an index and the
+         * position of its value, plus two vector headers per outer vector. It is
+         * not counted in byteSize(), see lookupTableSize().
+         *
+         * @note Build the whole table (lazy = false) before calling coeff() from
+         * multiple threads.
+         */
+        void buildLookupTable(bool lazy = false);
+
+        /**
+         * Frees the lookup table so coeff() goes back to scanning vectors.
+         */
+        void dropLookupTable();
+
+        /**
+         * @returns The number of bytes used by the lookup table.
+         */
+        size_t lookupTableSize() const;
+
 
         /**
          * @returns The current matrix as uncompressed to CSC format.
@@ -412,14 +656,14 @@ namespace IVSparse {
          /**
           * @returns A transposed version of the IVSparse matrix.
           *
-          * @warning This method is not very efficient for VCSC and IVCSC matrices.
+          * @note The entries are counting sorted into the transposed vectors in
+          * parallel, temporarily holding every non-zero uncompressed as a
+          * (value, index) pair, nnz * sizeof(std::pair<T, indexT>) bytes.
           */
         IVSparse::SparseMatrix<T, indexT, 2, columnMajor> transpose();
 
         /**
          * Transposes the matrix in place instead of returning a new matrix.
-         *
-         * @warning This method is not very efficient for VCSC and IVCSC matrices.
          */
         void inPlaceTranspose();
 
@@ -431,6 +675,16 @@ namespace IVSparse {
          */
         void append(SparseMatrix<T, indexT, 2, columnMajor>& mat);
 
+        /**
+         * @param n The number of vectors to make room for.
+         *
+         * Reserves room for n vectors along the outer dimension so later appends
+         * do not have to grow the offset tables. \n \n
+         * Appends grow the matrix geometrically on their own, this only avoids
+         * the intermediate reallocations when the final size is known.
+         */
+        void reserveOuter(uint64_t n);
+
         /**
          * @param mat The matrix to append to the matrix in the correct storage order.
          *
@@ -444,7 +698,7 @@ namespace IVSparse {
          * @returns A matrix that represent a slice of the
          * IVSparse matrix.
          */
-        IVSparse::SparseMatrix<T, indexT, 2, columnMajor> slice(uint32_t start, uint32_t end);
+        IVSparse::SparseMatrix<T, indexT, 2, columnMajor> slice(uint64_t start, uint64_t end);
 
         ///@}
 
@@ -465,11 +719,11 @@ namespace IVSparse {
         bool operator!=(const SparseMatrix<T, indexT, 2, columnMajor>& other);
 
         // Coefficient Access Operator
-        T operator()(uint32_t row, uint32_t col);
+        T operator()(uint64_t row, uint64_t col);
 
         // Vector Access Operator
         typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector operator[](
-            uint32_t vec);
+            uint64_t vec);
 
         // Scalar Multiplication
         IVSparse::SparseMatrix<T, indexT, 2, columnMajor> operator*(T scalar);
@@ -477,15 +731,17 @@ namespace IVSparse {
         // In Place Scalar Multiplication
         void operator*=(T scalar);
 
-        // Matrix Vector Multiplication
-        Eigen::Matrix<T, -1, 1> operator*(Eigen::Matrix<T, -1, 1>& vec);
+        // Matrix Vector Multiplication, the result has the scalar type of vec
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, 1> operator*(Eigen::Matrix<accumT, -1, 1>& vec);
 
         // Matrix Vector Multiplication 2 (with IVSparse Vector)
         Eigen::Matrix<T, -1, 1> operator*(
             typename SparseMatrix<T, indexT, 2, columnMajor>::Vector& vec);
 
-        // Matrix Matrix Multiplication
-        Eigen::Matrix<T, -1, -1> operator*(Eigen::Matrix<T, -1, -1>& mat);
+        // Matrix Matrix Multiplication, the result has the scalar type of mat
+        template <typename accumT>
+        Eigen::Matrix<accumT, -1, -1> operator*(Eigen::Matrix<accumT, -1, -1>& mat);
 
     };  // End of VCSC Sparse Matrix Class
 
@@ -26,8 +26,8 @@ class SparseMatrix<T, indexT, 1, columnMajor>::Vector {
   T *vals = nullptr;           // values of the vector
   indexT *innerIdx = nullptr;  // inner indices of the vector
 
-  uint32_t length = 0;  // length of the vector
-  uint32_t nnz = 0;     // number of non-zero elements in the vector
+  uint64_t length = 0;  // length of the vector
+  uint64_t nnz = 0;     // number of non-zero elements in the vector
 
   //* Private Class Methods *//
 
@@ -56,13 +56,13 @@ class SparseMatrix<T, indexT, 1, columnMajor>::Vector {
    * @note Can only get a vector from a matrix in the storage order of the
    * matrix.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, 1, columnMajor> &mat, uint32_t vec);
+  Vector(IVSparse::SparseMatrix<T, indexT, 1, columnMajor> &mat, uint64_t vec);
 
   /**
    * Deep Copy Vector Constructor \n \n
    * Creates a deep copy of the given vector.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec);
+  Vector(const IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec);
 
   /**
    * Destroys the vector.
@@ -79,7 +79,7 @@ class SparseMatrix<T, indexT, 1, columnMajor>::Vector {
   /**
    * @returns The coefficient at the given index.
    */
-  T coeff(uint32_t index);
+  T coeff(uint64_t index);
 
   /**
    * @returns The size of the vector in bytes.
@@ -89,22 +89,22 @@ class SparseMatrix<T, indexT, 1, columnMajor>::Vector {
   /**
    * @returns The inner size of the vector.
    */
-  uint32_t innerSize();
+  uint64_t innerSize();
 
   /**
    * @returns The outer size of the vector.
    */
-  uint32_t outerSize();
+  uint64_t outerSize();
 
   /**
    * @returns The number of non-zero elements in the vector.
    */
-  uint32_t nonZeros();
+  uint64_t nonZeros();
 
   /**
    * @returns The length of the vector.
    */
-  uint32_t getLength();
+  uint64_t getLength();
 
   /**
    * @returns A pointer to the values of the vector.
@@ -133,7 +133,7 @@ class SparseMatrix<T, indexT, 1, columnMajor>::Vector {
   //* Operator Overloads *//
 
   // Coefficient Access Operator
-  T operator[](uint32_t index);
+  T operator[](uint64_t index);
 
   // Assignment Operator
   typename SparseMatrix<T, indexT, 1, columnMajor>::Vector operator=(
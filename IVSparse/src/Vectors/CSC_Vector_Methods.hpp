@@ -26,7 +26,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::Vector::~Vector() {
 // IVSparse Matrix Constructor
 template <typename T, typename indexT, bool columnMajor>
 SparseMatrix<T, indexT, 1, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, 1, columnMajor> &mat, uint32_t vec) {
+    IVSparse::SparseMatrix<T, indexT, 1, columnMajor> &mat, uint64_t vec) {
 
   #ifdef IVSPARSE_DEBUG
   // make sure the vector is in bounds
@@ -36,16 +36,16 @@ SparseMatrix<T, indexT, 1, columnMajor>::Vector::Vector(
   #endif
 
   length = mat.innerSize();
+  nnz = mat.outerPtr[vec + 1] - mat.outerPtr[vec];
 
   // if the vector is empty, return
-  if (mat.byteSize() == 0) {
+  if (nnz == 0) {
     vals = nullptr;
     innerIdx = nullptr;
+    calculateCompSize();
     return;
   }
 
-  nnz = mat.outerPtr[vec + 1] - mat.outerPtr[vec];
-
   try {
     vals = (T *)malloc(nnz * sizeof(T));
     innerIdx = (indexT *)malloc(nnz * sizeof(indexT));
@@ -66,7 +66,7 @@ SparseMatrix<T, indexT, 1, columnMajor>::Vector::Vector(
 // IVSparse Vector Constructor
 template <typename T, typename indexT, bool columnMajor>
 SparseMatrix<T, indexT, 1, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec) {
+    const IVSparse::SparseMatrix<T, indexT, 1, columnMajor>::Vector &vec) {
   
   length = vec.length;
   nnz = vec.nnz;
@@ -114,19 +114,19 @@ void SparseMatrix<T, indexT, 1, columnMajor>::Vector::calculateCompSize() {
 
 // Get the inner dimension of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::innerSize() {
+uint64_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::innerSize() {
   return length;
 }
 
 // Get the outer dimension of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::outerSize() {
+uint64_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::outerSize() {
   return 1;
 }
 
 // Get the number of nonzeros in the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::nonZeros() {
+uint64_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::nonZeros() {
   return nnz;
 }
 
@@ -138,7 +138,7 @@ size_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::byteSize() {
 
 // Get a value from the vector at index
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 1, columnMajor>::Vector::coeff(uint32_t index) {
+T SparseMatrix<T, indexT, 1, columnMajor>::Vector::coeff(uint64_t index) {
   
   #ifdef IVSPARSE_DEBUG
     assert((index >= 0 && index < length) && "Index out of bounds");
@@ -149,7 +149,7 @@ T SparseMatrix<T, indexT, 1, columnMajor>::Vector::coeff(uint32_t index) {
 
 // Get the length of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::getLength() {
+uint64_t SparseMatrix<T, indexT, 1, columnMajor>::Vector::getLength() {
   return length;
 }
 
@@ -175,7 +175,7 @@ void SparseMatrix<T, indexT, 1, columnMajor>::Vector::print() {
   std::cout << std::endl;
 
   // print the denese vector up to 100 elements
-  for (uint32_t i = 0; i < std::min(length, (uint32_t)100); i++) {
+  for (uint32_t i = 0; i < std::min(length, (uint64_t)100); i++) {
     std::cout << (*this)[i] << " ";
   }
 
@@ -241,7 +241,7 @@ bool SparseMatrix<T, indexT, 1, columnMajor>::Vector::operator==(
   }
 
   // check if the values and indices are the same
-  for (uint32_t i = 0; i < nnz; i++) {
+  for (uint64_t i = 0; i < nnz; i++) {
     if (vals[i] != vec.vals[i] || innerIdx[i] != vec.innerIdx[i]) {
       return false;
     }
@@ -261,12 +261,12 @@ bool SparseMatrix<T, indexT, 1, columnMajor>::Vector::operator!=(
 
 // Bracket Operator
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 1, columnMajor>::Vector::operator[](uint32_t index) {
+T SparseMatrix<T, indexT, 1, columnMajor>::Vector::operator[](uint64_t index) {
   #ifdef IVSPARSE_DEBUG
   assert((index >= 0 && index < length) && "Index out of bounds");
   #endif
 
-  for (uint32_t i = 0; i < nnz; i++) {
+  for (uint64_t i = 0; i < nnz; i++) {
     if (innerIdx[i] == index) {
       return vals[i];
     }
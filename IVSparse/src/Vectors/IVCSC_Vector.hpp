@@ -31,11 +31,11 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
   void *data = nullptr;    // data of the vector
   void *endPtr = nullptr;  // pointer to the end of the vector
 
-  uint32_t length = 0;  // length of the vector
+  uint64_t length = 0;  // length of the vector
 
   uint8_t indexWidth = 1;  // width of the indices
 
-  uint32_t nnz = 0;  // number of non-zero elements in the vector
+  uint64_t nnz = 0;  // number of non-zero elements in the vector
 
   //* Private Class Methods *//
 
@@ -61,7 +61,7 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
    * Length Vector Constructor \n \n
    * Creates a vector of the given length with everything set to null/zero.
    */
-  Vector(uint32_t length);
+  Vector(uint64_t length);
 
   /**
    * IVSparse Matrix to Vector Constructor \n \n
@@ -70,13 +70,13 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
    * @note Can only get a vector from a matrix in the storage order of the
    * matrix.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint32_t vec);
+  Vector(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint64_t vec);
 
   /**
    * Deep Copy Vector Constructor \n \n
    * Creates a deep copy of the given vector.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector &vec);
+  Vector(const IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector &vec);
 
   /**
    * Destroys the vector.
@@ -93,7 +93,7 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
   /**
    * @returns The coefficient at the given index.
    */
-  T coeff(uint32_t index);
+  T coeff(uint64_t index);
 
   /**
    * @returns A pointer to the beginning of the vector.
@@ -113,22 +113,22 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
   /**
    * @returns The inner size of the vector.
    */
-  uint32_t innerSize();
+  uint64_t innerSize();
 
   /**
    * @returns The outer size of the vector.
    */
-  uint32_t outerSize();
+  uint64_t outerSize();
 
   /**
    * @returns The number of non-zero elements in the vector.
    */
-  uint32_t nonZeros();
+  uint64_t nonZeros();
 
   /**
    * @returns The length of the vector.
    */
-  uint32_t getLength();
+  uint64_t getLength();
 
   ///@}
 
@@ -188,7 +188,7 @@ class SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector {
                                         columnMajor>::Vector &vec);
 
   // coefficient access
-  T operator[](uint32_t index);
+  T operator[](uint64_t index);
 
   // boolean operator
   operator bool() { return (char *)endPtr - indexWidth > data; };
@@ -0,0 +1,171 @@
+/**
+ * @file IVCSC_VectorView.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief IVCSC Vector View Class Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+/**
+ * @tparam T Type of the values in the matrix
+ * @tparam indexT Type of the indices in the matrix
+ * @tparam compressionLevel Compression level of the matrix
+ * @tparam columnMajor Storage order of the matrix
+ *
+ * IVCSC Vector View Class \n \n
+ * A non-owning view of one vector of an IVCSC matrix. Unlike Vector it does
+ * not allocate or copy, it reads the runs of its parent matrix in place. The
+ * number of non-zeros is counted from the run lengths the first time it is
+ * needed and then cached.
+ *
+ * @warning A view is only valid while its parent matrix is alive and unchanged.
+ */
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+class SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView {
+ private:
+  //* Private Class Variables *//
+
+  IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> *matrix = nullptr;  // parent matrix
+
+  uint64_t vec = 0;  // index of the vector in the parent
+
+  uint64_t length = 0;  // length of the vector
+
+  int64_t nnz = -1;  // number of non-zero elements, -1 until counted
+
+  //* Private Class Methods *//
+
+  // Calls visit(value, runLength) for each run of the vector
+  template <typename Visit>
+  inline void forEachRun(Visit visit);
+
+ public:
+  //* Constructors *//
+  /** @name Constructors
+   */
+  ///@{
+
+  /**
+   * Default Vector View Constructor \n \n
+   * Creates a view that is not attached to a matrix.
+   */
+  VectorView(){};
+
+  /**
+   * IVSparse Matrix to Vector View Constructor \n \n
+   * Creates a view of the vector of an IVCSC Matrix at the given vector index.
+   *
+   * @note Can only view a vector in the storage order of the matrix.
+   */
+  VectorView(IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint64_t vec);
+
+  ///@}
+
+  //* Getters *//
+  /** @name Getters
+   */
+  ///@{
+
+  /**
+   * @returns The coefficient at the given index.
+   */
+  T coeff(uint64_t index);
+
+  /**
+   * @returns A pointer to the beginning of the vector in the parent matrix.
+   */
+  void *begin();
+
+  /**
+   * @returns A pointer to the end of the vector in the parent matrix.
+   */
+  void *end();
+
+  /**
+   * @returns The size of the viewed vector in bytes.
+   */
+  size_t byteSize();
+
+  /**
+   * @returns The inner size of the vector.
+   */
+  uint64_t innerSize();
+
+  /**
+   * @returns The outer size of the vector.
+   */
+  uint64_t outerSize();
+
+  /**
+   * @returns The number of non-zero elements in the vector.
+   */
+  uint64_t nonZeros();
+
+  /**
+   * @returns The length of the vector.
+   */
+  uint64_t getLength();
+
+  /**
+   * @returns The index of the vector in the parent matrix.
+   */
+  uint64_t vectorIndex();
+
+  /**
+   * @returns The parent matrix of the view.
+   */
+  IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &getMatrix();
+
+  ///@}
+
+  //* Utility Methods *//
+  /** @name Utility Methods
+   */
+  ///@{
+
+  /**
+   * Prints the vector dense to the console.
+   */
+  void print();
+
+  ///@}
+
+  //* Calculations *//
+  /** @name Calculation Methods
+   */
+  ///@{
+
+  /**
+   * @returns The norm of the vector.
+   */
+  double norm();
+
+  /**
+   * @returns The sum of the vector.
+   */
+  T sum();
+
+  /**
+   * @returns The dot product of the vector and an Eigen Dense Vector.
+   */
+  double dot(Eigen::Vector<T, -1> &other);
+
+  /**
+   * @returns The dot product of the vector and an Eigen Sparse Vector.
+   */
+  double dot(Eigen::SparseVector<T> &other);
+
+  ///@}
+
+  //* Operator Overloads *//
+
+  // coefficient access
+  T operator[](uint64_t index);
+
+};  // class VectorView
+
+}  // namespace IVSparse
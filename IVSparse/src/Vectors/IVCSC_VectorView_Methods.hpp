@@ -0,0 +1,194 @@
+/**
+ * @file IVCSC_VectorView_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief IVCSC Vector View Methods
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+//* Constructors *//
+
+// IVSparse Matrix Constructor
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::VectorView(
+    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint64_t vec) {
+
+  #ifdef IVSPARSE_DEBUG
+  assert((vec < mat.outerSize()) && "Vector index out of bounds");
+  #endif
+
+  matrix = &mat;
+  this->vec = vec;
+  length = mat.innerSize();
+}
+
+//* Private Class Methods *//
+
+// Calls visit(value, runLength) for each run of the vector without decoding the indices
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+template <typename Visit>
+inline void SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::forEachRun(Visit visit) {
+  uint8_t *run = (uint8_t *)matrix->data[vec];
+  uint8_t *stop = (uint8_t *)matrix->endPointers[vec];
+
+  while (run != nullptr && run < stop) {
+    T value = *(T *)run;
+    uint8_t width = *(run + sizeof(T));
+
+    uint64_t runLength;
+    run = matrix->skipRun(run + sizeof(T) + 1, width, runLength);
+    visit(value, runLength);
+  }
+}
+
+//* Getters *//
+
+// Get the coefficient at the given index, using the parent's lookup table if it has one
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+T SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::coeff(uint64_t index) {
+
+  #ifdef IVSPARSE_DEBUG
+  assert(index < length && "The index is out of bounds");
+  #endif
+
+  if constexpr (columnMajor) { return matrix->coeff(index, vec); }
+  else { return matrix->coeff(vec, index); }
+}
+
+// Get a pointer to the beginning of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+void *SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::begin() {
+  return matrix->data[vec];
+}
+
+// Get a pointer to the end of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+void *SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::end() {
+  return matrix->endPointers[vec];
+}
+
+// Get the size of the vector in bytes
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+size_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::byteSize() {
+  return matrix->getVectorSize(vec);
+}
+
+// Get the inner dimension of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::innerSize() {
+  return length;
+}
+
+// Get the outer dimension of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::outerSize() {
+  return 1;
+}
+
+// Get the number of non-zero elements, counted from the run lengths once
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::nonZeros() {
+  if (nnz < 0) {
+    nnz = 0;
+    forEachRun([&](T, uint64_t runLength) { nnz += runLength; });
+  }
+  return nnz;
+}
+
+// Get the length of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::getLength() {
+  return length;
+}
+
+// Get the index of the vector in the parent matrix
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::vectorIndex() {
+  return vec;
+}
+
+// Get the parent matrix
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::getMatrix() {
+  return *matrix;
+}
+
+//* Utility Methods *//
+
+// Prints the vector to console dense
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+void SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::print() {
+  // if length is larger than 100 then print then don't print
+  if (length > 100) {
+    std::cout << "Vector is too large to print" << std::endl;
+    return;
+  }
+
+  std::cout << "Vector: ";
+  std::cout << std::endl;
+
+  // print a dense vector
+  for (uint64_t i = 0; i < length; i++) {
+    std::cout << coeff(i) << " ";
+  }
+
+  std::cout << std::endl;
+}
+
+//* Calculations *//
+
+// Calculates the norm of the vector, each run value is only squared once
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+inline double SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::norm() {
+  double norm = 0;
+  forEachRun([&](T value, uint64_t runLength) { norm += (double)value * value * runLength; });
+  return sqrt(norm);
+}
+
+// Calculates the sum of the vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+inline T SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::sum() {
+  T sum = 0;
+  forEachRun([&](T value, uint64_t runLength) { sum += value * (T)runLength; });
+  return sum;
+}
+
+// Calculates the dot product of the vector with an Eigen dense vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+double SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::dot(Eigen::Vector<T, -1> &other) {
+
+  double dot = 0;
+
+  for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this); it; ++it) {
+    dot += it.value() * other.coeff(it.getIndex());
+  }
+
+  return dot;
+}
+
+// Calculates the dot product of the vector with an Eigen sparse vector
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+double SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::dot(Eigen::SparseVector<T> &other) {
+
+  double dot = 0;
+
+  for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this); it; ++it) {
+    dot += it.value() * other.coeff(it.getIndex());
+  }
+
+  return dot;
+}
+
+//* Operator Overloads *//
+
+// Coefficient Operator
+template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
+T SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView::operator[](uint64_t index) {
+  return coeff(index);
+}
+
+}  // namespace IVSparse
@@ -22,7 +22,7 @@ SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::~Vector() {
 
 // Length Constructor
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(uint32_t length) {
+SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(uint64_t length) {
   #ifdef IVSPARSE_DEBUG
     assert((length > 0) && "Vector length must be greater than 0");
   #endif
@@ -33,7 +33,7 @@ SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(uint32_t
 // IVSparse Matrix Constructor
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
 SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint32_t vec) {
+    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor> &mat, uint64_t vec) {
   
   #ifdef IVSPARSE_DEBUG
   assert((vec >= 0 && vec < mat.outerSize()) && "Vector index out of bounds");
@@ -64,25 +64,15 @@ SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(
   // set the end pointer
   endPtr = (uint8_t *)data + size;
 
-  // set the nnz
-  if (nnz == 0 && size > 0) {
-    // make an iterator for the vector
-    IVSparse::SparseMatrix<T, indexT, compressionLevel,
-                           columnMajor>::InnerIterator it(*this);
-
-    // iterate through the vector until the index is found
-    while (it) {
-      nnz++;
-      ++it;
-    }
-  }
+  // set the nnz from the run lengths of the matrix, no indices are decoded
+  nnz = typename IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::VectorView(mat, vec).nonZeros();
 
 }  // End of IVSparse Matrix Constructor
 
 // Deep copy constructor
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
 SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector &vec) {
+    const IVSparse::SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector &vec) {
   
   // set the size
   size = vec.size;
@@ -111,7 +101,7 @@ SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::Vector(
   endPtr = (uint8_t *)data + size;
 
   // set the nnz
-  nnz = vec.nonZeros();
+  nnz = vec.nnz;
 
   #ifdef IVSPARSE_DEBUG
   userChecks();
@@ -150,19 +140,19 @@ void SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::calculateCo
 
 // Get the inner dimension of the vector
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::innerSize() {
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::innerSize() {
   return length;
 }
 
 // Get the outer dimension of the vector
 template <typename T, typename indexT, uint8_t compressionLevel,bool columnMajor>
-uint32_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::outerSize() {
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::outerSize() {
   return 1;
 }
 
 // Get the number of non-zero elements in the vector
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::nonZeros() {
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::nonZeros() {
   return nnz;
 }
 
@@ -186,7 +176,7 @@ size_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::byteSize(
 
 // Update the value of the vector at the given index
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::coeff(uint32_t index) {
+T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::coeff(uint64_t index) {
   
   #ifdef IVSPARSE_DEBUG
     assert(index < length && index >= 0 && "The index is out of bounds");
@@ -197,7 +187,7 @@ T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::coeff(uint32_t
 
 // Get the length of the vector
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::getLength() {
+uint64_t SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::getLength() {
   return length;
 }
 
@@ -216,7 +206,7 @@ void SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::print() {
   std::cout << std::endl;
 
   // print a dense vector
-  for (uint32_t i = 0; i < length; i++) {
+  for (uint64_t i = 0; i < length; i++) {
     std::cout << (*this)[i] << " ";
   }
 
@@ -349,7 +339,7 @@ bool SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::operator!=(
 
 // Coefficient Operator
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
-T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::operator[]( uint32_t index) {
+T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::operator[](uint64_t index) {
 
   #ifdef IVSPARSE_DEBUG
   // check if the index is out of bounds
@@ -375,10 +365,8 @@ T SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::operator[]( ui
 template <typename T, typename indexT, uint8_t compressionLevel, bool columnMajor>
 void SparseMatrix<T, indexT, compressionLevel, columnMajor>::Vector::operator*=(T scalar) {
   
-  for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::InnerIterator it(*this); it; ++it) {
-    if (it.isNewRun()) {
-      it.coeff(it.value() * scalar);
-    }
+  for (typename SparseMatrix<T, indexT, compressionLevel, columnMajor>::RunIterator it(*this); it; ++it) {
+    it.coeff(it.value() * scalar);
   }
 }
 
@@ -23,13 +23,15 @@ class SparseMatrix<T, indexT, 2, columnMajor>::Vector {
 
   size_t size = 0;  // size of the vector in bytes
 
-  std::map<T, std::vector<indexT>> data;  // map of values to indices
+  std::vector<T> values;        // unique values of the vector
+  std::vector<indexT> counts;   // number of indices of each value
+  std::vector<indexT> indices;  // indices grouped by value
 
-  uint32_t length = 0;  // length of the vector
+  uint64_t length = 0;  // length of the vector
 
   uint8_t indexWidth = 1;  // width of the indices
 
-  uint32_t nnz = 0;  // number of non-zero elements in the vector
+  uint64_t nnz = 0;  // number of non-zero elements in the vector
 
   //* Private Class Methods *//
 
@@ -58,13 +60,13 @@ class SparseMatrix<T, indexT, 2, columnMajor>::Vector {
    * @note Can only get a vector from a matrix in the storage order of the
    * matrix.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint32_t vec);
+  Vector(IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint64_t vec);
 
   /**
    * Deep Copy Vector Constructor \n \n
    * Creates a deep copy of the given vector.
    */
-  Vector(IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector &vec);
+  Vector(const IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector &vec);
 
   /**
    * Destroys the vector.
@@ -81,7 +83,7 @@ class SparseMatrix<T, indexT, 2, columnMajor>::Vector {
   /**
    * @returns The coefficient at the given index.
    */
-  T coeff(uint32_t index);
+  T coeff(uint64_t index);
 
   /**
    * @returns The size of the vector in bytes.
@@ -91,40 +93,40 @@ class SparseMatrix<T, indexT, 2, columnMajor>::Vector {
   /**
    * @returns The inner size of the vector.
    */
-  uint32_t innerSize();
+  uint64_t innerSize();
 
   /**
    * @returns The outer size of the vector.
    */
-  uint32_t outerSize();
+  uint64_t outerSize();
 
   /**
    * @returns The number of non-zero elements in the vector.
    */
-  uint32_t nonZeros();
+  uint64_t nonZeros();
 
   /**
    * @returns The length of the vector.
    */
-  uint32_t getLength();
+  uint64_t getLength();
 
   /**
    * @returns A pointer to the values of the vector.
    */
-  std::vector<T> getValues();
+  T *getValues();
 
   /**
    * @returns A pointer to the counts of the vector.
    */
-  std::vector<indexT> getCounts();
+  indexT *getCounts();
 
   /**
    * @returns A pointer to the indices of the vector.
    */
-  std::vector<indexT> getIndices();
+  indexT *getIndices();
 
   /**
-   * @returns The underlying data map
+   * @returns The vector as a map of each value to its indices
   */
   std::map<T, std::vector<indexT>> getData();
 
@@ -177,7 +179,7 @@ class SparseMatrix<T, indexT, 2, columnMajor>::Vector {
   //* Operator Overloads *//
 
   // Coefficient Access Operator
-  T operator[](uint32_t index);
+  T operator[](uint64_t index);
 
   // Assignment Operator
   typename SparseMatrix<T, indexT, 2, columnMajor>::Vector operator=(
@@ -0,0 +1,169 @@
+/**
+ * @file VCSC_VectorView.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief VCSC Vector View Class Declerations
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+/**
+ * VCSC Vector View Class \n \n
+ * A non-owning view of one vector of a VCSC matrix. Unlike Vector it does not
+ * allocate or copy, its values, counts and indices point into the arrays of
+ * the parent matrix and the number of non-zeros is read from its offsets.
+ *
+ * @warning A view is only valid while its parent matrix is alive and unchanged.
+ */
+template <typename T, typename indexT, bool columnMajor>
+class SparseMatrix<T, indexT, 2, columnMajor>::VectorView {
+ private:
+  //* Private Class Variables *//
+
+  IVSparse::SparseMatrix<T, indexT, 2, columnMajor> *matrix = nullptr;  // parent matrix
+
+  uint64_t vec = 0;  // index of the vector in the parent
+
+  uint64_t length = 0;  // length of the vector
+
+  uint64_t nnz = 0;  // number of non-zero elements in the vector
+
+ public:
+  //* Constructors *//
+  /** @name Constructors
+   */
+  ///@{
+
+  /**
+   * Default Vector View Constructor \n \n
+   * Creates a view that is not attached to a matrix.
+   */
+  VectorView(){};
+
+  /**
+   * IVSparse Matrix to Vector View Constructor \n \n
+   * Creates a view of the vector of a VCSC Matrix at the given vector index.
+   *
+   * @note Can only view a vector in the storage order of the matrix.
+   */
+  VectorView(IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint64_t vec);
+
+  ///@}
+
+  //* Getters *//
+  /** @name Getters
+   */
+  ///@{
+
+  /**
+   * @returns The coefficient at the given index.
+   */
+  T coeff(uint64_t index);
+
+  /**
+   * @returns The size of the viewed vector in bytes.
+   */
+  size_t byteSize();
+
+  /**
+   * @returns The inner size of the vector.
+   */
+  uint64_t innerSize();
+
+  /**
+   * @returns The outer size of the vector.
+   */
+  uint64_t outerSize();
+
+  /**
+   * @returns The number of non-zero elements in the vector.
+   */
+  uint64_t nonZeros();
+
+  /**
+   * @returns The length of the vector.
+   */
+  uint64_t getLength();
+
+  /**
+   * @returns A pointer to the unique values of the vector in the parent matrix.
+   */
+  T *getValues();
+
+  /**
+   * @returns A pointer to the counts of the vector in the parent matrix.
+   */
+  indexT *getCounts();
+
+  /**
+   * @returns A pointer to the indices of the vector in the parent matrix.
+   */
+  indexT *getIndices();
+
+  /**
+   * @returns The number of unique values in the vector.
+   */
+  indexT uniqueVals();
+
+  /**
+   * @returns The index of the vector in the parent matrix.
+   */
+  uint64_t vectorIndex();
+
+  /**
+   * @returns The parent matrix of the view.
+   */
+  IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &getMatrix();
+
+  ///@}
+
+  //* Utility Methods *//
+  /** @name Utility Methods
+   */
+  ///@{
+
+  /**
+   * Prints the vector dense to the console.
+   */
+  void print();
+
+  ///@}
+
+  //* Calculations *//
+  /** @name Calculation Methods
+   */
+  ///@{
+
+  /**
+   * @returns The norm of the vector.
+   */
+  double norm();
+
+  /**
+   * @returns The sum of the vector.
+   */
+  T sum();
+
+  /**
+   * @returns The dot product of the vector and an Eigen Dense Vector.
+   */
+  double dot(Eigen::Vector<T, -1> &other);
+
+  /**
+   * @returns The dot product of the vector and an Eigen Sparse Vector.
+   */
+  double dot(Eigen::SparseVector<T> &other);
+
+  ///@}
+
+  //* Operator Overloads *//
+
+  // coefficient access
+  T operator[](uint64_t index);
+
+};  // class VectorView
+
+}  // namespace IVSparse
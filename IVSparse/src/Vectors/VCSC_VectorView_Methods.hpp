@@ -0,0 +1,197 @@
+/**
+ * @file VCSC_VectorView_Methods.hpp
+ * @author Skyler Ruiter and Seth Wolfgang
+ * @brief Vector View Methods for VCSC Sparse Matrices
+ * @version 0.1
+ * @date 2023-07-03
+ */
+
+#pragma once
+
+namespace IVSparse {
+
+//* Constructors *//
+
+// IVSparse Matrix Constructor
+template <typename T, typename indexT, bool columnMajor>
+SparseMatrix<T, indexT, 2, columnMajor>::VectorView::VectorView(
+    IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint64_t vec) {
+
+  #ifdef IVSPARSE_DEBUG
+  assert((vec < mat.outerSize()) && "Vector index out of bounds");
+  #endif
+
+  matrix = &mat;
+  this->vec = vec;
+  length = mat.innerSize();
+  nnz = mat.getNumIndices(vec);
+}
+
+//* Getters *//
+
+// Get the coefficient at the given index, using the parent's lookup table if it has one
+template <typename T, typename indexT, bool columnMajor>
+T SparseMatrix<T, indexT, 2, columnMajor>::VectorView::coeff(uint64_t index) {
+
+  #ifdef IVSPARSE_DEBUG
+  assert(index < length && "The index is out of bounds");
+  #endif
+
+  if constexpr (columnMajor) { return matrix->coeff(index, vec); }
+  else { return matrix->coeff(vec, index); }
+}
+
+// Get the size of the vector in bytes
+template <typename T, typename indexT, bool columnMajor>
+size_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::byteSize() {
+  return (sizeof(T) + sizeof(indexT)) * uniqueVals() + sizeof(indexT) * nnz;
+}
+
+// Get the inner size of the vector
+template <typename T, typename indexT, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::innerSize() {
+  return length;
+}
+
+// Get the outer size of the vector
+template <typename T, typename indexT, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::outerSize() {
+  return 1;
+}
+
+// Get the number of non-zero elements in the vector
+template <typename T, typename indexT, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::nonZeros() {
+  return nnz;
+}
+
+// Get the length of the vector
+template <typename T, typename indexT, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::getLength() {
+  return length;
+}
+
+// Get a pointer to the values of the vector
+template <typename T, typename indexT, bool columnMajor>
+T *SparseMatrix<T, indexT, 2, columnMajor>::VectorView::getValues() {
+  return matrix->getValues(vec);
+}
+
+// Get a pointer to the counts of the vector
+template <typename T, typename indexT, bool columnMajor>
+indexT *SparseMatrix<T, indexT, 2, columnMajor>::VectorView::getCounts() {
+  return matrix->getCounts(vec);
+}
+
+// Get a pointer to the indices of the vector
+template <typename T, typename indexT, bool columnMajor>
+indexT *SparseMatrix<T, indexT, 2, columnMajor>::VectorView::getIndices() {
+  return matrix->getIndices(vec);
+}
+
+// Get the number of unique values in the vector
+template <typename T, typename indexT, bool columnMajor>
+indexT SparseMatrix<T, indexT, 2, columnMajor>::VectorView::uniqueVals() {
+  return matrix->getNumUniqueVals(vec);
+}
+
+// Get the index of the vector in the parent matrix
+template <typename T, typename indexT, bool columnMajor>
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::VectorView::vectorIndex() {
+  return vec;
+}
+
+// Get the parent matrix
+template <typename T, typename indexT, bool columnMajor>
+IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &SparseMatrix<T, indexT, 2, columnMajor>::VectorView::getMatrix() {
+  return *matrix;
+}
+
+//* Utility Methods *//
+
+// Print the vector to console
+template <typename T, typename indexT, bool columnMajor>
+void SparseMatrix<T, indexT, 2, columnMajor>::VectorView::print() {
+  // if length is larger than 100 then print then don't print
+  if (length > 100) {
+    std::cout << "Vector is too large to print" << std::endl;
+    return;
+  }
+
+  std::cout << "Vector: ";
+  std::cout << std::endl;
+
+  // print a dense vector
+  for (uint64_t i = 0; i < length; i++) {
+    std::cout << coeff(i) << " ";
+  }
+
+  std::cout << std::endl;
+}
+
+//* Calculation Methods *//
+
+// Calculate the norm of the vector from the unique values and their counts
+template <typename T, typename indexT, bool columnMajor>
+inline double SparseMatrix<T, indexT, 2, columnMajor>::VectorView::norm() {
+  T *values = getValues();
+  indexT *counts = getCounts();
+
+  double norm = 0;
+  for (indexT j = 0; j < uniqueVals(); j++) {
+    norm += (double)values[j] * values[j] * counts[j];
+  }
+  return sqrt(norm);
+}
+
+// Calculate the sum of the vector from the unique values and their counts
+template <typename T, typename indexT, bool columnMajor>
+inline T SparseMatrix<T, indexT, 2, columnMajor>::VectorView::sum() {
+  T *values = getValues();
+  indexT *counts = getCounts();
+
+  T sum = 0;
+  for (indexT j = 0; j < uniqueVals(); j++) {
+    sum += values[j] * counts[j];
+  }
+  return sum;
+}
+
+// Calculate the dot product with an Eigen dense vector, each run is summed before its value is applied
+template <typename T, typename indexT, bool columnMajor>
+double SparseMatrix<T, indexT, 2, columnMajor>::VectorView::dot(Eigen::Vector<T, -1> &other) {
+  const IVSparse::RunKernels<T, indexT> kernels(length);
+
+  T *values = getValues();
+  indexT *counts = getCounts();
+  indexT *index = getIndices();
+
+  double dot = 0;
+  for (indexT j = 0; j < uniqueVals(); j++) {
+    dot += values[j] * kernels.gatherSum(other.data(), index, counts[j]);
+    index += counts[j];
+  }
+  return dot;
+}
+
+// Calculate the dot product with an Eigen sparse vector
+template <typename T, typename indexT, bool columnMajor>
+double SparseMatrix<T, indexT, 2, columnMajor>::VectorView::dot(Eigen::SparseVector<T> &other) {
+  double dot = 0;
+
+  for (typename SparseMatrix<T, indexT, 2, columnMajor>::InnerIterator it(*this); it; ++it) {
+    dot += it.value() * other.coeff(it.getIndex());
+  }
+
+  return dot;
+}
+
+//* Operator Overloads *//
+
+// coefficient access operator
+template <typename T, typename indexT, bool columnMajor>
+T SparseMatrix<T, indexT, 2, columnMajor>::VectorView::operator[](uint64_t index) {
+  return coeff(index);
+}
+
+}  // namespace IVSparse
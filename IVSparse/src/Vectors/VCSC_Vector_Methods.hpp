@@ -20,7 +20,7 @@ SparseMatrix<T, indexT, 2, columnMajor>::Vector::~Vector() {
 // IVSparse Matrix Constructor
 template <typename T, typename indexT, bool columnMajor>
 SparseMatrix<T, indexT, 2, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint32_t vec) {
+    IVSparse::SparseMatrix<T, indexT, 2, columnMajor> &mat, uint64_t vec) {
   
   #ifdef IVSPARSE_DEBUG
   // make sure the vector is in bounds
@@ -30,19 +30,19 @@ SparseMatrix<T, indexT, 2, columnMajor>::Vector::Vector(
   assert((mat.outerSize() > 0 && mat.innerSize() > 0) && "Matrix is empty");
   #endif
 
+  length = mat.innerSize();
+  nnz = mat.getNumIndices(vec);
+
   // check if the vector is empty
   if (mat.getNumUniqueVals(vec) == 0) {
     size = 0;
-    length = mat.innerSize();
     return;
   }
 
-  length = mat.innerSize();
-  nnz = mat.getNumIndices(vec);
-
-
-  // copy the data[vec] to the vector
-  data = mat.getMap(vec);
+  // copy the vector out of the matrix arrays
+  values.assign(mat.getValues(vec), mat.getValues(vec) + mat.getNumUniqueVals(vec));
+  counts.assign(mat.getCounts(vec), mat.getCounts(vec) + mat.getNumUniqueVals(vec));
+  indices.assign(mat.getIndices(vec), mat.getIndices(vec) + nnz);
 
   calculateCompSize();
 }
@@ -50,7 +50,7 @@ SparseMatrix<T, indexT, 2, columnMajor>::Vector::Vector(
 // Deep copy constructor
 template <typename T, typename indexT, bool columnMajor>
 SparseMatrix<T, indexT, 2, columnMajor>::Vector::Vector(
-    IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector &vec) {
+    const IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector &vec) {
   
   // set the variables
   length = vec.length;
@@ -63,7 +63,9 @@ SparseMatrix<T, indexT, 2, columnMajor>::Vector::Vector(
   }
 
   // copy the data
-  data = vec.data;
+  values = vec.values;
+  counts = vec.counts;
+  indices = vec.indices;
 
   // user checks
   #ifdef IVSPARSE_DEBUG
@@ -89,11 +91,9 @@ template <typename T, typename indexT, bool columnMajor>
 void SparseMatrix<T, indexT, 2, columnMajor>::Vector::calculateCompSize() {
   size = 0;
 
-  size += sizeof(T) * data.size();       // values
-  size += sizeof(indexT) * data.size();  // counts
-  for (auto j = 0; j < data.size(); j++) {
-    size += sizeof(indexT) * data[j].size();  // indices
-  }
+  size += sizeof(T) * values.size();        // values
+  size += sizeof(indexT) * counts.size();   // counts
+  size += sizeof(indexT) * indices.size();  // indices
   size += sizeof(indexT);  // len
 }
 
@@ -101,19 +101,19 @@ void SparseMatrix<T, indexT, 2, columnMajor>::Vector::calculateCompSize() {
 
 // Get the inner size of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::innerSize() {
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::innerSize() {
   return length;
 }
 
 // Get the outer size of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::outerSize() {
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::outerSize() {
   return 1;
 }
 
 // Get the number of non-zero elements in the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::nonZeros() {
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::nonZeros() {
   return nnz;
 }
 
@@ -125,7 +125,7 @@ size_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::byteSize() {
 
 // Get the value at the given index
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 2, columnMajor>::Vector::coeff(uint32_t index) {
+T SparseMatrix<T, indexT, 2, columnMajor>::Vector::coeff(uint64_t index) {
   
   #ifdef IVSPARSE_DEBUG
     // check if the index is out of bounds
@@ -137,57 +137,45 @@ T SparseMatrix<T, indexT, 2, columnMajor>::Vector::coeff(uint32_t index) {
 
 // Get the length of the vector
 template <typename T, typename indexT, bool columnMajor>
-uint32_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::getLength() {
+uint64_t SparseMatrix<T, indexT, 2, columnMajor>::Vector::getLength() {
   return length;
 }
 
 // Get a pointer to the values of the vector
 template <typename T, typename indexT, bool columnMajor>
-std::vector<T> SparseMatrix<T, indexT, 2, columnMajor>::Vector::getValues() {
-  std::vector<T> temp(length);
-
-  for (auto& i : data) {
-    temp.push_back(i.value);
-  }
-
-  return temp;
+T *SparseMatrix<T, indexT, 2, columnMajor>::Vector::getValues() {
+  return values.data();
 }
 
 // Get a pointer to the counts of the vector
 template <typename T, typename indexT, bool columnMajor>
-std::vector<indexT> SparseMatrix<T, indexT, 2, columnMajor>::Vector::getCounts() {
-  std::vector<indexT> temp(length);
-
-  for (auto& [key, value] : data) {
-    temp.push_back(value.size());
-  }
-
-  return temp;
+indexT *SparseMatrix<T, indexT, 2, columnMajor>::Vector::getCounts() {
+  return counts.data();
 }
 
 // Get a pointer to the indices of the vector
 template <typename T, typename indexT, bool columnMajor>
-std::vector<indexT> SparseMatrix<T, indexT, 2, columnMajor>::Vector::getIndices() {
-  std::vector<indexT> temp(nnz);
-
-  for (auto& [key, value] : data) {
-    for (auto& i : value) {
-      temp.push_back(i);
-    }
-  }
-
-  return temp;
+indexT *SparseMatrix<T, indexT, 2, columnMajor>::Vector::getIndices() {
+  return indices.data();
 }
 
 // Get the number of unique values in the vector
 template <typename T, typename indexT, bool columnMajor>
 indexT SparseMatrix<T, indexT, 2, columnMajor>::Vector::uniqueVals() {
-  return data.size();
+  return values.size();
 }
 
-// returns the innner map
+// returns the vector as a map of values to their indices
 template <typename T, typename indexT, bool columnMajor>
 std::map<T, std::vector<indexT>> SparseMatrix<T, indexT, 2, columnMajor>::Vector::getData() {
+  std::map<T, std::vector<indexT>> data;
+
+  indexT *index = indices.data();
+  for (size_t j = 0; j < values.size(); j++) {
+    data[values[j]].insert(data[values[j]].end(), index, index + counts[j]);
+    index += counts[j];
+  }
+
   return data;
 }
 
@@ -206,7 +194,7 @@ void SparseMatrix<T, indexT, 2, columnMajor>::Vector::print() {
   std::cout << std::endl;
 
   // print a dense vector
-  for (uint32_t i = 0; i < length; i++) {
+  for (uint64_t i = 0; i < length; i++) {
     std::cout << (*this)[i] << " ";
   }
 
@@ -281,13 +269,15 @@ SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator=(typename SparseMatrix
   nnz = other.nnz;
   indexWidth = other.indexWidth;
 
+  // copy the data
+  values = other.values;
+  counts = other.counts;
+  indices = other.indices;
+
   if (size == 0) {
     return *this;
   }
 
-  // copy the data
-  data = other.data;
-
   // user checks
   #ifdef IVSPARSE_DEBUG
   userChecks();
@@ -313,7 +303,7 @@ bool SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator==(
   }
 
   // check if the values are the same
-  if (data != other.data) {
+  if (values != other.values || counts != other.counts || indices != other.indices) {
     return false;
   }
 
@@ -330,7 +320,7 @@ bool SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator!=(
 
 // coefficient access operator
 template <typename T, typename indexT, bool columnMajor>
-T SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator[](uint32_t index) {
+T SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator[](uint64_t index) {
   
   #ifdef IVSPARSE_DEBUG
   // check if the index is out of bounds
@@ -355,11 +345,9 @@ T SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator[](uint32_t index) {
 // Scalar multiplication operator
 template <typename T, typename indexT, bool columnMajor>
 void SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator*=(T scalar) {
-  std::map<T, std::vector<indexT>> newValues;
-  for (const auto& [key, value] : data) {
-    newValues[key * scalar] = value;
+  for (auto &value : values) {
+    value *= scalar;
   }
-  data = newValues;
 }
 
 // Scalar multiplication operator (returns a new vector)
@@ -368,12 +356,7 @@ typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector
 SparseMatrix<T, indexT, 2, columnMajor>::Vector::operator*(T scalar) {
   
   typename IVSparse::SparseMatrix<T, indexT, 2, columnMajor>::Vector newVector(*this);
-
-  std::map<T, std::vector<indexT>> newValues;
-  for (const auto &[key, value] : newVector.data) {
-    newValues[key * scalar] = value;
-  }
-  newVector.data = newValues;
+  newVector *= scalar;
 
   return newVector;
 }
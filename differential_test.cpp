@@ -0,0 +1,1305 @@
+#include <iostream>
+#include <set>
+#include "IVSparse/SparseMatrix"
+#include "misc/matrix_creator.cpp"
+
+// Checks every level against Eigen on the same input
+//  g++ -std=c++17 -fopenmp -I/usr/include/eigen3 differential_test.cpp; ./a.out
+
+#define DATA_TYPE int
+#define INDEX_TYPE int
+
+void statsTest();
+void extremesTest();
+void lookupTest();
+void gatherTest();
+void cscTransposeTest();
+void rowMajorTest();
+void vcscLayoutTest();
+void simdTest();
+void vectorViewTest();
+void assemblyTest();
+void appendTest();
+void transposeTest();
+void denseTest();
+void uncompressedTest();
+void metadataTest();
+void mixedPrecisionTest();
+void runIteratorTest();
+void histogramTest();
+void estimateTest();
+void hybridTest();
+void patternTest();
+void dictionaryTest();
+void packedTest();
+void seekTest();
+void indexSetTest();
+void reorderTest();
+
+// dense copy of any matrix with an InnerIterator
+template <typename SpMat>
+Eigen::Matrix<double, -1, -1> toDense(SpMat& mat, bool columnMajor = true) {
+    Eigen::Matrix<double, -1, -1> dense = Eigen::Matrix<double, -1, -1>::Zero(mat.rows(), mat.cols());
+    for (uint64_t i = 0; i < mat.outerSize(); i++) {
+        for (typename SpMat::InnerIterator it(mat, i); it; ++it) {
+            if (columnMajor) { dense(it.getIndex(), i) = it.value(); }
+            else { dense(i, it.getIndex()) = it.value(); }
+        }
+    }
+    return dense;
+}
+
+// summary statistics of the columns (rows when byRow) of a dense matrix
+void checkStats(IVSparse::SummaryStats stats, Eigen::Matrix<double, -1, -1> dense, bool byRow) {
+    if (byRow) { dense.transposeInPlace(); }
+    double n = dense.rows();
+
+    for (int j = 0; j < dense.cols(); j++) {
+        double sum = dense.col(j).sum();
+        double mean = sum / n;
+        double variance = (dense.col(j).array() - mean).square().sum() / (n - 1);
+
+        assert(stats.nnz[j] == (uint64_t)(dense.col(j).array() != 0).count());
+        assert(std::abs(stats.sum[j] - sum) < 1e-9);
+        assert(std::abs(stats.sumSq[j] - dense.col(j).squaredNorm()) < 1e-9);
+        assert(std::abs(stats.mean[j] - mean) < 1e-9);
+        assert(std::abs(stats.variance[j] - variance) < 1e-9);
+        assert(std::abs(stats.dispersion[j] - (mean == 0 ? 0 : variance / mean)) < 1e-9);
+    }
+}
+
+// products, sums and norms of a column major matrix against the Eigen matrix it was built from
+template <typename SpMat>
+void checkAgainstEigen(SpMat& mat, Eigen::SparseMatrix<DATA_TYPE>& eigen) {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    assert(mat.rows() == (uint64_t)eigen.rows() && mat.cols() == (uint64_t)eigen.cols());
+    assert(mat.nonZeros() == (uint64_t)eigen.nonZeros());
+    assert(toDense(mat) == dense.cast<double>());
+
+    Eigen::Matrix<DATA_TYPE, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = i % 5 - 2; }
+    Eigen::Matrix<DATA_TYPE, -1, 1> spmv = mat * x;
+    assert(spmv == dense * x);
+
+    Eigen::Matrix<DATA_TYPE, -1, -1> X(eigen.cols(), 3);
+    for (int i = 0; i < X.size(); i++) { X(i) = i % 7 - 3; }
+    Eigen::Matrix<DATA_TYPE, -1, -1> spmm = mat * X;
+    assert(spmm == dense * X);
+
+    assert(mat.sum() == dense.sum());
+    assert(std::abs(mat.norm() - dense.cast<double>().norm()) < 1e-9 * (1 + dense.cast<double>().norm()));
+
+    std::vector<DATA_TYPE> outer = mat.outerSum();
+    std::vector<DATA_TYPE> inner = mat.innerSum();
+    for (int j = 0; j < dense.cols(); j++) { assert(outer[j] == dense.col(j).sum()); }
+    for (int i = 0; i < dense.rows(); i++) { assert(inner[i] == dense.row(i).sum()); }
+}
+
+int main() {
+
+    statsTest();
+    extremesTest();
+    lookupTest();
+    gatherTest();
+    cscTransposeTest();
+    rowMajorTest();
+    vcscLayoutTest();
+    simdTest();
+    vectorViewTest();
+    assemblyTest();
+    appendTest();
+    transposeTest();
+    denseTest();
+    uncompressedTest();
+    metadataTest();
+    mixedPrecisionTest();
+    runIteratorTest();
+    histogramTest();
+    estimateTest();
+    hybridTest();
+    patternTest();
+    dictionaryTest();
+    packedTest();
+    seekTest();
+    indexSetTest();
+    reorderTest();
+
+    std::cout << "All differential tests passed" << std::endl;
+    return 0;
+}
+
+void statsTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(90, 40, 3, 8, 6);
+    eigen.coeffRef(4, 2) = -3;
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<double, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>();
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3, false> ivcscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2, false> vcscRow(eigenRow);
+
+    checkStats(csc.columnStats(), dense, false);
+    checkStats(csc.rowStats(), dense, true);
+    checkStats(vcsc.columnStats(), dense, false);
+    checkStats(vcsc.rowStats(), dense, true);
+    checkStats(ivcsc.columnStats(), dense, false);
+    checkStats(ivcsc.rowStats(), dense, true);
+    checkStats(ivcscRow.columnStats(), dense, false);
+    checkStats(ivcscRow.rowStats(), dense, true);
+    checkStats(vcscRow.columnStats(), dense, false);
+    checkStats(vcscRow.rowStats(), dense, true);
+
+    // a large mean with a small spread keeps its variance
+    Eigen::Matrix<DATA_TYPE, -1, -1> offset(600, 8);
+    for (int i = 0; i < offset.size(); i++) { offset(i) = 100000000 + (i * 7) % 3; }
+    Eigen::SparseMatrix<DATA_TYPE> eigenOffset = offset.sparseView();
+    Eigen::Matrix<double, -1, -1> centered = offset.cast<double>().array() - 100000000;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscOffset(eigenOffset);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcscOffset(eigenOffset);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcscOffset(eigenOffset);
+    for (IVSparse::SummaryStats stats : {cscOffset.columnStats(), vcscOffset.columnStats(), ivcscOffset.columnStats()}) {
+        for (int j = 0; j < centered.cols(); j++) {
+            double variance = (centered.col(j).array() - centered.col(j).mean()).square().sum() / (centered.rows() - 1);
+            assert(std::abs(stats.variance[j] - variance) < 1e-6 * variance);
+        }
+    }
+    for (IVSparse::SummaryStats stats : {cscOffset.rowStats(), vcscOffset.rowStats(), ivcscOffset.rowStats()}) {
+        for (int i = 0; i < centered.rows(); i++) {
+            double variance = (centered.row(i).array() - centered.row(i).mean()).square().sum() / (centered.cols() - 1);
+            assert(std::abs(stats.variance[i] - variance) < 1e-6 * (1 + variance));
+        }
+    }
+}
+
+// min and max of every column and row with their first index, counting the implicit zeros
+template <typename SpMat>
+void checkExtremes(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    std::vector<uint64_t> maxColArg, minColArg, maxRowArg, minRowArg;
+    std::vector<DATA_TYPE> maxCol = mat.maxColCoeff(maxColArg), minCol = mat.minColCoeff(minColArg);
+    std::vector<DATA_TYPE> maxRow = mat.maxRowCoeff(maxRowArg), minRow = mat.minRowCoeff(minRowArg);
+    assert(mat.maxColCoeff() == maxCol && mat.minColCoeff() == minCol);
+    assert(mat.maxRowCoeff() == maxRow && mat.minRowCoeff() == minRow);
+
+    for (int j = 0; j < dense.cols(); j++) {
+        Eigen::Index maxIndex, minIndex;
+        assert(maxCol[j] == dense.col(j).maxCoeff(&maxIndex) && maxColArg[j] == (uint64_t)maxIndex);
+        assert(minCol[j] == dense.col(j).minCoeff(&minIndex) && minColArg[j] == (uint64_t)minIndex);
+    }
+    for (int i = 0; i < dense.rows(); i++) {
+        Eigen::Index maxIndex, minIndex;
+        assert(maxRow[i] == dense.row(i).maxCoeff(&maxIndex) && maxRowArg[i] == (uint64_t)maxIndex);
+        assert(minRow[i] == dense.row(i).minCoeff(&minIndex) && minRowArg[i] == (uint64_t)minIndex);
+    }
+}
+
+void extremesTest() {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(generateMatrix<DATA_TYPE>(70, 35, 3, 17, 6));
+
+    // full positive and full negative vectors have no implicit zero to fall back on
+    for (int i = 0; i < dense.rows(); i++) { dense(i, 0) = i % 4 + 2; dense(i, 1) = -(i % 3) - 1; }
+    for (int j = 0; j < dense.cols(); j++) { dense(5, j) = j % 2 + 3; }
+    for (int i = 0; i < dense.rows(); i += 9) { dense(i, 7) = -4; }
+
+    Eigen::SparseMatrix<DATA_TYPE> eigen = dense.sparseView();
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1, false> cscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2, false> vcscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3, false> ivcscRow(eigenRow);
+
+    checkExtremes(csc, dense);
+    checkExtremes(vcsc, dense);
+    checkExtremes(ivcsc, dense);
+    checkExtremes(cscRow, dense);
+    checkExtremes(vcscRow, dense);
+    checkExtremes(ivcscRow, dense);
+}
+
+// every coefficient read through coeff() and operator() with the lookup table off, lazy and eager
+template <typename SpMat>
+void checkLookup(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    auto checkAll = [&]() {
+        for (int j = 0; j < dense.cols(); j++) {
+            for (int i = 0; i < dense.rows(); i++) { assert(mat.coeff(i, j) == dense(i, j) && mat(i, j) == dense(i, j)); }
+        }
+    };
+
+    checkAll();
+    assert(mat.lookupTableSize() == 0);
+
+    mat.buildLookupTable(true);
+    checkAll();
+
+    mat.dropLookupTable();
+    assert(mat.lookupTableSize() == 0);
+
+    size_t bytes = mat.byteSize();
+    mat.buildLookupTable();
+    assert(mat.lookupTableSize() > 0 && mat.byteSize() == bytes);
+    checkAll();
+    mat.dropLookupTable();
+}
+
+void lookupTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(300, 20, 4, 3, 5);
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2, false> vcscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3, false> ivcscRow(eigenRow);
+
+    checkLookup(vcsc, dense);
+    checkLookup(ivcsc, dense);
+    checkLookup(vcscRow, dense);
+    checkLookup(ivcscRow, dense);
+}
+
+// batched lookups in a scrambled query order, with repeats, through both gather() overloads
+template <typename SpMat>
+void checkGather(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    std::vector<uint64_t> rows, cols;
+    for (uint64_t q = 0; q < 2000; q++) {
+        rows.push_back((q * 7919) % dense.rows());
+        cols.push_back((q * 104729 + q / 3) % dense.cols());
+    }
+
+    std::vector<DATA_TYPE> out = mat.gather(rows, cols);
+    std::vector<DATA_TYPE> outPtr(rows.size());
+    mat.gather(rows.data(), cols.data(), outPtr.data(), rows.size());
+
+    for (size_t q = 0; q < rows.size(); q++) {
+        assert(out[q] == dense(rows[q], cols[q]));
+        assert(outPtr[q] == out[q]);
+    }
+}
+
+void gatherTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(120, 45, 3, 31, 8);
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1, false> cscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3, false> ivcscRow(eigenRow);
+
+    checkGather(csc, dense);
+    checkGather(vcsc, dense);
+    checkGather(ivcsc, dense);
+    checkGather(cscRow, dense);
+    checkGather(ivcscRow, dense);
+
+    // the lookup table path
+    vcsc.buildLookupTable();
+    ivcsc.buildLookupTable(true);
+    checkGather(vcsc, dense);
+    checkGather(ivcsc, dense);
+}
+
+void cscTransposeTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(60, 40, 5, 11, 9);
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<double, -1, -1> expected = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>().transpose();
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscT = csc.transpose();
+    assert(cscT.rows() == 40 && cscT.cols() == 60);
+    assert(toDense(cscT) == expected);
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1, false> cscRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1, false> cscRowT = cscRow.transpose();
+    assert(toDense(cscRowT, false) == expected);
+
+    // an all-zero matrix transposes to an all-zero matrix of the swapped shape
+    Eigen::SparseMatrix<DATA_TYPE> empty(7, 5);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscEmpty(empty);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscEmptyT = cscEmpty.transpose();
+    assert(cscEmptyT.rows() == 5 && cscEmptyT.cols() == 7);
+    assert(cscEmptyT.nonZeros() == 0);
+    assert(cscEmptyT.toEigen().nonZeros() == 0);
+
+    cscEmpty.inPlaceTranspose();
+    assert(cscEmpty.rows() == 5 && cscEmpty.cols() == 7);
+}
+
+template <uint8_t level>
+void rowMajorCheck(Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor>& eigen) {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level, false> mat(eigen);
+    assert(mat.outerSize() == (uint64_t)eigen.rows());
+    assert(toDense(mat, false) == dense.cast<double>());
+
+    Eigen::Matrix<DATA_TYPE, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = i % 5 - 2; }
+    Eigen::Matrix<DATA_TYPE, -1, 1> spmv = mat * x;
+    assert(spmv == dense * x);
+
+    Eigen::Matrix<DATA_TYPE, -1, -1> X(eigen.cols(), 3);
+    for (int i = 0; i < X.size(); i++) { X(i) = i % 7 - 3; }
+    Eigen::Matrix<DATA_TYPE, -1, -1> spmm = mat * X;
+    assert(spmm == dense * X);
+
+    // outer sums are over rows and inner sums over columns
+    assert(mat.sum() == dense.sum());
+    std::vector<DATA_TYPE> outer = mat.outerSum();
+    std::vector<DATA_TYPE> inner = mat.innerSum();
+    for (int i = 0; i < dense.rows(); i++) { assert(outer[i] == dense.row(i).sum()); }
+    for (int j = 0; j < dense.cols(); j++) { assert(inner[j] == dense.col(j).sum()); }
+}
+
+void rowMajorTest() {
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigen = generateMatrix<DATA_TYPE>(55, 80, 4, 151, 7);
+    rowMajorCheck<1>(eigen);
+    rowMajorCheck<2>(eigen);
+    rowMajorCheck<3>(eigen);
+}
+
+void vcscLayoutTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(80, 30, 3, 41, 5);
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    checkAgainstEigen(vcsc, eigen);
+
+    // copies compare equal and own their arrays
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> copy = vcsc;
+    assert(copy == vcsc);
+    copy *= 2;
+    assert(copy != vcsc && copy.sum() == 2 * vcsc.sum());
+
+    // the COO constructor goes through the same flat arrays
+    std::vector<std::tuple<INDEX_TYPE, INDEX_TYPE, DATA_TYPE>> coo;
+    for (int j = dense.cols() - 1; j >= 0; j--) {
+        for (int i = 0; i < dense.rows(); i++) { if (dense(i, j) != 0) { coo.emplace_back(i, j, dense(i, j)); } }
+    }
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> fromCoo(coo, dense.rows(), dense.cols(), coo.size());
+    assert(toDense(fromCoo) == dense.cast<double>());
+
+    // slices keep their vectors, appends (including to itself) put them back
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> left = vcsc.slice(0, 12);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> right = vcsc.slice(12, 30);
+    assert(toDense(left) == dense.leftCols(12).cast<double>());
+    assert(toDense(right) == dense.rightCols(18).cast<double>());
+
+    left.append(right);
+    assert(toDense(left) == dense.cast<double>());
+
+    left.append(left);
+    Eigen::Matrix<DATA_TYPE, -1, -1> doubled(dense.rows(), 2 * dense.cols());
+    doubled << dense, dense;
+    assert(toDense(left) == doubled.cast<double>());
+}
+
+// VCSC SpMV and innerSum in both storage orders for each value type the run kernels vectorize
+template <typename T>
+void simdCheck() {
+    // few values over many rows makes long runs of indices
+    Eigen::SparseMatrix<T> eigen = generateMatrix<T>(2000, 64, 2, 13, 3);
+    Eigen::SparseMatrix<T, Eigen::RowMajor> eigenRow = eigen;
+    IVSparse::SparseMatrix<T, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<T, INDEX_TYPE, 2, false> vcscRow(eigenRow);
+
+    Eigen::Matrix<T, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = (T)(i % 9) - 4; }
+    Eigen::Matrix<T, -1, 1> expected = eigen * x;
+
+    Eigen::Matrix<T, -1, 1> col = vcsc * x;
+    Eigen::Matrix<T, -1, 1> row = vcscRow * x;
+    assert((col - expected).cwiseAbs().maxCoeff() <= 1e-3 * (1 + expected.cwiseAbs().maxCoeff()));
+    assert((row - expected).cwiseAbs().maxCoeff() <= 1e-3 * (1 + expected.cwiseAbs().maxCoeff()));
+
+    std::vector<T> inner = vcsc.innerSum();
+    Eigen::Matrix<T, -1, 1> rowSums = Eigen::Matrix<T, -1, -1>(eigen).rowwise().sum();
+    for (int i = 0; i < rowSums.rows(); i++) { assert(std::abs(inner[i] - rowSums(i)) <= 1e-3 * (1 + std::abs(rowSums(i)))); }
+}
+
+void simdTest() {
+    simdCheck<int>();
+    simdCheck<float>();
+    simdCheck<double>();
+}
+
+// every view of a matrix against the matching column of the dense matrix
+template <typename SpMat>
+void checkViews(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    Eigen::Matrix<DATA_TYPE, -1, 1> other(dense.rows());
+    for (int i = 0; i < other.rows(); i++) { other(i) = i % 4 - 1; }
+    Eigen::SparseVector<DATA_TYPE> otherSparse = other.sparseView();
+
+    for (int j = 0; j < dense.cols(); j++) {
+        typename SpMat::VectorView view = mat.getVectorView(j);
+        assert(view.getLength() == (uint64_t)dense.rows() && view.vectorIndex() == (uint64_t)j);
+        assert(view.nonZeros() == (uint64_t)(dense.col(j).array() != 0).count());
+        assert(view.sum() == dense.col(j).sum());
+        assert(std::abs(view.norm() - dense.col(j).cast<double>().norm()) < 1e-9);
+        assert(view.dot(other) == dense.col(j).dot(other));
+        assert(view.dot(otherSparse) == dense.col(j).dot(other));
+
+        Eigen::Matrix<DATA_TYPE, -1, 1> fromIterator = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(dense.rows());
+        for (typename SpMat::InnerIterator it(view); it; ++it) { fromIterator(it.getIndex()) = it.value(); }
+        assert(fromIterator == dense.col(j));
+
+        for (int i = 0; i < dense.rows(); i++) { assert(view[i] == dense(i, j) && view.coeff(i) == dense(i, j)); }
+    }
+}
+
+void vectorViewTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(100, 25, 3, 51, 6);
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+
+    checkViews(csc, dense);
+    checkViews(vcsc, dense);
+    checkViews(ivcsc, dense);
+}
+
+// a matrix assembled from copies of its own vectors is the same matrix
+template <typename SpMat>
+void checkAssembly(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    std::vector<typename SpMat::Vector> vecs;
+    for (uint64_t j = 0; j < mat.cols(); j++) { vecs.push_back(mat.getVector(j)); }
+
+    SpMat assembled(vecs);
+    assert(assembled.rows() == mat.rows() && assembled.cols() == mat.cols());
+    assert(assembled.nonZeros() == mat.nonZeros());
+    assert(toDense(assembled) == dense.cast<double>());
+}
+
+void assemblyTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(70, 33, 3, 61, 6);
+
+    // keep an empty column in the middle
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    dense.col(10).setZero();
+    eigen = dense.sparseView();
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+
+    checkAssembly(csc, dense);
+    checkAssembly(vcsc, dense);
+    checkAssembly(ivcsc, dense);
+}
+
+void appendTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(60, 50, 3, 71, 6);
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+
+    // grow each level one column at a time
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscGrown = csc.slice(0, 1)[0];
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcscGrown = vcsc.slice(0, 1);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcscGrown = ivcsc.slice(0, 1);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcscMoved = ivcsc.slice(0, 1);
+    cscGrown.reserveOuter(20);
+    ivcscMoved.reserveOuter(dense.cols());
+
+    for (uint64_t j = 1; j < (uint64_t)dense.cols(); j++) {
+        typename IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1>::Vector column = csc.getVector(j);
+        cscGrown.append(column);
+
+        IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcscColumn = vcsc.slice(j, j + 1);
+        vcscGrown.append(vcscColumn);
+
+        IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcscColumn = ivcsc.slice(j, j + 1);
+        ivcscGrown.append(ivcscColumn);
+
+        ivcscMoved.appendMove(ivcscColumn);
+        assert(ivcscColumn.cols() == 0);
+    }
+
+    assert(toDense(cscGrown) == dense.cast<double>());
+    assert(toDense(vcscGrown) == dense.cast<double>());
+    assert(toDense(ivcscGrown) == dense.cast<double>());
+    assert(toDense(ivcscMoved) == dense.cast<double>());
+
+    // the running sizes match a matrix built in one go
+    assert(cscGrown.nonZeros() == csc.nonZeros() && cscGrown.byteSize() == csc.byteSize());
+    assert(vcscGrown.nonZeros() == vcsc.nonZeros() && vcscGrown.byteSize() == vcsc.byteSize());
+    assert(ivcscGrown.nonZeros() == ivcsc.nonZeros() && ivcscGrown.byteSize() == ivcsc.byteSize());
+    assert(ivcscMoved.nonZeros() == ivcsc.nonZeros() && ivcscMoved.byteSize() == ivcsc.byteSize());
+
+    // appending an Eigen matrix matches Eigen's own concatenation
+    Eigen::Matrix<DATA_TYPE, -1, -1> doubled(dense.rows(), 2 * dense.cols());
+    doubled << dense, dense;
+    vcscGrown.append(eigen);
+    ivcscGrown.append(eigen);
+    assert(toDense(vcscGrown) == doubled.cast<double>());
+    assert(toDense(ivcscGrown) == doubled.cast<double>());
+}
+
+template <uint8_t level>
+void transposeCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen) {
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<double, -1, -1> expected = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>().transpose();
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> mat(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> matT = mat.transpose();
+    assert(matT.rows() == mat.cols() && matT.cols() == mat.rows());
+    assert(matT.nonZeros() == mat.nonZeros());
+    assert(toDense(matT) == expected);
+
+    // transposing twice gives back the original
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> matTT = matT.transpose();
+    assert(toDense(matTT) == toDense(mat));
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level, false> matRow(eigenRow);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level, false> matRowT = matRow.transpose();
+    assert(toDense(matRowT, false) == expected);
+
+    mat.inPlaceTranspose();
+    assert(mat.rows() == matT.rows() && mat.cols() == matT.cols());
+    assert(toDense(mat) == expected);
+}
+
+void transposeTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(70, 45, 4, 83, 5);
+    transposeCheck<2>(eigen);
+    transposeCheck<3>(eigen);
+
+    // a single repeated value exercises the run-length paths
+    Eigen::SparseMatrix<DATA_TYPE> runs = generateMatrix<DATA_TYPE>(90, 30, 2, 89, 1);
+    transposeCheck<2>(runs);
+    transposeCheck<3>(runs);
+}
+
+template <typename T, uint8_t level>
+void denseCheck(Eigen::Matrix<T, -1, -1>& dense, T epsilon) {
+    // entries with a magnitude of at most epsilon are dropped
+    Eigen::Matrix<double, -1, -1> expected = dense.template cast<double>();
+    for (int i = 0; i < expected.size(); i++) {
+        if (std::abs(dense(i)) <= epsilon) { expected(i) = 0; }
+    }
+    uint64_t nnz = (expected.array() != 0).count();
+
+    IVSparse::SparseMatrix<T, INDEX_TYPE, level> mat(dense, epsilon);
+    assert(mat.nonZeros() == nnz);
+    assert(toDense(mat) == expected);
+
+    Eigen::Matrix<T, -1, -1, Eigen::RowMajor> denseRow = dense;
+    IVSparse::SparseMatrix<T, INDEX_TYPE, level, false> matRow(denseRow, epsilon);
+    assert(matRow.nonZeros() == nnz);
+    assert(toDense(matRow, false) == expected);
+
+    // the same matrix as going through Eigen's sparse view
+    Eigen::SparseMatrix<T> view = expected.cast<T>().sparseView();
+    IVSparse::SparseMatrix<T, INDEX_TYPE, level> fromView(view);
+    assert(mat.byteSize() == fromView.byteSize());
+}
+
+template <typename T>
+void denseCheckType() {
+    // long enough columns to cover the vector scan and its scalar tail
+    Eigen::Matrix<T, -1, -1> dense = Eigen::Matrix<T, -1, -1>::Zero(67, 23);
+    for (int i = 0; i < dense.size(); i++) {
+        if (i % 3 == 0) { dense(i) = (T)((i % 11) - 5) / 4; }
+    }
+    dense(0, 0) = (T)-0.05;
+    dense(66, 22) = (T)0.05;
+
+    for (T epsilon : {(T)0, (T)0.1, (T)0.5}) {
+        denseCheck<T, 1>(dense, epsilon);
+        denseCheck<T, 2>(dense, epsilon);
+        denseCheck<T, 3>(dense, epsilon);
+    }
+}
+
+void denseTest() {
+    denseCheckType<float>();
+    denseCheckType<double>();
+
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(generateMatrix<DATA_TYPE>(40, 30, 3, 97, 7));
+    denseCheck<DATA_TYPE, 1>(dense, 0);
+    denseCheck<DATA_TYPE, 2>(dense, 0);
+    denseCheck<DATA_TYPE, 3>(dense, 0);
+}
+
+template <uint8_t level>
+void uncompressedCheck(const Eigen::SparseMatrix<DATA_TYPE>& eigen, const Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor>& eigenRow,
+                       Eigen::Matrix<double, -1, -1>& expected) {
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> mat(eigen);
+    assert(mat.nonZeros() == (uint64_t)eigen.nonZeros());
+    assert(toDense(mat) == expected);
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level, false> matRow(eigenRow);
+    assert(matRow.nonZeros() == (uint64_t)eigenRow.nonZeros());
+    assert(toDense(matRow, false) == expected);
+
+    // the same matrix as a compressed copy of the input
+    Eigen::SparseMatrix<DATA_TYPE> compressed = eigen;
+    compressed.makeCompressed();
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> fromCompressed(compressed);
+    assert(mat.byteSize() == fromCompressed.byteSize());
+}
+
+void uncompressedTest() {
+    // reserving room in every vector and inserting leaves gaps between the vectors
+    Eigen::SparseMatrix<DATA_TYPE> eigen(50, 35);
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow(50, 35);
+    eigen.reserve(Eigen::VectorXi::Constant(35, 12));
+    eigenRow.reserve(Eigen::VectorXi::Constant(50, 12));
+    for (int j = 0; j < 35; j++) {
+        for (int i = j % 4; i < 50; i += 3 + j % 5) {
+            eigen.insert(i, j) = (i * j) % 4 + 1;
+            eigenRow.insert(i, j) = (i * j) % 4 + 1;
+        }
+    }
+    assert(!eigen.isCompressed() && !eigenRow.isCompressed());
+    Eigen::Matrix<double, -1, -1> expected = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>();
+
+    uncompressedCheck<1>(eigen, eigenRow, expected);
+    uncompressedCheck<2>(eigen, eigenRow, expected);
+    uncompressedCheck<3>(eigen, eigenRow, expected);
+    uncompressedCheck<4>(eigen, eigenRow, expected);
+    uncompressedCheck<5>(eigen, eigenRow, expected);
+    uncompressedCheck<6>(eigen, eigenRow, expected);
+
+    // the caller's matrices are left as they were
+    assert(!eigen.isCompressed() && !eigenRow.isCompressed());
+}
+
+void metadataTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(50, 30, 4, 5, 7);
+    Eigen::Matrix<double, -1, -1> expected = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>();
+
+    // current header round trip on every level that writes files
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    csc.write("differential_csc.ivs");
+    vcsc.write("differential_vcsc.ivs");
+    ivcsc.write("differential_ivcsc.ivs");
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> cscRead("differential_csc.ivs");
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcscRead("differential_vcsc.ivs");
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcscRead("differential_ivcsc.ivs");
+    assert(toDense(cscRead) == expected);
+    assert(toDense(vcscRead) == expected);
+    assert(toDense(ivcscRead) == expected);
+
+    // a legacy CSC file has a header of six uint32_t
+    FILE* fp = fopen("differential_legacy.ivs", "wb");
+    uint32_t valueType = (1 << 24) | (1 << 16) | sizeof(DATA_TYPE);  // column major, signed, integral
+    uint32_t legacy[NUM_META_DATA] = {1, (uint32_t)eigen.innerSize(), (uint32_t)eigen.outerSize(),
+                                      (uint32_t)eigen.nonZeros(), valueType, sizeof(INDEX_TYPE)};
+    fwrite(legacy, sizeof(uint32_t), NUM_META_DATA, fp);
+    fwrite(eigen.valuePtr(), sizeof(DATA_TYPE), eigen.nonZeros(), fp);
+    fwrite(eigen.innerIndexPtr(), sizeof(INDEX_TYPE), eigen.nonZeros(), fp);
+    fwrite(eigen.outerIndexPtr(), sizeof(INDEX_TYPE), eigen.outerSize() + 1, fp);
+    fclose(fp);
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> legacyRead("differential_legacy.ivs");
+    assert(legacyRead.rows() == 50 && legacyRead.cols() == 30);
+    assert(toDense(legacyRead) == expected);
+
+    // a legacy header with a zero inner dimension is still read as legacy
+    uint32_t zeroInner[NUM_META_DATA] = {1, 0, 3, 0, 4, 4};
+    fp = fopen("differential_legacy.ivs", "wb");
+    fwrite(zeroInner, sizeof(uint32_t), NUM_META_DATA, fp);
+    fclose(fp);
+
+    uint64_t metadata[NUM_META_DATA];
+    fp = fopen("differential_legacy.ivs", "rb");
+    assert(IVSparse::readMetadata(fp, metadata));
+    fclose(fp);
+    for (int i = 0; i < NUM_META_DATA; i++) { assert(metadata[i] == zeroInner[i]); }
+
+    // a truncated header is rejected instead of read as garbage
+    fp = fopen("differential_legacy.ivs", "wb");
+    fwrite(zeroInner, sizeof(uint32_t), 2, fp);
+    fclose(fp);
+
+    bool rejected = false;
+    try { IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> truncated("differential_legacy.ivs"); }
+    catch (const std::runtime_error&) { rejected = true; }
+    assert(rejected);
+
+    remove("differential_csc.ivs");
+    remove("differential_vcsc.ivs");
+    remove("differential_ivcsc.ivs");
+    remove("differential_legacy.ivs");
+}
+
+template <uint8_t level>
+void mixedPrecisionCheck(Eigen::SparseMatrix<uint8_t>& eigen) {
+    Eigen::Matrix<double, -1, -1> dense = Eigen::Matrix<uint8_t, -1, -1>(eigen).cast<double>();
+    IVSparse::SparseMatrix<uint8_t, INDEX_TYPE, level> mat(eigen);
+
+    // double operands are multiplied without narrowing to the storage type
+    Eigen::Matrix<double, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = 0.25 * (i % 9) - 1; }
+    Eigen::Matrix<double, -1, 1> spmv = mat * x;
+    assert((spmv - dense * x).cwiseAbs().maxCoeff() < 1e-9);
+
+    Eigen::Matrix<float, -1, -1> X(eigen.cols(), 4);
+    for (int i = 0; i < X.size(); i++) { X(i) = 0.5f * (i % 7) - 1.5f; }
+    Eigen::Matrix<float, -1, -1> spmm = mat * X;
+    assert((spmm.cast<double>() - dense * X.cast<double>()).cwiseAbs().maxCoeff() < 1e-3);
+
+    // wide accumulators do not wrap around like the storage type would
+    assert(mat.template sum<uint64_t>() == (uint64_t)dense.sum());
+    std::vector<uint64_t> outer = mat.template outerSum<uint64_t>();
+    std::vector<uint64_t> inner = mat.template innerSum<uint64_t>();
+    for (int j = 0; j < dense.cols(); j++) { assert(outer[j] == (uint64_t)dense.col(j).sum()); }
+    for (int i = 0; i < dense.rows(); i++) { assert(inner[i] == (uint64_t)dense.row(i).sum()); }
+
+    assert(std::abs(mat.norm() - dense.norm()) < 1e-9 * dense.norm());
+    assert(std::abs(mat.template norm<float>() - dense.norm()) < 1e-4 * dense.norm());
+    for (int j = 0; j < dense.cols(); j++) {
+        assert(std::abs(mat.vectorLength(j) - dense.col(j).norm()) < 1e-9 * (1 + dense.col(j).norm()));
+    }
+}
+
+void mixedPrecisionTest() {
+    // values near the top of uint8_t overflow it as soon as two are added
+    Eigen::SparseMatrix<DATA_TYPE> values = generateMatrix<DATA_TYPE>(80, 40, 3, 101, 4);
+    Eigen::SparseMatrix<uint8_t> eigen = values.cast<uint8_t>();
+    for (int k = 0; k < eigen.outerSize(); k++) {
+        for (Eigen::SparseMatrix<uint8_t>::InnerIterator it(eigen, k); it; ++it) { it.valueRef() = 210 + it.value() * 10; }
+    }
+
+    mixedPrecisionCheck<1>(eigen);
+    mixedPrecisionCheck<2>(eigen);
+    mixedPrecisionCheck<3>(eigen);
+}
+
+// rebuilds one vector from its runs, checking each run is one unique value over ascending indices
+template <typename RunIt>
+Eigen::Matrix<double, -1, 1> denseFromRuns(RunIt it, uint64_t length) {
+    Eigen::Matrix<double, -1, 1> dense = Eigen::Matrix<double, -1, 1>::Zero(length);
+    std::vector<DATA_TYPE> seen;
+    for (; it; ++it) {
+        assert(std::find(seen.begin(), seen.end(), it.value()) == seen.end());
+        seen.push_back(it.value());
+
+        uint64_t count = 0;
+        int64_t last = -1;
+        it.forEachIndex([&](uint64_t index) {
+            assert((int64_t)index > last);
+            last = index;
+            dense(index) = it.value();
+            count++;
+        });
+        assert(count == it.runLength());
+    }
+    return dense;
+}
+
+template <uint8_t level>
+void runIteratorCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen) {
+    Eigen::Matrix<double, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>();
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> mat(eigen);
+    typedef typename IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level>::RunIterator RunIt;
+
+    for (uint64_t j = 0; j < mat.cols(); j++) {
+        assert(denseFromRuns(RunIt(mat, j), mat.rows()) == dense.col(j));
+
+        typename IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level>::Vector vec = mat.getVector(j);
+        assert(denseFromRuns(RunIt(vec), mat.rows()) == dense.col(j));
+
+        typename IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level>::VectorView view = mat.getVectorView(j);
+        assert(denseFromRuns(RunIt(view), mat.rows()) == dense.col(j));
+    }
+
+    // rewriting a run changes every entry holding that value
+    for (uint64_t j = 0; j < mat.cols(); j++) {
+        for (RunIt it(mat, j); it; ++it) {
+            if (it.value() == 2) { it.coeff(9); }
+        }
+    }
+    Eigen::Matrix<double, -1, -1> rewritten = (dense.array() == 2).select(9, dense);
+    assert(toDense(mat) == rewritten);
+}
+
+void runIteratorTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(90, 30, 2, 103, 4);
+    runIteratorCheck<2>(eigen);
+    runIteratorCheck<3>(eigen);
+
+    // VCSC hands out each run's sorted indices directly
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    for (uint64_t j = 0; j < vcsc.cols(); j++) {
+        for (IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2>::RunIterator it(vcsc, j); it; ++it) {
+            INDEX_TYPE* indices = it.getIndices();
+            uint64_t k = 0;
+            it.forEachIndex([&](uint64_t index) { assert((uint64_t)indices[k++] == index); });
+            assert(k == it.runLength());
+        }
+    }
+}
+
+template <typename SpMat>
+void histogramCheck(SpMat& mat, Eigen::Matrix<DATA_TYPE, -1, -1>& dense) {
+    std::map<DATA_TYPE, uint64_t> total;
+    double redundancy = 0;
+    uint64_t nonEmpty = 0;
+
+    for (int j = 0; j < dense.cols(); j++) {
+        std::map<DATA_TYPE, uint64_t> counts;
+        uint64_t nnz = 0;
+        for (int i = 0; i < dense.rows(); i++) {
+            if (dense(i, j) != 0) { counts[dense(i, j)]++; total[dense(i, j)]++; nnz++; }
+        }
+
+        std::vector<std::pair<DATA_TYPE, uint64_t>> histogram = mat.valueHistogram(j);
+        std::vector<std::pair<DATA_TYPE, uint64_t>> expected(counts.begin(), counts.end());
+        assert(histogram == expected);
+
+        if (nnz == 0) { continue; }
+        redundancy += counts.size() == 1 ? 1 : 1 - (double)counts.size() / nnz;
+        nonEmpty++;
+    }
+
+    double nnz = (dense.array() != 0).count();
+    double entropy = 0;
+    for (auto& entry : total) { entropy -= entry.second / nnz * std::log2(entry.second / nnz); }
+
+    assert(mat.uniqueValueCount() == total.size());
+    assert(std::abs(mat.redundancy() - redundancy / nonEmpty) < 1e-12);
+    assert(std::abs(mat.entropy() - entropy) < 1e-12);
+}
+
+void histogramTest() {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(generateMatrix<DATA_TYPE>(80, 40, 3, 107, 12));
+    // one single-valued column and one empty column
+    dense.col(3).setZero();
+    for (int i = 0; i < 80; i += 4) { dense(i, 3) = 7; }
+    dense.col(5).setZero();
+    Eigen::SparseMatrix<DATA_TYPE> eigen = dense.sparseView();
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    histogramCheck(csc, dense);
+    histogramCheck(vcsc, dense);
+    histogramCheck(ivcsc, dense);
+}
+
+void estimateCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen) {
+    Eigen::Matrix<double, -1, -1> dense = Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).cast<double>();
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 1> csc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+
+    // sampling every vector gives the exact sizes
+    IVSparse::SizeEstimate estimate = IVSparse::estimateSize<DATA_TYPE, INDEX_TYPE>(
+        eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(), eigen.cols(), eigen.nonZeros(), eigen.cols());
+    assert(estimate.sampledVectors == (uint64_t)eigen.cols());
+    assert(estimate.cscBytes == csc.byteSize());
+    assert(estimate.vcscBytes == vcsc.byteSize());
+    assert(estimate.ivcscBytes == ivcsc.byteSize());
+
+    // and pick the level that is actually smallest
+    uint8_t expectedLevel = 1;
+    if (vcsc.byteSize() < csc.byteSize()) { expectedLevel = 2; }
+    if (ivcsc.byteSize() < std::min(csc.byteSize(), vcsc.byteSize())) { expectedLevel = 3; }
+    assert(estimate.level == expectedLevel);
+
+    // the matrix built is the chosen level and holds the input
+    IVSparse::SizeEstimate used;
+    IVSparse::AnySparseMatrix<DATA_TYPE, INDEX_TYPE> any = IVSparse::makeSparseMatrix<DATA_TYPE, INDEX_TYPE>(
+        eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(), eigen.cols(), eigen.nonZeros(), &used, eigen.cols());
+    assert(any.index() + 1 == expectedLevel && used.level == expectedLevel);
+    std::visit([&](auto& mat) { assert(toDense(mat) == dense); }, any);
+
+    // a partial sample still reads the requested number of vectors
+    IVSparse::SizeEstimate sampled = IVSparse::estimateSize<DATA_TYPE, INDEX_TYPE>(
+        eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(), eigen.cols(), eigen.nonZeros(), 8);
+    assert(sampled.sampledVectors == 8 && sampled.cscBytes == csc.byteSize());
+}
+
+void estimateTest() {
+    Eigen::SparseMatrix<DATA_TYPE> distinct = generateMatrix<DATA_TYPE>(60, 40, 3, 109, 100000);
+    Eigen::SparseMatrix<DATA_TYPE> redundant = generateMatrix<DATA_TYPE>(2000, 40, 3, 113, 3);
+    estimateCheck(distinct);
+    estimateCheck(redundant);
+}
+
+// builds a Hybrid matrix whose vectors use every encoding and checks each against Eigen
+template <typename indexT>
+void hybridCheck(std::vector<bool>& seen) {
+    int rows = 250;
+    Eigen::SparseMatrix<DATA_TYPE> eigen(rows, 6);
+    for (int i = 0; i < rows; i++) { eigen.insert(i, 0) = i + 1; }           // full, unique values
+    for (int i = 0; i < rows; i += 60) { eigen.insert(i, 1) = i + 1000; }    // sparse, unique values
+    for (int i = 0; i < rows; i += 2) { eigen.insert(i, 2) = i % 4 + 1; }    // two values
+    for (int i = 0; i < 100; i++) { eigen.insert(i * 2, 3) = i / 5 + 1; }   // short runs
+    for (int i = 0; i < rows; i += 3) { eigen.insert(i, 5) = -(i % 2) - 1; }
+    eigen.makeCompressed();
+
+    IVSparse::SparseMatrix<DATA_TYPE, indexT, 4> hybrid(eigen);
+    for (uint64_t j = 0; j < hybrid.cols(); j++) { seen[hybrid.getEncoding(j)] = true; }
+    checkAgainstEigen(hybrid, eigen);
+
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    Eigen::Matrix<DATA_TYPE, -1, -1> roundTrip = hybrid.toEigen();
+    assert(roundTrip == dense);
+
+    hybrid *= 3;
+    assert(hybrid.sum() == 3 * dense.sum());
+}
+
+void hybridTest() {
+    std::vector<bool> seen(5, false);
+    hybridCheck<INDEX_TYPE>(seen);
+    hybridCheck<uint8_t>(seen);
+    assert((seen[IVSparse::HYBRID_CSC] && seen[IVSparse::HYBRID_VCSC] && seen[IVSparse::HYBRID_IVCSC] && seen[IVSparse::HYBRID_DENSE]));
+}
+
+void patternTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(300, 45, 4, 127, 9);
+    Eigen::SparseMatrix<DATA_TYPE, Eigen::RowMajor> eigenRow = eigen;
+    Eigen::Matrix<double, -1, -1> ones = (Eigen::Matrix<DATA_TYPE, -1, -1>(eigen).array() != 0).cast<double>();
+
+    // the same pattern from Eigen, raw arrays, an IVSparse matrix and row major input
+    IVSparse::SparseMatrix<bool, INDEX_TYPE, 3> pattern(eigen);
+    IVSparse::SparseMatrix<bool, INDEX_TYPE, 3> fromRaw(eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(), eigen.cols(), eigen.nonZeros());
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<bool, INDEX_TYPE, 3> fromVCSC(vcsc);
+    IVSparse::SparseMatrix<bool, INDEX_TYPE, 3, false> patternRow(eigenRow);
+    assert(pattern.nonZeros() == (uint64_t)eigen.nonZeros());
+    assert(toDense(pattern) == ones);
+    assert(fromRaw == pattern && fromVCSC == pattern);
+    assert(toDense(patternRow, false) == ones);
+
+    for (uint64_t j = 0; j < pattern.cols(); j += 7) {
+        for (uint64_t i = 0; i < pattern.rows(); i += 5) { assert(pattern.coeff(i, j) == (ones(i, j) != 0)); }
+    }
+
+    // round trips through Eigen and the valued levels
+    Eigen::SparseMatrix<bool> roundTrip = pattern.toEigen();
+    Eigen::SparseMatrix<double> roundTripDouble = pattern.toEigen<double>();
+    Eigen::Matrix<bool, -1, -1> roundTripDense = roundTrip;
+    Eigen::Matrix<double, -1, -1> roundTripDoubleDense = roundTripDouble;
+    assert(roundTripDense.cast<double>() == ones);
+    assert(roundTripDoubleDense == ones);
+    IVSparse::SparseMatrix<float, INDEX_TYPE, 1> csc = pattern.toCSC<float>();
+    IVSparse::SparseMatrix<float, INDEX_TYPE, 2> vcscOnes = pattern.toVCSC<float>();
+    IVSparse::SparseMatrix<float, INDEX_TYPE, 3> ivcscOnes = pattern.toIVCSC<float>();
+    assert(toDense(csc) == ones && toDense(vcscOnes) == ones && toDense(ivcscOnes) == ones);
+
+    // products and sums count the entries of the pattern
+    Eigen::Matrix<double, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = 0.5 * (i % 5) - 1; }
+    Eigen::Matrix<double, -1, 1> spmv = pattern * x;
+    assert((spmv - ones * x).cwiseAbs().maxCoeff() < 1e-9);
+
+    Eigen::Matrix<int, -1, -1> X(eigen.cols(), 3);
+    for (int i = 0; i < X.size(); i++) { X(i) = i % 7 - 3; }
+    Eigen::Matrix<int, -1, -1> spmm = pattern * X;
+    Eigen::Matrix<int, -1, -1> expected = ones.cast<int>() * X;
+    assert(spmm == expected);
+
+    assert(pattern.sum() == (uint64_t)eigen.nonZeros());
+    assert(std::abs(pattern.norm() - std::sqrt((double)eigen.nonZeros())) < 1e-9);
+    std::vector<uint64_t> outer = pattern.outerSum();
+    std::vector<uint64_t> inner = pattern.innerSum();
+    for (int j = 0; j < ones.cols(); j++) {
+        assert(outer[j] == (uint64_t)ones.col(j).sum() && pattern.getNumIndices(j) == outer[j]);
+        assert(std::abs(pattern.vectorLength(j) - ones.col(j).norm()) < 1e-9);
+    }
+    for (int i = 0; i < ones.rows(); i++) { assert(inner[i] == (uint64_t)ones.row(i).sum()); }
+}
+
+void dictionaryCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen, uint8_t codeSize) {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 5> dict(eigen);
+    checkAgainstEigen(dict, eigen);
+
+    // the dictionary holds each distinct value once
+    std::set<DATA_TYPE> distinct(eigen.valuePtr(), eigen.valuePtr() + eigen.nonZeros());
+    std::set<DATA_TYPE> stored(dict.getDictionary(), dict.getDictionary() + dict.dictionarySize());
+    assert(dict.dictionarySize() == distinct.size() && stored == distinct);
+    assert(dict.codeSize() == codeSize);
+
+    for (uint64_t j = 0; j < dict.cols(); j++) {
+        Eigen::Matrix<DATA_TYPE, -1, 1> column = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(dict.rows());
+        dict.forEachEntry(j, [&](uint64_t index, DATA_TYPE value) { column(index) = value; });
+        assert(column == dense.col(j));
+        assert(std::abs(dict.vectorLength(j) - dense.col(j).cast<double>().norm()) < 1e-9 * (1 + dense.col(j).cast<double>().norm()));
+    }
+    for (uint64_t i = 0; i < dict.rows(); i += 3) {
+        for (uint64_t j = 0; j < dict.cols(); j += 2) { assert(dict.coeff(i, j) == dense(i, j)); }
+    }
+
+    // other sources give the same matrix
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 3> ivcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 5> fromIVCSC(ivcsc);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 5> fromRaw(eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(),
+                                                             eigen.rows(), eigen.cols(), eigen.nonZeros());
+    assert(fromIVCSC == dict && fromRaw == dict);
+    Eigen::Matrix<DATA_TYPE, -1, -1> roundTrip = dict.toEigen();
+    assert(roundTrip == dense);
+
+    // scaling only rewrites the dictionary
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 5> scaled = dict * 3;
+    Eigen::Matrix<double, -1, -1> expected = (3 * dense).cast<double>();
+    assert(toDense(scaled) == expected);
+    dict *= -2;
+    expected = (-2 * dense).cast<double>();
+    assert(toDense(dict) == expected);
+}
+
+void dictionaryTest() {
+    // few values fit one byte codes, many values need two
+    Eigen::SparseMatrix<DATA_TYPE> few = generateMatrix<DATA_TYPE>(120, 40, 3, 131, 20);
+    Eigen::SparseMatrix<DATA_TYPE> many = generateMatrix<DATA_TYPE>(400, 60, 3, 137, 100000);
+    dictionaryCheck(few, 1);
+    dictionaryCheck(many, 2);
+}
+
+void packedCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen) {
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> packed(eigen);
+    checkAgainstEigen(packed, eigen);
+
+    for (uint64_t j = 0; j < packed.cols(); j++) {
+        Eigen::Matrix<DATA_TYPE, -1, 1> column = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(packed.rows());
+        uint64_t count = 0;
+        packed.forEachEntry(j, [&](uint64_t index, DATA_TYPE value) { column(index) = value; count++; });
+        assert(column == dense.col(j) && count == (uint64_t)eigen.col(j).nonZeros());
+    }
+    for (uint64_t i = 0; i < packed.rows(); i += 7) {
+        for (uint64_t j = 0; j < packed.cols(); j++) { assert(packed.coeff(i, j) == dense(i, j)); }
+    }
+
+    // other sources give the same matrix
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 2> vcsc(eigen);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> fromVCSC(vcsc);
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> fromRaw(eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(),
+                                                             eigen.rows(), eigen.cols(), eigen.nonZeros());
+    assert(fromVCSC == packed && fromRaw == packed);
+    Eigen::Matrix<DATA_TYPE, -1, -1> roundTrip = packed.toEigen();
+    assert(roundTrip == dense);
+
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> scaled = packed * 3;
+    Eigen::Matrix<double, -1, -1> expected = (3 * dense).cast<double>();
+    assert(toDense(scaled) == expected);
+    packed *= -2;
+    expected = (-2 * dense).cast<double>();
+    assert(toDense(packed) == expected);
+}
+
+void packedTest() {
+    Eigen::SparseMatrix<DATA_TYPE> random = generateMatrix<DATA_TYPE>(300, 40, 5, 139, 6);
+    packedCheck(random);
+
+    // runs of several blocks, mostly narrow deltas with a few wide gaps to patch
+    int rows = 6000;
+    Eigen::SparseMatrix<DATA_TYPE> runs(rows, 12);
+    for (int j = 0; j < 12; j++) {
+        int i = j;
+        for (int k = 0; i < rows; k++) {
+            runs.insert(i, j) = k % (j + 1) + 1;
+            i += (k % 97 == 96) ? 700 + j : 1 + (k + j) % 3;
+        }
+    }
+    runs.makeCompressed();
+    packedCheck(runs);
+}
+
+// long randomly spaced runs, the kind stored Elias-Fano
+Eigen::SparseMatrix<DATA_TYPE> longRuns(int rows, int cols, uint32_t seed) {
+    std::vector<Eigen::Triplet<DATA_TYPE>> triplets;
+    for (int j = 0; j < cols; j++) {
+        for (int i = 0; i < rows; i++) {
+            seed = seed * 1664525 + 1013904223;
+            if ((seed >> 8) % 9 == 0) { triplets.emplace_back(i, j, 1 + (int)((seed >> 20) % (j % 3 + 1))); }
+        }
+    }
+    Eigen::SparseMatrix<DATA_TYPE> eigen(rows, cols);
+    eigen.setFromTriplets(triplets.begin(), triplets.end());
+    return eigen;
+}
+
+void seekTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = longRuns(20000, 9, 149);
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> packed(eigen);
+    checkAgainstEigen(packed, eigen);
+
+    // entries of the Gram matrix
+    for (uint64_t a = 0; a < packed.cols(); a++) {
+        for (uint64_t b = 0; b < packed.cols(); b++) {
+            assert(packed.vectorDot(a, b) == dense.col(a).dot(dense.col(b)));
+            assert(packed.vectorDot<double>(a, b) == (double)dense.col(a).dot(dense.col(b)));
+        }
+    }
+
+    // coeff seeks into the runs
+    for (uint64_t j = 0; j < packed.cols(); j++) {
+        for (uint64_t i = j; i < packed.rows(); i += 37) { assert(packed.coeff(i, j) == dense(i, j)); }
+        assert(packed.coeff(packed.rows() - 1, j) == dense(packed.rows() - 1, j));
+    }
+
+    // visiting a range sees exactly the entries in it
+    std::vector<std::pair<uint64_t, uint64_t>> ranges = {{0, 20000}, {0, 1}, {5000, 5000}, {123, 4567}, {19990, 20000}, {7777, 15000}};
+    for (uint64_t j = 0; j < packed.cols(); j++) {
+        for (auto& range : ranges) {
+            Eigen::Matrix<DATA_TYPE, -1, 1> visited = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(packed.rows());
+            Eigen::Matrix<DATA_TYPE, -1, 1> expected = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(packed.rows());
+            expected.segment(range.first, range.second - range.first) = dense.col(j).segment(range.first, range.second - range.first);
+            packed.forEachEntry(j, range.first, range.second, [&](uint64_t index, DATA_TYPE value) {
+                assert(index >= range.first && index < range.second && visited(index) == 0);
+                visited(index) = value;
+            });
+            assert(visited == expected);
+        }
+    }
+}
+
+IVSparse::IndexSet makeIndexSet(std::set<uint32_t>& indices) {
+    std::vector<uint32_t> sorted(indices.begin(), indices.end());
+    return IVSparse::IndexSet(sorted.data(), sorted.size());
+}
+
+void checkIndexSet(IVSparse::IndexSet& set, std::set<uint32_t>& expected) {
+    assert(set.cardinality() == expected.size());
+    std::vector<uint32_t> visited;
+    set.forEach([&](uint32_t index) { visited.push_back(index); });
+    assert(visited == std::vector<uint32_t>(expected.begin(), expected.end()));
+    for (uint32_t index = 0; index < 200000; index += 97) { assert(set.contains(index) == (expected.count(index) == 1)); }
+}
+
+void indexSetTest() {
+    // sparse arrays, a dense bitmap and consecutive intervals over several containers
+    std::set<uint32_t> a, b;
+    for (uint32_t i = 0; i < 200000; i += 1000) { a.insert(i); }
+    for (uint32_t i = 70000; i < 90000; i += 2) { a.insert(i); }
+    for (uint32_t i = 140000; i < 150000; i++) { a.insert(i); }
+    for (uint32_t i = 0; i < 200000; i += 3000) { b.insert(i); }
+    for (uint32_t i = 80000; i < 100000; i += 3) { b.insert(i); }
+    for (uint32_t i = 145000; i < 160000; i++) { b.insert(i); }
+
+    IVSparse::IndexSet setA = makeIndexSet(a);
+    IVSparse::IndexSet setB = makeIndexSet(b);
+    checkIndexSet(setA, a);
+    checkIndexSet(setB, b);
+
+    std::set<uint32_t> both, either;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(both, both.begin()));
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(either, either.begin()));
+    IVSparse::IndexSet setAnd = setA & setB;
+    IVSparse::IndexSet setOr = setA | setB;
+    checkIndexSet(setAnd, both);
+    checkIndexSet(setOr, either);
+    assert(setA.andCardinality(setB) == both.size());
+
+    // a written set reads back the same
+    std::vector<uint8_t> bytes(setA.byteSize());
+    assert(setA.write(bytes.data()) == bytes.data() + bytes.size());
+    IVSparse::IndexSet readBack;
+    assert(readBack.read(bytes.data()) == bytes.data() + bytes.size());
+    assert(readBack == setA);
+
+    // the set queries of a packed matrix against its dense columns
+    int rows = 150000;
+    std::vector<Eigen::Triplet<DATA_TYPE>> triplets;
+    for (int i = 0; i < rows; i += 500) { triplets.emplace_back(i, 0, 1 + i % 3); }
+    for (int i = 60000; i < 100000; i++) { triplets.emplace_back(i, 1, 1 + (i / 9000) % 2); }
+    for (int i = 0; i < rows; i += 2) { triplets.emplace_back(i, 2, 1 + i % 4 / 2); }
+    for (int i = 90000; i < 91000; i += 7) { triplets.emplace_back(i, 3, 5); }
+    Eigen::SparseMatrix<DATA_TYPE> eigen(rows, 4);
+    eigen.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::Matrix<DATA_TYPE, -1, -1> dense = eigen;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, 6> packed(eigen);
+    checkAgainstEigen(packed, eigen);
+
+    std::set<uint32_t> maskIndices;
+    for (uint32_t i = 0; i < (uint32_t)rows; i += 5) { maskIndices.insert(i); }
+    for (uint32_t i = 95000; i < 96000; i++) { maskIndices.insert(i); }
+    IVSparse::IndexSet mask = makeIndexSet(maskIndices);
+
+    for (uint64_t j = 0; j < packed.cols(); j++) {
+        std::set<uint32_t> pattern;
+        for (int i = 0; i < rows; i++) { if (dense(i, j) != 0) { pattern.insert(i); } }
+        IVSparse::IndexSet vectorPattern = packed.vectorPattern(j);
+        checkIndexSet(vectorPattern, pattern);
+
+        for (DATA_TYPE value = 1; value <= 5; value++) {
+            std::set<uint32_t> holding;
+            for (int i = 0; i < rows; i++) { if (dense(i, j) == value) { holding.insert(i); } }
+            IVSparse::IndexSet valueSet = packed.indexSet(j, value);
+            checkIndexSet(valueSet, holding);
+        }
+
+        Eigen::Matrix<DATA_TYPE, -1, 1> masked = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(rows);
+        Eigen::Matrix<DATA_TYPE, -1, 1> expected = Eigen::Matrix<DATA_TYPE, -1, 1>::Zero(rows);
+        for (uint32_t i : maskIndices) { expected(i) = dense(i, j); }
+        packed.forEachEntry(j, mask, [&](uint64_t index, DATA_TYPE value) {
+            assert(maskIndices.count(index) == 1 && masked(index) == 0);
+            masked(index) = value;
+        });
+        assert(masked == expected);
+    }
+
+    for (uint64_t a = 0; a < packed.cols(); a++) {
+        for (uint64_t b = 0; b < packed.cols(); b++) {
+            for (DATA_TYPE valueA = 1; valueA <= 3; valueA++) {
+                for (DATA_TYPE valueB = 1; valueB <= 3; valueB++) {
+                    uint64_t count = ((dense.col(a).array() == valueA) && (dense.col(b).array() == valueB)).count();
+                    assert(packed.cooccurrence(a, valueA, b, valueB) == count);
+                }
+            }
+        }
+    }
+}
+
+// products of a reordered matrix, permuted back, match the original product
+template <uint8_t level>
+void reorderCheck(Eigen::SparseMatrix<DATA_TYPE>& eigen, IVSparse::ReorderMethod method) {
+    std::vector<uint64_t> permutation;
+    IVSparse::ReorderReport report;
+    IVSparse::SparseMatrix<DATA_TYPE, INDEX_TYPE, level> reordered = IVSparse::makeReordered<DATA_TYPE, INDEX_TYPE, level>(
+        eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(), eigen.cols(), eigen.nonZeros(), method, permutation, &report);
+
+    // the permutation is a bijection of the rows
+    std::vector<uint64_t> sorted = permutation;
+    std::sort(sorted.begin(), sorted.end());
+    for (uint64_t i = 0; i < sorted.size(); i++) { assert(sorted[i] == i); }
+
+    Eigen::Matrix<DATA_TYPE, -1, 1> x(eigen.cols());
+    for (int i = 0; i < x.rows(); i++) { x(i) = i % 5 - 2; }
+    Eigen::Matrix<DATA_TYPE, -1, 1> result = reordered * x;
+    Eigen::Matrix<DATA_TYPE, -1, 1> expected = eigen * x;
+    for (int i = 0; i < expected.rows(); i++) { assert(expected(i) == result(permutation[i])); }
+
+    assert(report.reorderedBytes == reordered.byteSize());
+    assert(report.originalTraffic > report.originalBytes && report.reorderedTraffic > report.reorderedBytes);
+
+    // a wider dense operand touches at least as many cache lines
+    IVSparse::ReorderReport wide;
+    IVSparse::makeReordered<DATA_TYPE, INDEX_TYPE, level>(eigen.valuePtr(), eigen.innerIndexPtr(), eigen.outerIndexPtr(), eigen.rows(),
+                                                          eigen.cols(), eigen.nonZeros(), method, permutation, &wide, sizeof(double));
+    assert(wide.reorderedBytes == report.reorderedBytes);
+    assert(wide.originalTraffic - wide.originalBytes > report.originalTraffic - report.originalBytes);
+}
+
+void reorderTest() {
+    Eigen::SparseMatrix<DATA_TYPE> eigen = generateMatrix<DATA_TYPE>(400, 30, 3, 21, 4);
+
+    for (IVSparse::ReorderMethod method : {IVSparse::REORDER_NONE, IVSparse::REORDER_NNZ, IVSparse::REORDER_GRAY, IVSparse::REORDER_RCM}) {
+        reorderCheck<1>(eigen, method);
+        reorderCheck<2>(eigen, method);
+        reorderCheck<3>(eigen, method);
+        reorderCheck<4>(eigen, method);
+        reorderCheck<5>(eigen, method);
+        reorderCheck<6>(eigen, method);
+    }
+}